@@ -601,6 +601,63 @@ extern DECLSPEC int SDLCALL SDL_AudioStreamFlush(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
 
+/**
+ *  Let one thread put data into the stream while another gets it, without
+ *  any locking.
+ *
+ *  Normally a stream must not be used by two threads at once. Once this is
+ *  called, one thread may call SDL_AudioStreamPut() and
+ *  SDL_AudioStreamFlush() while another calls SDL_AudioStreamGet(), and
+ *  neither ever waits for the other. All conversion and resampling happens
+ *  in the putting thread; the getting thread only copies out finished
+ *  audio. SDL_AudioStreamAvailable() may be called from either thread.
+ *  SDL_AudioStreamClear() and SDL_FreeAudioStream() still need both
+ *  threads to stay away from the stream.
+ *
+ *  Finished audio is kept in a buffer of at least \c len bytes. When it is
+ *  full, new audio is held back by the putting thread and moved over on
+ *  its next put or flush; putting zero bytes does just that. Audio that is
+ *  held back doesn't count towards SDL_AudioStreamAvailable().
+ *
+ *  This can't be undone, and can only be called once per stream.
+ *
+ *  \param stream The stream to make lock-free
+ *  \param len The size of the buffer for finished audio, in bytes
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetLockFree(SDL_AudioStream *stream, int len);
+
+/**
+ *  Play the stream's input slightly faster or slower than its nominal rate.
+ *
+ *  The ratio scales how fast input is consumed: 1.0 converts at the rates
+ *  the stream was created with, 1.005 uses up input 0.5% faster (so there
+ *  is 0.5% less output, at a slightly higher pitch), 0.995 0.5% slower.
+ *  This is meant for nudging playback along to follow another clock, such
+ *  as a network peer's, and can be called as often as needed.
+ *
+ *  A new ratio takes effect on the next SDL_AudioStreamPut(), and the
+ *  resampler glides to it over the audio put there instead of jumping, so
+ *  the change isn't heard as a click.
+ *
+ *  This only stores the ratio, so it may be called from any thread, even
+ *  while another thread is putting data into the stream. A stream created
+ *  with equal input and output rates starts resampling the first time it
+ *  sees a ratio; setting one before putting any data avoids a seam there.
+ *
+ *  \param stream The stream to change the rate of
+ *  \param ratio The new rate ratio, from 0.25 to 4.0
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetRateRatio(SDL_AudioStream *stream, double ratio);
+
 /**
  * Free an audio stream
  *
@@ -613,6 +670,108 @@ extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
 
+/* SDL_WAVDecoder decodes a WAVE file incrementally.
+   Unlike SDL_LoadWAV_RW(), it never holds more than one encoded block of the
+   file in memory, so it is suitable for long music and voice-over tracks.
+   It understands the same formats as SDL_LoadWAV_RW() and produces the same
+   output: 8, 16 and 32-bit PCM, 32-bit float, 24-bit PCM (expanded to
+   AUDIO_S32), and MS/IMA ADPCM (decoded to AUDIO_S16).
+ */
+/* this is opaque to the outside world. */
+struct _SDL_WAVDecoder;
+typedef struct _SDL_WAVDecoder SDL_WAVDecoder;
+
+/**
+ *  Open a WAVE file for incremental decoding.
+ *
+ *  Only the file header is read here. The audio data is read from \c src as
+ *  it is decoded, so \c src must stay valid until the decoder is freed, and
+ *  must be seekable if SDL_WAVDecoderSeek() is used.
+ *
+ *  \param src The data source for the WAVE data
+ *  \param freesrc If non-zero, \c src is closed when the decoder is freed,
+ *                 or right away if this function fails.
+ *  \param spec Filled in with the format of the decoded audio.
+ *  \return A new decoder, or NULL on error.
+ *
+ *  \sa SDL_WAVDecoderRead
+ *  \sa SDL_WAVDecoderPut
+ *  \sa SDL_WAVDecoderSeek
+ *  \sa SDL_FreeWAVDecoder
+ */
+extern DECLSPEC SDL_WAVDecoder * SDLCALL SDL_NewWAVDecoder(SDL_RWops * src,
+                                                          int freesrc,
+                                                          SDL_AudioSpec * spec);
+
+/**
+ *  Decode audio from a WAVE file.
+ *
+ *  \param decoder The decoder to read from
+ *  \param buf A buffer to fill with audio data in the decoder's format
+ *  \param len The maximum number of bytes to fill. Only whole sample frames
+ *             are decoded, so this is rounded down to a multiple of the
+ *             frame size.
+ *  \return The number of bytes decoded, 0 at the end of the data, or -1 on
+ *          error.
+ *
+ *  \sa SDL_NewWAVDecoder
+ *  \sa SDL_WAVDecoderPut
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderRead(SDL_WAVDecoder * decoder, void *buf, int len);
+
+/**
+ *  Decode audio from a WAVE file straight into an audio stream.
+ *
+ *  The stream's source format, channels and rate must match the spec
+ *  returned by SDL_NewWAVDecoder().
+ *
+ *  \param decoder The decoder to read from
+ *  \param stream The stream the decoded audio is added to
+ *  \param len The maximum number of bytes to decode and add
+ *  \return The number of bytes added, 0 at the end of the data, or -1 on
+ *          error.
+ *
+ *  \sa SDL_NewWAVDecoder
+ *  \sa SDL_WAVDecoderRead
+ *  \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderPut(SDL_WAVDecoder * decoder, SDL_AudioStream * stream, int len);
+
+/**
+ *  Move the decoder to a sample frame.
+ *
+ *  ADPCM data is seeked to the start of the containing block, which is then
+ *  decoded up to the requested frame.
+ *
+ *  \param decoder The decoder to seek
+ *  \param frame The sample frame to continue decoding from, between 0 and
+ *               SDL_WAVDecoderLength()
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_WAVDecoderTell
+ *  \sa SDL_WAVDecoderLength
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderSeek(SDL_WAVDecoder * decoder, Uint32 frame);
+
+/**
+ *  Get the sample frame the next SDL_WAVDecoderRead() will start from.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_WAVDecoderTell(SDL_WAVDecoder * decoder);
+
+/**
+ *  Get the number of sample frames in the WAVE data.
+ *
+ *  This is taken from the file header. If the data turns out to be shorter,
+ *  it is lowered once the decoder reaches the end of the file.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_WAVDecoderLength(SDL_WAVDecoder * decoder);
+
+/**
+ *  Free a WAVE decoder, closing its data source if it was opened with
+ *  \c freesrc set.
+ */
+extern DECLSPEC void SDLCALL SDL_FreeWAVDecoder(SDL_WAVDecoder * decoder);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
@@ -675,6 +834,44 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
  */
 extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *data, Uint32 len);
 
+/**
+ *  Get memory to write audio into, so it can be queued without a copy.
+ *
+ *  This works like SDL_QueueAudio(), but instead of copying your buffer,
+ *  SDL hands you space in its own queue to decode or mix straight into.
+ *  Nothing is queued, and so nothing plays, until you call
+ *  SDL_CommitQueuedAudio() with the number of bytes you wrote.
+ *
+ *  You may write to the returned memory without holding any lock. Only one
+ *  reservation may be pending per device; until it is committed,
+ *  SDL_QueueAudio() and further reservations on the device fail.
+ *  SDL_ClearQueuedAudio() does not affect a pending reservation. The memory
+ *  is freed if the device is closed.
+ *
+ *  \param dev The device ID to which we will queue audio.
+ *  \param len On entry, the number of bytes you'd like to write. On return,
+ *             the number of bytes you may write, which can be less, as
+ *             the queue stores audio in fixed-size packets.
+ *  \return A pointer to (*len) bytes of uninitialized memory, or NULL on
+ *          error.
+ *
+ *  \sa SDL_CommitQueuedAudio
+ *  \sa SDL_QueueAudio
+ */
+extern DECLSPEC void *SDLCALL SDL_ReserveQueuedAudio(SDL_AudioDeviceID dev, Uint32 *len);
+
+/**
+ *  Queue audio written to memory from SDL_ReserveQueuedAudio().
+ *
+ *  \param dev The device ID to which we will queue audio.
+ *  \param len The number of bytes written, no more than were reserved.
+ *             Pass 0 to cancel the reservation.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_ReserveQueuedAudio
+ */
+extern DECLSPEC int SDLCALL SDL_CommitQueuedAudio(SDL_AudioDeviceID dev, Uint32 len);
+
 /**
  *  Dequeue more audio on non-callback devices.
  *
@@ -721,6 +918,38 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
  */
 extern DECLSPEC Uint32 SDLCALL SDL_DequeueAudio(SDL_AudioDeviceID dev, void *data, Uint32 len);
 
+/**
+ *  Look at captured audio on non-callback devices without copying it.
+ *
+ *  This returns the oldest audio SDL_DequeueAudio() would return, in place.
+ *  It may be less than SDL_GetQueuedAudioSize() reports, since queued audio
+ *  is stored in fixed-size packets; call SDL_ConsumeQueuedAudio() and peek
+ *  again to see the rest. The memory stays valid, even while the device
+ *  keeps capturing, until you consume it or call SDL_ClearQueuedAudio().
+ *
+ *  \param dev The device ID from which we will dequeue audio.
+ *  \param len Filled in with the number of bytes available at the returned
+ *             pointer.
+ *  \return A pointer to captured audio, or NULL if there is none or the
+ *          device isn't a capture device set up for queueing.
+ *
+ *  \sa SDL_ConsumeQueuedAudio
+ *  \sa SDL_DequeueAudio
+ */
+extern DECLSPEC const void *SDLCALL SDL_PeekQueuedAudio(SDL_AudioDeviceID dev, Uint32 *len);
+
+/**
+ *  Drop captured audio from the queue, as if it had been dequeued.
+ *
+ *  \param dev The device ID from which we will dequeue audio.
+ *  \param len The number of bytes to drop.
+ *  \return The number of bytes dropped, which is 0 for devices that aren't
+ *          capture devices set up for queueing.
+ *
+ *  \sa SDL_PeekQueuedAudio
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_ConsumeQueuedAudio(SDL_AudioDeviceID dev, Uint32 len);
+
 /**
  *  Get the number of bytes of still-queued audio.
  *
@@ -793,6 +1022,159 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  */
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
+/**
+ *  Mix an audio stream into the output of an opened playback device.
+ *
+ *  Any number of streams can be bound to a device. Every time the device
+ *  needs more audio, it runs the callback (or plays queued audio) as usual,
+ *  then pulls a buffer's worth of data from each bound stream and adds it,
+ *  scaled by the stream's gain. The sum is done in floating point and only
+ *  clamped once, when it is converted to the device format.
+ *
+ *  The stream has to produce AUDIO_F32SYS data with the channel count and
+ *  sample rate of the device, as reported in the obtained spec of
+ *  SDL_OpenAudioDevice(). Streams that run dry just stop contributing
+ *  until more data is put into them.
+ *
+ *  The device thread reads from the stream while holding the device lock,
+ *  so lock the device with SDL_LockAudioDevice() around calls that use the
+ *  stream, such as SDL_AudioStreamPut(), unless the stream was made
+ *  lock-free with SDL_AudioStreamSetLockFree(). Unbind a stream before freeing it;
+ *  closing the device unbinds all of its streams but doesn't free them.
+ *
+ *  Binding a stream that is already bound to the device changes its gain.
+ *
+ *  \param dev The device ID to mix the stream into.
+ *  \param stream The stream to pull audio from.
+ *  \param gain The scale applied to the stream's samples; 1.0f leaves them
+ *              unchanged.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_UnbindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_BindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream, float gain);
+
+/**
+ *  Stop mixing an audio stream into a playback device, or capturing into
+ *  a stream from SDL_NewCaptureAudioStream().
+ *
+ *  Data left in the stream stays there. It is safe to free the stream once
+ *  this returns. For a capture device, this waits for the buffer being
+ *  captured to be finished, which can take as long as the buffer lasts.
+ *
+ *  \param dev The device ID the stream is bound to.
+ *  \param stream The stream to unbind.
+ *
+ *  \sa SDL_BindAudioStream
+ *  \sa SDL_NewCaptureAudioStream
+ */
+extern DECLSPEC void SDLCALL SDL_UnbindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ *  Create an audio stream that a capture device feeds directly.
+ *
+ *  Audio goes from the device's own buffers into the stream, which converts
+ *  it to the requested format in one go: it isn't first converted to the
+ *  format asked for in SDL_OpenAudioDevice(), nor queued for
+ *  SDL_DequeueAudio(). While any such stream is bound to the device, the
+ *  device's callback is not called and nothing is queued.
+ *
+ *  The stream is lock-free (see SDL_AudioStreamSetLockFree()), so read it
+ *  with SDL_AudioStreamGet() from any one thread without locking the
+ *  device. It holds up to \c len bytes of converted audio. If it is full
+ *  when more arrives, what doesn't fit is dropped and counted in the
+ *  \c overruns of SDL_GetAudioDeviceStats().
+ *
+ *  Call SDL_UnbindAudioStream() before freeing the stream with
+ *  SDL_FreeAudioStream(). Closing the device unbinds it too, but doesn't
+ *  free it.
+ *
+ *  \param dev The capture device to read from.
+ *  \param format The format SDL_AudioStreamGet() should produce.
+ *  \param channels The channel count SDL_AudioStreamGet() should produce.
+ *  \param rate The sample rate SDL_AudioStreamGet() should produce.
+ *  \param len How many bytes of converted audio the stream can hold.
+ *  \return The new stream, or NULL on error.
+ *
+ *  \sa SDL_UnbindAudioStream
+ *  \sa SDL_GetAudioDeviceStats
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewCaptureAudioStream(SDL_AudioDeviceID dev,
+                                                                    const SDL_AudioFormat format,
+                                                                    const Uint8 channels,
+                                                                    const int rate,
+                                                                    int len);
+
+/**
+ *  Get how much audio an opened device has handled, in sample frames.
+ *
+ *  This counts the frames the callback (or the audio queue) has produced
+ *  for a playback device, or consumed from a capture device, since it was
+ *  opened. Time spent paused isn't counted. Divide by the freq of the
+ *  obtained spec to get seconds.
+ *
+ *  With real hardware this runs a little ahead of what is audible, by
+ *  however much the device buffers. With the disk driver in freerun mode
+ *  (SDL_DISKAUDIOFREERUN=1) the device isn't tied to the wall clock at all,
+ *  and this is the only clock the app should use.
+ *
+ *  \param dev The device ID to query.
+ *  \return The number of sample frames handled, or 0 if the device ID is
+ *          invalid.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetAudioDevicePosition(SDL_AudioDeviceID dev);
+
+/**
+ *  The number of buckets in SDL_AudioDeviceStats::callback_histogram.
+ */
+#define SDL_AUDIO_STATS_BUCKETS 8
+
+/**
+ *  \brief Statistics about an opened audio device's thread.
+ *
+ *  Times are in SDL_GetPerformanceCounter() units. A "buffer" is one
+ *  callback's worth of audio, spec.samples sample frames of the obtained
+ *  spec.
+ *
+ *  \sa SDL_GetAudioDeviceStats()
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint32 callbacks;           /**< Number of times the callback ran */
+    Uint32 deadline_misses;     /**< Callbacks that took longer than their buffer lasts */
+    Uint32 underruns;           /**< Times the device ran out of data and got silence instead */
+    Uint32 overruns;            /**< Times captured data was dropped because it couldn't be stored */
+    Uint32 queued_bytes;        /**< Bytes in the SDL_QueueAudio()/SDL_DequeueAudio() queue */
+    Uint32 callback_histogram[SDL_AUDIO_STATS_BUCKETS];
+                                /**< Callback durations: bucket i counts callbacks that took
+                                     less than 2^(i-5) buffers, the last one counts the rest */
+    Uint64 callback_ticks;      /**< Total time spent in the callback */
+    Uint64 max_callback_ticks;  /**< The longest callback */
+    Uint64 max_interval_ticks;  /**< The longest time between the start of two callbacks */
+    Uint64 conversion_ticks;    /**< Time spent converting between the callback's format
+                                     and the device's */
+} SDL_AudioDeviceStats;
+
+/**
+ *  Get statistics about how the audio thread of an opened device is doing.
+ *
+ *  These are meant to explain glitches: a callback that is sometimes too
+ *  slow shows up in the histogram and deadline_misses, an app that doesn't
+ *  queue audio fast enough shows up in underruns, and so on. Callback time
+ *  includes mixing streams bound with SDL_BindAudioStream(). Gathering them
+ *  costs a couple of SDL_GetPerformanceCounter() calls per callback, so they
+ *  are always on.
+ *
+ *  Underruns count each time playback runs dry after having had data, or a
+ *  capture device delivers less than a full buffer. Pausing doesn't count.
+ *
+ *  \param dev   The device ID to query.
+ *  \param stats A pointer filled in with the statistics.
+ *  \param reset SDL_TRUE to start counting from zero after reading them.
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev, SDL_AudioDeviceStats *stats, SDL_bool reset);
+
 
 /**
  *  \name Audio lock functions
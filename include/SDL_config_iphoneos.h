@@ -125,6 +125,7 @@
 #define HAVE_SETJMP 1
 #define HAVE_NANOSLEEP  1
 #define HAVE_SYSCONF    1
+#define HAVE_MMAP   1
 #define HAVE_SYSCTLBYNAME 1
 
 /* enable iPhone version of Core Audio driver */
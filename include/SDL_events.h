@@ -652,6 +652,44 @@ extern DECLSPEC SDL_bool SDLCALL SDL_HasEvents(Uint32 minType, Uint32 maxType);
 extern DECLSPEC void SDLCALL SDL_FlushEvent(Uint32 type);
 extern DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
 
+/**
+ *  \brief Statistics about the event queue.
+ *
+ *  \sa SDL_GetEventQueueStats
+ */
+typedef struct SDL_EventQueueStats
+{
+    int num_events;         /**< Number of events in the queue right now */
+    int max_events_seen;    /**< Most events that have been in the queue at once */
+    Uint32 locked_pushes;   /**< Events that had to lock the queue to be added, because its lock-free buffer was full or they were SDL_SYSWMEVENTs */
+    Uint32 push_retries;    /**< Times an event being added lost a race with another thread and had to try again */
+    Uint32 lock_contention; /**< Times a thread had to wait for another thread to unlock the queue */
+} SDL_EventQueueStats;
+
+/**
+ *  \brief Get statistics about the event queue.
+ *
+ *  Events can be added from any thread without locking the queue, as long
+ *  as they are read back often enough that it doesn't fill its lock-free
+ *  buffer. These counters show how close you are to that, and how much
+ *  threads are fighting over the queue.
+ *
+ *  The counters start when the event loop starts, or at the last call to
+ *  SDL_ResetEventQueueStats().
+ *
+ *  This function is thread-safe.
+ *
+ *  \param stats Filled in with the current statistics.
+ */
+extern DECLSPEC void SDLCALL SDL_GetEventQueueStats(SDL_EventQueueStats * stats);
+
+/**
+ *  \brief Reset the event queue counters.
+ *
+ *  The high-water mark is set to the number of events in the queue right now.
+ */
+extern DECLSPEC void SDLCALL SDL_ResetEventQueueStats(void);
+
 /**
  *  \brief Polls for currently pending events.
  *
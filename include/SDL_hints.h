@@ -135,8 +135,13 @@ extern "C" {
  *
  *  This variable can be set to the following values:
  *    "0" or "nearest" - Nearest pixel sampling
- *    "1" or "linear"  - Linear filtering (supported by OpenGL and Direct3D)
- *    "2" or "best"    - Currently this is the same as "linear"
+ *    "1" or "linear"  - Linear filtering (supported by OpenGL, Direct3D and
+ *                       software scaling of 32-bit surfaces)
+ *    "2" or "best"    - Currently this is the same as "linear", except that
+ *                       software scaling averages the covered source area
+ *                       when shrinking
+ *
+ *  This also applies to SDL_BlitScaled().
  *
  *  By default nearest pixel sampling is used
  */
@@ -1077,6 +1082,52 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling whether the software renderer rasterizes its command queue in parallel.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Run the command queue on the rendering thread only (default)
+ *    "1"     - Split the render target into tiles and rasterize them on worker threads
+ *
+ *  The output is identical to the serial path: each tile runs its commands
+ *  in submission order. Clears, fills, points and unscaled copies are tiled,
+ *  other commands wait for pending tiles and run on the rendering thread.
+ *
+ *  This hint is checked when the software renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_TILED  "SDL_RENDER_SOFTWARE_TILED"
+
+/**
+ *  \brief  A variable setting the frame size above which YUV conversions run on worker threads.
+ *
+ *  The value is a pixel count. Conversions between YUV and RGB formats of at
+ *  least this many pixels are split into bands of rows and converted on the
+ *  job pool. The output is identical to converting on the calling thread.
+ *
+ *  "0" disables threaded conversion. The default is 921600 (1280x720).
+ *
+ *  This hint is checked on every conversion.
+ */
+#define SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD  "SDL_YUV_CONVERSION_THREADS_THRESHOLD"
+
+/**
+ *  \brief  A variable setting the image size above which RGB pixel conversions run on worker threads.
+ *
+ *  The value is a pixel count. SDL_ConvertPixels() and SDL_ConvertSurface()
+ *  calls between RGB formats of at least this many pixels are split into
+ *  bands of rows and converted on the job pool. The output is identical to
+ *  converting on the calling thread.
+ *
+ *  Surfaces with RLE acceleration or indexed formats are always converted
+ *  on the calling thread.
+ *
+ *  "0" disables threaded conversion (default).
+ *
+ *  This hint is checked on every conversion.
+ */
+#define SDL_HINT_CONVERSION_THREADS_THRESHOLD  "SDL_CONVERSION_THREADS_THRESHOLD"
+
 
 /**
  *  \brief  An enumeration of hint priorities
@@ -115,6 +115,34 @@ typedef enum
     SDL_FLIP_VERTICAL = 0x00000002     /**< flip vertically */
 } SDL_RendererFlip;
 
+/**
+ *  \brief Statistics about the render commands queued for one frame.
+ *
+ *  \sa SDL_RenderGetStats()
+ */
+typedef struct SDL_RenderStats
+{
+    Uint32 frame;               /**< The number of frames presented before this one */
+    Uint32 commands;            /**< Total number of commands sent to the backend */
+    Uint32 viewport_commands;   /**< Number of viewport changes */
+    Uint32 cliprect_commands;   /**< Number of clip rectangle changes */
+    Uint32 drawcolor_commands;  /**< Number of draw color changes */
+    Uint32 clear_commands;      /**< Number of clears */
+    Uint32 point_commands;      /**< Number of point drawing commands */
+    Uint32 line_commands;       /**< Number of line drawing commands */
+    Uint32 fillrect_commands;   /**< Number of rectangle filling commands */
+    Uint32 copy_commands;       /**< Number of texture copies */
+    Uint32 copyex_commands;     /**< Number of rotated or flipped texture copies */
+    Uint32 noop_commands;       /**< Number of commands the backend failed to queue */
+    Uint32 elided_state_changes;/**< State changes skipped because they matched the queued state */
+    Uint32 flushes;             /**< Number of times the queue was sent to the backend */
+    Uint32 texture_flushes;     /**< Flushes forced by changing a texture the queue was using */
+    Uint32 vertex_gap_reuses;   /**< Vertex allocations that reused alignment padding */
+    Uint64 vertex_bytes;        /**< Bytes of vertex data sent to the backend */
+    Uint64 run_ticks;           /**< Time spent running the queue in the backend, in
+                                     SDL_GetPerformanceCounter() units */
+} SDL_RenderStats;
+
 /**
  *  \brief A structure representing rendering state
  */
@@ -1043,6 +1071,27 @@ extern DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer * renderer);
  */
 extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
 
+/**
+ *  \brief Get statistics about the render command queue for a frame.
+ *
+ *  \param renderer   The renderer to query.
+ *  \param stats      A pointer filled in with the statistics.
+ *  \param last_frame SDL_TRUE to get the statistics of the most recently
+ *                    presented frame, SDL_FALSE to get the ones gathered so
+ *                    far for the frame in progress.
+ *
+ *  Statistics are reset every time SDL_RenderPresent() is called.  They can
+ *  be used to find out why batching isn't effective, for example because
+ *  textures are updated while draws using them are still queued.
+ *
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_RenderPresent()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer * renderer,
+                                               SDL_RenderStats * stats,
+                                               SDL_bool last_frame);
+
 
 /**
  *  \brief Bind the texture to the current OpenGL/ES/ES2 context for use with
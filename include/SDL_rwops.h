@@ -45,6 +45,7 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3U  /**< Android asset */
 #define SDL_RWOPS_MEMORY    4U  /**< Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5U  /**< Read-Only memory stream */
+#define SDL_RWOPS_MAPPED    6U  /**< Read-Only file mapped into memory */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -165,6 +166,22 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ *  Open a file read-only, with its contents mapped into memory.
+ *
+ *  Reads and seeks on the returned stream are plain memory operations, and
+ *  SDL_RWborrow() can be used to get at the file contents without copying.
+ *  The stream can not be written to.
+ *
+ *  On platforms where the file can't be mapped, its contents are read into
+ *  memory when it is opened instead.
+ *
+ *  \return the new stream, or NULL if the file couldn't be opened.
+ *
+ *  \sa SDL_RWborrow
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromFileMapped(const char *file);
+
 /* @} *//* RWFrom functions */
 
 
@@ -190,6 +207,28 @@ extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 /* @} *//* Read/write macros */
 
 
+/**
+ *  Get a pointer to the data at the current position of a memory backed
+ *  stream, without copying it.
+ *
+ *  This works for streams created with SDL_RWFromMem(), SDL_RWFromConstMem()
+ *  and SDL_RWFromFileMapped().  The current position is not changed, use
+ *  SDL_RWseek() to skip over the data you've consumed.
+ *
+ *  The data must not be modified, and is only valid until the stream is
+ *  closed.
+ *
+ *  \param context   The stream to borrow data from.
+ *  \param available If not NULL, filled with the number of bytes that can
+ *                   be read from the returned pointer.
+ *
+ *  \return a pointer to the data, or NULL if the stream isn't backed by
+ *          memory.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWborrow(SDL_RWops * context,
+                                                 size_t *available);
+
+
 /**
  *  Load all the data from an SDL data stream.
  *
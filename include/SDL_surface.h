@@ -502,7 +502,8 @@ extern DECLSPEC int SDLCALL SDL_LowerBlit
  *  \brief Perform a fast, low quality, stretch blit between two surfaces of the
  *         same pixel format.
  *
- *  \note This function uses a static buffer, and is not thread-safe.
+ *  \note SDL_BlitScaled() uses linear or area-averaging filtering instead for
+ *        32-bit surfaces when ::SDL_HINT_RENDER_SCALE_QUALITY asks for it.
  */
 extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             const SDL_Rect * srcrect,
@@ -331,6 +331,94 @@ extern DECLSPEC void * SDLCALL SDL_TLSGet(SDL_TLSID id);
  */
 extern DECLSPEC int SDLCALL SDL_TLSSet(SDL_TLSID id, const void *value, void (SDLCALL *destructor)(void*));
 
+/**
+ *  \name Job system
+ *
+ *  SDL keeps one shared pool of worker threads, sized from
+ *  SDL_GetCPUCount(), for running short jobs.  Each worker has its own
+ *  deque of jobs and steals from the others when it runs dry, so jobs that
+ *  add more jobs stay on the thread that created them unless another
+ *  thread is idle.
+ *
+ *  Jobs are grouped with counters: adding a job increments its counter,
+ *  and finishing it decrements the counter again.  A job can also wait for
+ *  another counter to reach zero before it is allowed to start, and
+ *  SDL_WaitJobCounter() runs queued jobs while it waits, so waiting from
+ *  inside a job never ties up a worker.
+ *
+ *  SDL uses the same pool internally, so applications that use it don't
+ *  end up with more busy threads than there are CPUs.
+ */
+/* @{ */
+
+/* The job counter structure, defined in SDL_job.c */
+struct SDL_JobCounter;
+typedef struct SDL_JobCounter SDL_JobCounter;
+
+/* The function run by a job */
+typedef void (SDLCALL * SDL_JobFunction) (void *data);
+
+/**
+ *  \brief Create a job counter, initialized to zero.
+ *
+ *  \return The new counter, or NULL on error.
+ */
+extern DECLSPEC SDL_JobCounter * SDLCALL SDL_CreateJobCounter(void);
+
+/**
+ *  \brief Destroy a job counter.
+ *
+ *  The counter must not have any unfinished jobs.  Jobs that are still
+ *  waiting for this counter to reach zero are discarded without running.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyJobCounter(SDL_JobCounter *counter);
+
+/**
+ *  \brief Get the number of unfinished jobs counted by a job counter.
+ */
+extern DECLSPEC int SDLCALL SDL_GetJobCounterValue(SDL_JobCounter *counter);
+
+/**
+ *  \brief Add a job to the shared job pool.
+ *
+ *  \param function The function to run on a worker thread.
+ *  \param data A pointer passed to the function.
+ *  \param counter A counter that includes this job until it finishes, or NULL.
+ *  \param dependency A counter that has to reach zero before the job can
+ *                    start, or NULL to start it as soon as possible.  This
+ *                    is checked when the job is added, so add the jobs it
+ *                    counts first.
+ *
+ *  \return 0 on success, or -1 on error (the job isn't added).
+ *
+ *  This is safe to call from any thread, including from inside a job.
+ *
+ *  \sa SDL_WaitJobCounter()
+ */
+extern DECLSPEC int SDLCALL SDL_AddJob(SDL_JobFunction function, void *data,
+                                       SDL_JobCounter *counter,
+                                       SDL_JobCounter *dependency);
+
+/**
+ *  \brief Wait for a job counter to reach zero.
+ *
+ *  While it waits, the calling thread runs jobs from the shared pool
+ *  instead of sleeping, as long as there are any.
+ */
+extern DECLSPEC void SDLCALL SDL_WaitJobCounter(SDL_JobCounter *counter);
+
+/**
+ *  \brief Get the number of worker threads in the shared job pool.
+ *
+ *  This starts the pool if it isn't running yet.
+ *
+ *  \return The number of worker threads, or 0 if jobs only run while a
+ *          thread waits for them.
+ */
+extern DECLSPEC int SDLCALL SDL_GetNumJobThreads(void);
+
+/* @} *//* Job system */
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
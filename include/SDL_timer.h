@@ -94,6 +94,28 @@ extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimer(Uint32 interval,
                                                  SDL_TimerCallback callback,
                                                  void *param);
 
+/**
+ *  Function prototype for the nanosecond timer callback function.
+ *
+ *  This works like ::SDL_TimerCallback, except that the intervals passed
+ *  in and returned are in nanoseconds.
+ */
+typedef Uint64 (SDLCALL * SDL_NSTimerCallback) (Uint64 interval, void *param);
+
+/**
+ * \brief Add a new timer to the pool of timers already running, with an
+ *        interval in nanoseconds.
+ *
+ * Timers are scheduled against SDL_GetPerformanceCounter(), so this can be
+ * used for deadlines finer than a millisecond. The timer thread spins for the
+ * last fraction of a millisecond before one of these timers is due.
+ *
+ * \return A timer ID, or 0 when an error occurs. Remove it with SDL_RemoveTimer().
+ */
+extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval,
+                                                   SDL_NSTimerCallback callback,
+                                                   void *param);
+
 /**
  * \brief Remove a timer knowing its ID.
  *
@@ -39,6 +39,9 @@ struct SDL_DataQueue
     SDL_DataQueuePacket *pool; /* these are unused packets. */
     size_t packet_size;   /* size of new packets */
     size_t queued_bytes;  /* number of bytes of data in the queue. */
+    SDL_DataQueuePacket *reserved;  /* packet with a write in progress, if any. */
+    size_t reserved_len;  /* bytes available to that write. */
+    SDL_bool reserved_linked;  /* SDL_FALSE if that packet isn't in the queue (yet, or anymore). */
 };
 
 static void
@@ -90,6 +93,9 @@ SDL_FreeDataQueue(SDL_DataQueue *queue)
     if (queue) {
         SDL_FreeDataQueueList(queue->head);
         SDL_FreeDataQueueList(queue->pool);
+        if (queue->reserved && !queue->reserved_linked) {
+            SDL_free(queue->reserved);
+        }
         SDL_free(queue);
     }
 }
@@ -107,6 +113,21 @@ SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
         return;
     }
 
+    /* a write in progress keeps its packet; it gets queued when committed. */
+    if (queue->reserved && queue->reserved_linked) {
+        SDL_DataQueuePacket *reserved = queue->reserved;
+        SDL_assert(reserved == queue->tail);
+        if (queue->head == reserved) {
+            queue->head = queue->tail = NULL;
+        } else {
+            for (packet = queue->head; packet->next != reserved; packet = packet->next) { /* spin */ }
+            packet->next = NULL;
+            queue->tail = packet;
+        }
+        reserved->startpos = reserved->datalen;
+        queue->reserved_linked = SDL_FALSE;
+    }
+
     packet = queue->head;
 
     /* merge the available pool and the current queue into one list. */
@@ -138,7 +159,7 @@ SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
 }
 
 static SDL_DataQueuePacket *
-AllocateDataQueuePacket(SDL_DataQueue *queue)
+GetDataQueuePacket(SDL_DataQueue *queue)
 {
     SDL_DataQueuePacket *packet;
 
@@ -159,14 +180,29 @@ AllocateDataQueuePacket(SDL_DataQueue *queue)
     packet->datalen = 0;
     packet->startpos = 0;
     packet->next = NULL;
-                
+    return packet;
+}
+
+static void
+LinkDataQueuePacket(SDL_DataQueue *queue, SDL_DataQueuePacket *packet)
+{
     SDL_assert((queue->head != NULL) == (queue->queued_bytes != 0));
+    packet->next = NULL;
     if (queue->tail == NULL) {
         queue->head = packet;
     } else {
         queue->tail->next = packet;
     }
     queue->tail = packet;
+}
+
+static SDL_DataQueuePacket *
+AllocateDataQueuePacket(SDL_DataQueue *queue)
+{
+    SDL_DataQueuePacket *packet = GetDataQueuePacket(queue);
+    if (packet != NULL) {
+        LinkDataQueuePacket(queue, packet);
+    }
     return packet;
 }
 
@@ -184,6 +220,8 @@ SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _len)
 
     if (!queue) {
         return SDL_InvalidParamError("queue");
+    } else if (queue->reserved) {
+        return SDL_SetError("Data queue has a write in progress");
     }
 
     orighead = queue->head;
@@ -268,16 +306,57 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         SDL_assert(queue->queued_bytes >= avail);
 
         SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
-        packet->startpos += cpy;
+        SDL_ConsumeFromDataQueue(queue, cpy);
         ptr += cpy;
+        len -= cpy;
+    }
+
+    return (size_t) (ptr - buf);
+}
+
+const void *
+SDL_PeekPacketInDataQueue(SDL_DataQueue *queue, size_t *len)
+{
+    SDL_DataQueuePacket *packet = queue ? queue->head : NULL;
+
+    if (!packet) {
+        *len = 0;
+        return NULL;
+    }
+
+    *len = packet->datalen - packet->startpos;
+    return packet->data + packet->startpos;
+}
+
+size_t
+SDL_ConsumeFromDataQueue(SDL_DataQueue *queue, const size_t _len)
+{
+    size_t len = _len;
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        return 0;
+    }
+
+    while ((len > 0) && ((packet = queue->head) != NULL)) {
+        const size_t avail = packet->datalen - packet->startpos;
+        const size_t cpy = SDL_min(len, avail);
+        SDL_assert(queue->queued_bytes >= avail);
+
+        packet->startpos += cpy;
         queue->queued_bytes -= cpy;
         len -= cpy;
 
         if (packet->startpos == packet->datalen) {  /* packet is done, put it in the pool. */
             queue->head = packet->next;
             SDL_assert((packet->next != NULL) || (packet == queue->tail));
-            packet->next = queue->pool;
-            queue->pool = packet;
+            if (packet == queue->reserved) {
+                /* a write is in progress past the end of this one; it'll be queued again on commit. */
+                queue->reserved_linked = SDL_FALSE;
+            } else {
+                packet->next = queue->pool;
+                queue->pool = packet;
+            }
         }
     }
 
@@ -287,7 +366,7 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         queue->tail = NULL;  /* in case we drained the queue entirely. */
     }
 
-    return (size_t) (ptr - buf);
+    return _len - len;
 }
 
 size_t
@@ -310,9 +389,12 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     } else if (len > queue->packet_size) {
         SDL_SetError("len is larger than packet size");
         return NULL;
+    } else if (queue->reserved) {
+        SDL_SetError("Data queue has a write in progress");
+        return NULL;
     }
 
-    packet = queue->head;
+    packet = queue->tail;
     if (packet) {
         const size_t avail = queue->packet_size - packet->datalen;
         if (len <= avail) {  /* we can use the space at end of this packet. */
@@ -335,5 +417,72 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     return packet->data;
 }
 
+void *
+SDL_ReserveWriteInDataQueue(SDL_DataQueue *queue, size_t *len)
+{
+    SDL_DataQueuePacket *packet;
+    size_t wanted;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    } else if (!len || (*len == 0)) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    } else if (queue->reserved) {
+        SDL_SetError("Data queue has a write in progress");
+        return NULL;
+    }
+
+    wanted = SDL_min(*len, queue->packet_size);
+    packet = queue->tail;
+    if (packet && ((queue->packet_size - packet->datalen) >= wanted)) {
+        /* the write fits after the data in the tail packet. */
+        queue->reserved_linked = SDL_TRUE;
+    } else {
+        /* Need a fresh packet; it isn't queued until the write is committed. */
+        packet = GetDataQueuePacket(queue);
+        if (!packet) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        queue->reserved_linked = SDL_FALSE;
+    }
+
+    queue->reserved = packet;
+    queue->reserved_len = *len = wanted;
+    return packet->data + packet->datalen;
+}
+
+int
+SDL_CommitWriteToDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (!queue->reserved) {
+        return SDL_SetError("Data queue has no write in progress");
+    } else if (len > queue->reserved_len) {
+        return SDL_InvalidParamError("len");
+    }
+
+    packet = queue->reserved;
+    queue->reserved = NULL;
+
+    if (!queue->reserved_linked) {
+        if (len == 0) {  /* nothing written, put it in the pool. */
+            packet->next = queue->pool;
+            queue->pool = packet;
+            return 0;
+        }
+        LinkDataQueuePacket(queue, packet);
+    }
+
+    packet->datalen += len;
+    queue->queued_bytes += len;
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
 
@@ -49,6 +49,28 @@ size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 */
 void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
 
+/* These let a producer write straight into the queue's memory. Unlike
+   SDL_ReserveSpaceInDataQueue(), nothing is queued until the write is
+   committed, so a consumer never sees the space before it's filled in.
+   *len is how much you'd like to write on entry, and how much you may
+   write on return; that's at most the packetlen given to SDL_NewDataQueue.
+   Only one write may be in progress, and other writes to the queue fail
+   until it is committed. Committing 0 bytes cancels the write. There is no
+   thread safety, but the reserved memory may be written without holding
+   whatever lock protects the queue, as reads and SDL_ClearDataQueue()
+   leave it alone.
+   Returns pointer to buffer of (*len) bytes, NULL on error. */
+void *SDL_ReserveWriteInDataQueue(SDL_DataQueue *queue, size_t *len);
+int SDL_CommitWriteToDataQueue(SDL_DataQueue *queue, const size_t len);
+
+/* These let a consumer read the queue's memory in place: peek returns the
+   contiguous data at the head of the queue and its length in *len (NULL and
+   0 if the queue is empty), and consume drops up to len bytes from the head,
+   returning how many were dropped. The peeked memory stays valid until it
+   is consumed or the queue is cleared; writes don't touch it. */
+const void *SDL_PeekPacketInDataQueue(SDL_DataQueue *queue, size_t *len);
+size_t SDL_ConsumeFromDataQueue(SDL_DataQueue *queue, const size_t len);
+
 #endif /* SDL_dataqueue_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -51,6 +51,24 @@
 
 #include "SDL_config.h"
 
+/* Instruction sets beyond the build's baseline that individual functions can
+   be compiled for with SDL_TARGETING(), then selected at runtime with the
+   SDL_cpuinfo.h feature checks. */
+#if (defined(__i386__) || defined(__x86_64__)) && \
+    defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && \
+    (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#elif defined(_MSC_VER) && (_MSC_VER >= 1700) && !defined(__clang__) && (defined(_M_IX86) || defined(_M_X64))
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+
+#ifndef SDL_TARGETING
+#define SDL_TARGETING(x)
+#endif
+
 #endif /* SDL_internal_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
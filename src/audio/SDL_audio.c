@@ -582,6 +582,54 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
         SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->spec.silence, len);
+        if (!device->stats_starved) {  /* only count running dry, not staying dry. */
+            device->stats.underruns++;
+            device->stats_starved = SDL_TRUE;
+        }
+    } else {
+        device->stats_starved = SDL_FALSE;
+    }
+}
+
+/* Does what SDL_BufferQueueDrainCallback does for a device that converts
+   its audio, but hands the queued packets to the device's stream in place,
+   rather than copying them to work_buffer first. Needs the mixer lock. */
+static void
+drain_buffer_queue_to_stream(SDL_AudioDevice *device, int len)
+{
+    const int framesize = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    Uint8 frame[64];
+    size_t avail;
+    const void *packet;
+
+    SDL_assert((size_t) framesize <= sizeof (frame));
+
+    while ((len > 0) && ((packet = SDL_PeekPacketInDataQueue(device->buffer_queue, &avail)) != NULL)) {
+        /* streams only take whole sample frames. */
+        int cpy = (int) SDL_min(avail, (size_t) len);
+        cpy -= cpy % framesize;
+        if (cpy > 0) {
+            /* if this fails...oh well. We'll play silence here. */
+            SDL_AudioStreamPut(device->stream, packet, cpy);
+            SDL_ConsumeFromDataQueue(device->buffer_queue, cpy);
+        } else {  /* a frame straddles two packets, or the queue ends mid-frame. */
+            const size_t got = SDL_ReadFromDataQueue(device->buffer_queue, frame, framesize);
+            SDL_memset(frame + got, device->spec.silence, framesize - got);
+            SDL_AudioStreamPut(device->stream, frame, framesize);
+            cpy = framesize;
+        }
+        len -= cpy;
+    }
+
+    if (len > 0) {  /* pad with silence, as SDL_BufferQueueDrainCallback would. */
+        SDL_memset(device->work_buffer, device->spec.silence, len);
+        SDL_AudioStreamPut(device->stream, device->work_buffer, len);
+        if (!device->stats_starved) {
+            device->stats.underruns++;
+            device->stats_starved = SDL_TRUE;
+        }
+    } else {
+        device->stats_starved = SDL_FALSE;
     }
 }
 
@@ -598,7 +646,9 @@ SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
     /* note that if this needs to allocate more space and run out of memory,
        we have no choice but to quietly drop the data and hope it works out
        later, but you probably have bigger problems in this case anyhow. */
-    SDL_WriteToDataQueue(device->buffer_queue, stream, len);
+    if (SDL_WriteToDataQueue(device->buffer_queue, stream, len) < 0) {
+        device->stats.overruns++;
+    }
 }
 
 int
@@ -624,6 +674,54 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     return rc;
 }
 
+void *
+SDL_ReserveQueuedAudio(SDL_AudioDeviceID devid, Uint32 *len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    size_t reserved;
+    void *retval;
+
+    if (!device) {
+        return NULL;  /* get_audio_device() will have set the error state */
+    } else if (device->iscapture) {
+        SDL_SetError("This is a capture device, queueing not allowed");
+        return NULL;
+    } else if (device->callbackspec.callback != SDL_BufferQueueDrainCallback) {
+        SDL_SetError("Audio device has a callback, queueing not allowed");
+        return NULL;
+    } else if (!len) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    }
+
+    reserved = *len;
+    current_audio.impl.LockDevice(device);
+    retval = SDL_ReserveWriteInDataQueue(device->buffer_queue, &reserved);
+    current_audio.impl.UnlockDevice(device);
+    *len = retval ? (Uint32) reserved : 0;
+    return retval;
+}
+
+int
+SDL_CommitQueuedAudio(SDL_AudioDeviceID devid, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    int rc;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (device->iscapture) {
+        return SDL_SetError("This is a capture device, queueing not allowed");
+    } else if (device->callbackspec.callback != SDL_BufferQueueDrainCallback) {
+        return SDL_SetError("Audio device has a callback, queueing not allowed");
+    }
+
+    current_audio.impl.LockDevice(device);
+    rc = SDL_CommitWriteToDataQueue(device->buffer_queue, len);
+    current_audio.impl.UnlockDevice(device);
+    return rc;
+}
+
 Uint32
 SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
 {
@@ -643,6 +741,45 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
     return rc;
 }
 
+const void *
+SDL_PeekQueuedAudio(SDL_AudioDeviceID devid, Uint32 *len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    const void *retval = NULL;
+    size_t avail = 0;
+
+    if (len && device && device->iscapture &&
+        (device->callbackspec.callback == SDL_BufferQueueFillCallback)) {
+        current_audio.impl.LockDevice(device);
+        retval = SDL_PeekPacketInDataQueue(device->buffer_queue, &avail);
+        current_audio.impl.UnlockDevice(device);
+    }
+
+    if (len) {
+        *len = (Uint32) SDL_min(avail, SDL_MAX_UINT32);
+    }
+    return retval;
+}
+
+Uint32
+SDL_ConsumeQueuedAudio(SDL_AudioDeviceID devid, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint32 rc;
+
+    if ( (len == 0) ||  /* nothing to do? */
+         (!device) ||  /* called with bogus device id */
+         (!device->iscapture) ||  /* playback devices can't dequeue */
+         (device->callbackspec.callback != SDL_BufferQueueFillCallback) ) { /* not set for queueing */
+        return 0;  /* just report zero bytes consumed. */
+    }
+
+    current_audio.impl.LockDevice(device);
+    rc = (Uint32) SDL_ConsumeFromDataQueue(device->buffer_queue, len);
+    current_audio.impl.UnlockDevice(device);
+    return rc;
+}
+
 Uint32
 SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
 {
@@ -686,6 +823,280 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
 }
 
 
+
+/* streams bound to a device... */
+
+static int
+prepare_stream_mixing(SDL_AudioDevice *device)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const int num_samples = spec->samples * spec->channels;
+    size_t buflen = num_samples * sizeof (float);
+
+    if (device->mix_buffer) {
+        return 0;  /* already set up. */
+    }
+
+    if ((SDL_BuildAudioCVT(&device->mix_to_float, spec->format, spec->channels, spec->freq,
+                           AUDIO_F32SYS, spec->channels, spec->freq) < 0) ||
+        (SDL_BuildAudioCVT(&device->mix_from_float, AUDIO_F32SYS, spec->channels, spec->freq,
+                           spec->format, spec->channels, spec->freq) < 0)) {
+        return -1;
+    }
+
+    /* the callback's data is converted to float in place in mix_buffer. */
+    if (device->mix_to_float.needed) {
+        buflen = SDL_max(buflen, (size_t) (spec->size * device->mix_to_float.len_mult));
+    }
+    device->mix_buffer = (float *) SDL_malloc(buflen);
+    device->mix_stream_buffer = (float *) SDL_malloc(num_samples * sizeof (float));
+    if (!device->mix_buffer || !device->mix_stream_buffer) {
+        SDL_free(device->mix_buffer);
+        SDL_free(device->mix_stream_buffer);
+        device->mix_buffer = device->mix_stream_buffer = NULL;
+        return SDL_OutOfMemory();
+    }
+    return 0;
+}
+
+/* this function always holds the mixer lock before being called. */
+static void
+mix_bound_streams(SDL_AudioDevice *device, Uint8 *data, const int len)
+{
+    const int num_samples = len / (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8);
+    const int floatlen = num_samples * (int) sizeof (float);
+    float *mix = NULL;
+    int i;
+
+    for (i = 0; i < device->num_bound_streams; i++) {
+        const SDL_BoundAudioStream *bound = &device->bound_streams[i];
+        const int got = SDL_AudioStreamGet(bound->stream, device->mix_stream_buffer, floatlen);
+        if ((got <= 0) || (bound->gain == 0.0f)) {
+            continue;
+        }
+
+        if (!mix) {  /* first stream with data, convert the callback's output to float. */
+            if (device->mix_to_float.needed) {
+                SDL_memcpy(device->mix_buffer, data, len);
+                device->mix_to_float.buf = (Uint8 *) device->mix_buffer;
+                device->mix_to_float.len = len;
+                SDL_ConvertAudio(&device->mix_to_float);
+                mix = device->mix_buffer;
+            } else {
+                mix = (float *) data;
+            }
+        }
+        SDL_MixFloat32(mix, device->mix_stream_buffer, got / (int) sizeof (float), bound->gain);
+    }
+
+    /* one conversion (and clamp) back to the callback's format for everything. */
+    if (mix && device->mix_from_float.needed) {
+        device->mix_from_float.buf = (Uint8 *) mix;
+        device->mix_from_float.len = floatlen;
+        SDL_ConvertAudio(&device->mix_from_float);
+        SDL_memcpy(data, mix, len);
+    }
+}
+
+/* Call this with the device locked. */
+static int
+add_bound_stream(SDL_AudioDevice *device, SDL_AudioStream *stream, float gain)
+{
+    if (device->num_bound_streams == device->max_bound_streams) {
+        const int newmax = device->max_bound_streams ? (device->max_bound_streams * 2) : 8;
+        void *ptr = SDL_realloc(device->bound_streams, newmax * sizeof (SDL_BoundAudioStream));
+        if (!ptr) {
+            return SDL_OutOfMemory();
+        }
+        device->bound_streams = (SDL_BoundAudioStream *) ptr;
+        device->max_bound_streams = newmax;
+    }
+    device->bound_streams[device->num_bound_streams].stream = stream;
+    device->bound_streams[device->num_bound_streams].gain = gain;
+    device->num_bound_streams++;
+    return 0;
+}
+
+int
+SDL_BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream, float gain)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int rate, i;
+    int retval = 0;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (device->iscapture) {
+        return SDL_SetError("This is a capture device, use SDL_NewCaptureAudioStream()");
+    }
+
+    SDL_GetAudioStreamOutputFormat(stream, &format, &channels, &rate);
+    if ((format != AUDIO_F32SYS) || (channels != device->callbackspec.channels) || (rate != device->callbackspec.freq)) {
+        return SDL_SetError("Audio stream must produce AUDIO_F32SYS at the device's channels and rate");
+    }
+
+    current_audio.impl.LockDevice(device);
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i].stream == stream) {
+            break;
+        }
+    }
+    if (i < device->num_bound_streams) {
+        device->bound_streams[i].gain = gain;
+    } else if (prepare_stream_mixing(device) < 0) {
+        retval = -1;
+    } else {
+        retval = add_bound_stream(device, stream, gain);
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
+}
+
+SDL_AudioStream *
+SDL_NewCaptureAudioStream(SDL_AudioDeviceID devid, const SDL_AudioFormat format,
+                          const Uint8 channels, const int rate, int len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioStream *stream;
+    int rc;
+
+    if (!device) {
+        return NULL;  /* get_audio_device() will have set the error state */
+    } else if (!device->iscapture) {
+        SDL_SetError("Not a capture device");
+        return NULL;
+    }
+
+    /* straight from what the device produces, not from the callback's format. */
+    stream = SDL_NewAudioStream(device->spec.format, device->spec.channels, device->spec.freq, format, channels, rate);
+    if (!stream) {
+        return NULL;
+    } else if (SDL_AudioStreamSetLockFree(stream, len) < 0) {
+        SDL_FreeAudioStream(stream);
+        return NULL;
+    }
+
+    current_audio.impl.LockDevice(device);
+    rc = add_bound_stream(device, stream, 1.0f);
+    current_audio.impl.UnlockDevice(device);
+
+    if (rc < 0) {
+        SDL_FreeAudioStream(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+void
+SDL_UnbindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    int i;
+
+    if (!device || !stream) {
+        return;  /* nothing to do. */
+    }
+
+    current_audio.impl.LockDevice(device);
+
+    /* the capture thread is filling this one without the lock; wait it out. */
+    while (device->pinned_stream == stream) {
+        current_audio.impl.UnlockDevice(device);
+        SDL_Delay(1);
+        current_audio.impl.LockDevice(device);
+    }
+
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i].stream == stream) {
+            device->num_bound_streams--;
+            SDL_memmove(&device->bound_streams[i], &device->bound_streams[i + 1],
+                        (device->num_bound_streams - i) * sizeof (SDL_BoundAudioStream));
+            break;
+        }
+    }
+    current_audio.impl.UnlockDevice(device);
+}
+
+Uint64
+SDL_GetAudioDevicePosition(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint64 retval;
+
+    if (!device) {
+        return 0;
+    }
+
+    current_audio.impl.LockDevice(device);
+    retval = device->frames_played;
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats, SDL_bool reset)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;
+    }
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    current_audio.impl.LockDevice(device);
+    *stats = device->stats;
+    if (reset) {
+        SDL_zero(device->stats);
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    if ((device->callbackspec.callback == SDL_BufferQueueDrainCallback) ||
+        (device->callbackspec.callback == SDL_BufferQueueFillCallback)) {
+        stats->queued_bytes = SDL_GetQueuedAudioSize(devid);
+    } else {
+        stats->queued_bytes = 0;
+    }
+    return 0;
+}
+
+
+/* Called with the mixer lock held, after the callback that started at start. */
+static void
+update_callback_stats(SDL_AudioDevice *device, const Uint64 start)
+{
+    SDL_AudioDeviceStats *stats = &device->stats;
+    const Uint64 period = device->stats_period_ticks;
+    const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    const Uint64 scaled = period ? ((elapsed << 5) / period) : 0;  /* in 1/32 buffers */
+    int bucket = 0;
+
+    while ((bucket < SDL_AUDIO_STATS_BUCKETS - 1) && (scaled >= (((Uint64) 1) << bucket))) {
+        bucket++;
+    }
+
+    stats->callbacks++;
+    stats->callback_histogram[bucket]++;
+    stats->callback_ticks += elapsed;
+    if (elapsed > stats->max_callback_ticks) {
+        stats->max_callback_ticks = elapsed;
+    }
+    if (elapsed > period) {
+        stats->deadline_misses++;
+    }
+    if (device->stats_last_start && ((start - device->stats_last_start) > stats->max_interval_ticks)) {
+        stats->max_interval_ticks = start - device->stats_last_start;
+    }
+    device->stats_last_start = start;
+}
+
 /* The general mixing thread function */
 static int SDLCALL
 SDL_RunAudio(void *devicep)
@@ -695,6 +1106,8 @@ SDL_RunAudio(void *devicep)
     SDL_AudioCallback callback = device->callbackspec.callback;
     int data_len = 0;
     Uint8 *data;
+    Uint64 conversion_ticks = 0;
+    Uint32 underruns = 0;
 
     SDL_assert(!device->iscapture);
 
@@ -738,22 +1151,46 @@ SDL_RunAudio(void *devicep)
 
         /* !!! FIXME: this should be LockDevice. */
         SDL_LockMutex(device->mixer_lock);
+        device->stats.conversion_ticks += conversion_ticks;  /* from the last iteration. */
+        device->stats.underruns += underruns;
+        conversion_ticks = 0;
+        underruns = 0;
         if (SDL_AtomicGet(&device->paused)) {
             SDL_memset(data, device->spec.silence, data_len);
+            device->stats_last_start = 0;
+        } else if (device->stream && (callback == SDL_BufferQueueDrainCallback) && (device->num_bound_streams == 0)) {
+            const Uint64 start = SDL_GetPerformanceCounter();
+            drain_buffer_queue_to_stream(device, data_len);
+            device->frames_played += device->callbackspec.samples;
+            update_callback_stats(device, start);
+            data = NULL;  /* already in the stream. */
         } else {
+            const Uint64 start = SDL_GetPerformanceCounter();
             callback(udata, data, data_len);
+            if (device->num_bound_streams > 0) {
+                mix_bound_streams(device, data, data_len);
+            }
+            device->frames_played += device->callbackspec.samples;
+            update_callback_stats(device, start);
         }
         SDL_UnlockMutex(device->mixer_lock);
 
         if (device->stream) {
+            Uint64 start = SDL_GetPerformanceCounter();
+
             /* Stream available audio to device, converting/resampling. */
             /* if this fails...oh well. We'll play silence here. */
-            SDL_AudioStreamPut(device->stream, data, data_len);
+            if (data != NULL) {
+                SDL_AudioStreamPut(device->stream, data, data_len);
+            }
+            conversion_ticks += SDL_GetPerformanceCounter() - start;
 
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
                 int got;
                 data = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                start = SDL_GetPerformanceCounter();
                 got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
+                conversion_ticks += SDL_GetPerformanceCounter() - start;
                 SDL_assert((got < 0) || (got == device->spec.size));
 
                 if (data == NULL) {  /* device is having issues... */
@@ -762,6 +1199,7 @@ SDL_RunAudio(void *devicep)
                 } else {
                     if (got != device->spec.size) {
                         SDL_memset(data, device->spec.silence, device->spec.size);
+                        underruns++;
                     }
                     current_audio.impl.PlayDevice(device);
                     current_audio.impl.WaitDevice(device);
@@ -788,18 +1226,144 @@ SDL_RunAudio(void *devicep)
     return 0;
 }
 
+/* Called with the mixer lock held. This also hands over the stats the
+   capture thread gathered while it didn't hold the lock. */
+static void
+run_capture_callback(SDL_AudioDevice *device, Uint8 *data, Uint64 *conversion_ticks,
+                     Uint32 *underruns, Uint32 *overruns)
+{
+    device->stats.conversion_ticks += *conversion_ticks;
+    device->stats.underruns += *underruns;
+    device->stats.overruns += *overruns;
+    *conversion_ticks = 0;
+    *underruns = *overruns = 0;
+
+    if (SDL_AtomicGet(&device->paused)) {
+        device->stats_last_start = 0;
+    } else {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        device->callbackspec.callback(device->callbackspec.userdata, data, device->callbackspec.size);
+        device->frames_played += device->callbackspec.samples;
+        update_callback_stats(device, start);
+    }
+}
+
+/* Read data_len bytes from the device, keeping whatever was read and filling
+   the rest with silence if it comes up short. Returns SDL_FALSE if it did. */
+static SDL_bool
+capture_from_device(SDL_AudioDevice *device, Uint8 *data, const int data_len)
+{
+    int still_need = data_len;
+    Uint8 *ptr = data;
+
+    /* We still read from the device when "paused" to keep the state sane,
+       and block when there isn't data so this thread isn't eating CPU.
+       But we don't process it further or call the app's callback. */
+
+    if (!SDL_AtomicGet(&device->enabled)) {
+        SDL_Delay((device->spec.samples * 1000) / device->spec.freq);  /* try to keep callback firing at normal pace. */
+    } else {
+        while (still_need > 0) {
+            const int rc = current_audio.impl.CaptureFromDevice(device, ptr, still_need);
+            SDL_assert(rc <= still_need);  /* device should not overflow buffer. :) */
+            if (rc > 0) {
+                still_need -= rc;
+                ptr += rc;
+            } else {  /* uhoh, device failed for some reason! */
+                SDL_OpenedAudioDeviceDisconnected(device);
+                break;
+            }
+        }
+    }
+
+    if (still_need > 0) {
+        SDL_memset(ptr, device->spec.silence, still_need);
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* Capture into the streams from SDL_NewCaptureAudioStream(), instead of
+   running the callback. The device is read without the mixer lock; it's only
+   held to hand the data to whatever streams are bound by then. Returns
+   SDL_FALSE if there turned out to be no streams after all. */
+static SDL_bool
+capture_to_bound_streams(SDL_AudioDevice *device, Uint64 *conversion_ticks,
+                         Uint32 *underruns, Uint32 *overruns)
+{
+    const int data_len = device->spec.size;
+    Uint8 *data = device->work_buffer;
+    SDL_AudioStream *pinned = NULL;
+    SDL_bool captured;
+    Uint64 start;
+    int i;
+
+    /* !!! FIXME: this should be LockDevice. */
+    SDL_LockMutex(device->mixer_lock);
+    if (device->num_bound_streams == 0) {
+        SDL_UnlockMutex(device->mixer_lock);
+        return SDL_FALSE;
+    }
+
+    /* A single stream can have the device write straight into its work
+       buffer and convert there; otherwise each one gets a copy. The stream
+       stays pinned, so SDL_UnbindAudioStream() waits for it. */
+    if (device->num_bound_streams == 1) {
+        Uint8 *direct = SDL_AudioStreamCaptureBuffer(device->bound_streams[0].stream, data_len);
+        if (direct) {
+            pinned = device->bound_streams[0].stream;
+            device->pinned_stream = pinned;
+            data = direct;
+        }
+    }
+    SDL_UnlockMutex(device->mixer_lock);
+
+    /* this blocks for up to a device period, so don't hold anything here. */
+    captured = capture_from_device(device, data, data_len);
+
+    SDL_LockMutex(device->mixer_lock);
+    if (!captured) {
+        (*underruns)++;
+    }
+
+    /* streams bound while we were reading copy out of the pinned stream's
+       buffer, so they go first; it converts in place. */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < device->num_bound_streams; i++) {
+        SDL_AudioStream *stream = device->bound_streams[i].stream;
+        if ((stream != pinned) && (SDL_AudioStreamCapture(stream, data, data_len) != 0)) {
+            (*overruns)++;  /* it didn't fit, or failed outright. */
+        }
+    }
+    if (pinned && (SDL_AudioStreamCapture(pinned, data, data_len) != 0)) {
+        (*overruns)++;
+    }
+    device->pinned_stream = NULL;
+    *conversion_ticks += SDL_GetPerformanceCounter() - start;
+
+    /* no callback is going to hand over the stats, so do it here. */
+    device->stats.conversion_ticks += *conversion_ticks;
+    device->stats.underruns += *underruns;
+    device->stats.overruns += *overruns;
+    *conversion_ticks = 0;
+    *underruns = *overruns = 0;
+    device->frames_played += device->spec.samples;
+    SDL_UnlockMutex(device->mixer_lock);
+
+    return SDL_TRUE;
+}
+
 /* !!! FIXME: this needs to deal with device spec changes. */
 /* The general capture thread function */
 static int SDLCALL
 SDL_CaptureAudio(void *devicep)
 {
     SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
-    const int silence = (int) device->spec.silence;
     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
     const int data_len = device->spec.size;
     Uint8 *data;
-    void *udata = device->callbackspec.userdata;
-    SDL_AudioCallback callback = device->callbackspec.callback;
+    Uint64 conversion_ticks = 0;
+    Uint32 underruns = 0, overruns = 0;
 
     SDL_assert(device->iscapture);
 
@@ -820,9 +1384,6 @@ SDL_CaptureAudio(void *devicep)
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
-        int still_need;
-        Uint8 *ptr;
-
         current_audio.impl.BeginLoopIteration(device);
 
         if (SDL_AtomicGet(&device->paused)) {
@@ -834,46 +1395,35 @@ SDL_CaptureAudio(void *devicep)
             continue;
         }
 
-        /* Fill the current buffer with sound */
-        still_need = data_len;
+        /* Streams from SDL_NewCaptureAudioStream() take the callback's place. */
+        if ((device->num_bound_streams > 0) &&
+            capture_to_bound_streams(device, &conversion_ticks, &underruns, &overruns)) {
+            continue;
+        }
 
         /* Use the work_buffer to hold data read from the device. */
         data = device->work_buffer;
         SDL_assert(data != NULL);
 
-        ptr = data;
-
-        /* We still read from the device when "paused" to keep the state sane,
-           and block when there isn't data so this thread isn't eating CPU.
-           But we don't process it further or call the app's callback. */
-
-        if (!SDL_AtomicGet(&device->enabled)) {
-            SDL_Delay(delay);  /* try to keep callback firing at normal pace. */
-        } else {
-            while (still_need > 0) {
-                const int rc = current_audio.impl.CaptureFromDevice(device, ptr, still_need);
-                SDL_assert(rc <= still_need);  /* device should not overflow buffer. :) */
-                if (rc > 0) {
-                    still_need -= rc;
-                    ptr += rc;
-                } else {  /* uhoh, device failed for some reason! */
-                    SDL_OpenedAudioDeviceDisconnected(device);
-                    break;
-                }
-            }
-        }
-
-        if (still_need > 0) {
-            /* Keep any data we already read, silence the rest. */
-            SDL_memset(ptr, silence, still_need);
+        /* Fill the current buffer with sound */
+        if (!capture_from_device(device, data, data_len)) {
+            underruns++;
         }
 
         if (device->stream) {
+            Uint64 start = SDL_GetPerformanceCounter();
+
             /* if this fails...oh well. */
-            SDL_AudioStreamPut(device->stream, data, data_len);
+            if (SDL_AudioStreamPut(device->stream, data, data_len) < 0) {
+                overruns++;
+            }
+            conversion_ticks += SDL_GetPerformanceCounter() - start;
 
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->callbackspec.size)) {
-                const int got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                int got;
+                start = SDL_GetPerformanceCounter();
+                got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                conversion_ticks += SDL_GetPerformanceCounter() - start;
                 SDL_assert((got < 0) || (got == device->callbackspec.size));
                 if (got != device->callbackspec.size) {
                     SDL_memset(device->work_buffer, device->spec.silence, device->callbackspec.size);
@@ -881,17 +1431,13 @@ SDL_CaptureAudio(void *devicep)
 
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
-                if (!SDL_AtomicGet(&device->paused)) {
-                    callback(udata, device->work_buffer, device->callbackspec.size);
-                }
+                run_capture_callback(device, device->work_buffer, &conversion_ticks, &underruns, &overruns);
                 SDL_UnlockMutex(device->mixer_lock);
             }
         } else {  /* feeding user callback directly without streaming. */
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
-            if (!SDL_AtomicGet(&device->paused)) {
-                callback(udata, data, device->callbackspec.size);
-            }
+            run_capture_callback(device, data, &conversion_ticks, &underruns, &overruns);
             SDL_UnlockMutex(device->mixer_lock);
         }
     }
@@ -999,6 +1545,8 @@ SDL_AudioInit(const char *driver_name)
 
     finish_audio_entry_points_init();
 
+    SDL_ChooseAudioMixers();
+
     /* Make sure we have a list of devices available at startup. */
     current_audio.impl.DetectDevices();
 
@@ -1141,6 +1689,9 @@ close_audio_device(SDL_AudioDevice * device)
 
     SDL_free(device->work_buffer);
     SDL_FreeAudioStream(device->stream);
+    SDL_free(device->bound_streams);
+    SDL_free(device->mix_buffer);
+    SDL_free(device->mix_stream_buffer);
 
     if (device->id > 0) {
         SDL_AudioDevice *opendev = open_devices[device->id - 1];
@@ -1430,6 +1981,9 @@ open_audio_device(const char *devname, int iscapture,
         device->callbackspec.userdata = device;
     }
 
+    device->stats_period_ticks = (SDL_GetPerformanceFrequency() * device->callbackspec.samples) / device->callbackspec.freq;
+    device->stats_starved = SDL_TRUE;  /* don't count an underrun before anything was queued. */
+
     /* Allocate a scratch audio buffer */
     device->work_buffer_len = build_stream ? device->callbackspec.size : 0;
     if (device->spec.size > device->work_buffer_len) {
@@ -69,6 +69,26 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S16;
 extern SDL_AudioFilter SDL_Convert_F32_to_U16;
 extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 
+/* Choose the mixing functions below and the SIMD paths of SDL_MixAudioFormat() */
+extern void SDL_ChooseAudioMixers(void);
+
+/* Add num_samples floats from src, scaled by gain, to dst without clamping.
+   This gets set during SDL_ChooseAudioMixers() to a SIMD implementation. */
+typedef void (SDLCALL *SDL_MixFloat32Func) (float *dst, const float *src, int num_samples, float gain);
+extern SDL_MixFloat32Func SDL_MixFloat32;
+
+/* Get the format SDL_AudioStreamGet() produces */
+extern void SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate);
+
+/* Feed a stream from SDL_NewCaptureAudioStream(). SDL_AudioStreamCaptureBuffer()
+   returns where the device can write len bytes of input for the stream to
+   convert in place, or NULL if it can't take them that way right now.
+   SDL_AudioStreamCapture() then converts len bytes from that pointer (or from
+   any other buffer) into the stream, and returns how many bytes of converted
+   audio didn't fit and were dropped, or -1 on error. */
+extern Uint8 *SDL_AudioStreamCaptureBuffer(SDL_AudioStream *stream, int len);
+extern int SDL_AudioStreamCapture(SDL_AudioStream *stream, const void *buf, int len);
+
 /* You need to call SDL_PrepareResampleFilter() before using the internal resampler.
    SDL_AudioQuit() calls SDL_FreeResamplerFilter(), you should never call it yourself. */
 extern int SDL_PrepareResampleFilter(void);
@@ -36,10 +36,18 @@
 
 #define DEBUG_AUDIOSTREAM 0
 
+#ifdef __SSE__
+#define HAVE_SSE_INTRINSICS 1
+#endif
+
 #ifdef __SSE3__
 #define HAVE_SSE3_INTRINSICS 1
 #endif
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 #if HAVE_SSE3_INTRINSICS
 /* Convert from stereo to mono. Average left and right. */
 static void SDLCALL
@@ -205,6 +213,102 @@ SDL_Convert51ToQuad(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 
+#if HAVE_SSE_INTRINSICS
+/* The downmixes above divide every output sample; these do the same math on
+   four samples at a time. The upmixes are mostly copies and are left scalar. */
+static void SDLCALL
+SDL_Convert51ToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 divisor = _mm_set1_ps(2.5f);
+    const __m128 zero = _mm_setzero_ps();
+    int i = cvt->len_cvt / (sizeof (float) * 6);
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* two frames at a time: [L0 R0 L1 R1] */
+    for (; i >= 2; i -= 2, src += 12, dst += 4) {
+        const __m128 front0 = _mm_loadu_ps(src);
+        const __m128 front1 = _mm_loadu_ps(src + 6);
+        const __m128 back = _mm_movelh_ps(_mm_loadl_pi(zero, (const __m64 *) (src + 4)),
+                                          _mm_loadl_pi(zero, (const __m64 *) (src + 10)));
+        const __m128 center = _mm_mul_ps(_mm_shuffle_ps(front0, front1, _MM_SHUFFLE(2, 2, 2, 2)), half);
+        const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_movelh_ps(front0, front1), center), back);
+        _mm_storeu_ps(dst, _mm_div_ps(sum, divisor));
+    }
+
+    if (i) {
+        const float front_center_distributed = src[2] * 0.5f;
+        dst[0] = (src[0] + front_center_distributed + src[4]) / 2.5f;  /* left */
+        dst[1] = (src[1] + front_center_distributed + src[5]) / 2.5f;  /* right */
+    }
+
+    cvt->len_cvt /= 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To51_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 divisor = _mm_set1_ps(1.5f);
+    const __m128 zero = _mm_setzero_ps();
+    int i;
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 8); i; --i, src += 8, dst += 6) {
+        const __m128 front = _mm_loadu_ps(src);  /* FL FR FC LFE */
+        const __m128 back = _mm_loadu_ps(src + 4);  /* BL BR SL SR */
+        const __m128 sides = _mm_mul_ps(_mm_movehl_ps(zero, back), half);  /* SL SR 0 0 */
+        _mm_storeu_ps(dst, _mm_div_ps(_mm_add_ps(front, sides), divisor));
+        _mm_storel_pi((__m64 *) (dst + 4), _mm_div_ps(_mm_add_ps(back, sides), divisor));
+    }
+
+    cvt->len_cvt /= 8;
+    cvt->len_cvt *= 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToQuad_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 divisor = _mm_set1_ps(1.5f);
+    const __m128 zero = _mm_setzero_ps();
+    int i;
+
+    LOG_DEBUG_CONVERT("5.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (i = cvt->len_cvt / (sizeof (float) * 6); i; --i, src += 6, dst += 4) {
+        const __m128 front = _mm_loadu_ps(src);  /* FL FR FC LFE */
+        const __m128 back = _mm_loadl_pi(zero, (const __m64 *) (src + 4));  /* BL BR 0 0 */
+        const __m128 center = _mm_mul_ps(_mm_shuffle_ps(front, zero, _MM_SHUFFLE(0, 0, 2, 2)), half);  /* FC FC 0 0 */
+        _mm_storeu_ps(dst, _mm_div_ps(_mm_add_ps(_mm_movelh_ps(front, back), center), divisor));
+    }
+
+    cvt->len_cvt /= 6;
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+#endif
+
+
 /* Upmix mono to stereo (by duplication) */
 static void SDLCALL
 SDL_ConvertMonoToStereo(SDL_AudioCVT * cvt, SDL_AudioFormat format)
@@ -431,6 +535,35 @@ static SDL_SpinLock ResampleFilterSpinlock = 0;
 static float *ResamplerFilter = NULL;
 static float *ResamplerFilterDifference = NULL;
 
+/* Each output frame is the dot product of RESAMPLER_TAPS input frames around its
+   source position with the taps for its phase (where it falls between two input
+   frames): RESAMPLER_ZERO_CROSSINGS + 1 frames up to the position, then as many
+   after it. */
+#define RESAMPLER_TAPS (2 * (RESAMPLER_ZERO_CROSSINGS + 1))
+
+/* Rate pairs with at most this many phases (after reducing the ratio) get their
+   taps tabulated; anything else computes them per output frame. Tables are
+   looked up when an SDL_AudioStream or SDL_AudioCVT is built, never while
+   converting. A stream holds its table until it is freed, and the least
+   recently used one that no stream holds is replaced when another pair needs
+   a slot. An SDL_AudioCVT can't be freed, so a table it uses is kept until
+   SDL_FreeResampleFilter(). */
+#define RESAMPLER_MAX_PHASES 1024
+#define RESAMPLER_MAX_BANKS 8
+
+typedef struct SDL_ResamplerBank
+{
+    int inrate;
+    int outrate;
+    int refcount;
+    Uint32 lastused;
+    SDL_atomic_t kept;  /* set once an SDL_AudioCVT uses it; the fields above don't change after that. */
+    float *taps;  /* outrate phases, RESAMPLER_TAPS each. */
+} SDL_ResamplerBank;
+
+static SDL_ResamplerBank ResamplerBanks[RESAMPLER_MAX_BANKS];
+static Uint32 ResamplerBankClock = 0;
+
 int
 SDL_PrepareResampleFilter(void)
 {
@@ -463,10 +596,17 @@ SDL_PrepareResampleFilter(void)
 void
 SDL_FreeResampleFilter(void)
 {
+    int i;
+
     SDL_free(ResamplerFilter);
     SDL_free(ResamplerFilterDifference);
     ResamplerFilter = NULL;
     ResamplerFilterDifference = NULL;
+
+    for (i = 0; i < RESAMPLER_MAX_BANKS; i++) {
+        SDL_free(ResamplerBanks[i].taps);
+    }
+    SDL_zero(ResamplerBanks);
 }
 
 static int
@@ -480,15 +620,451 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
-/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
+/* Fill in the taps for an output frame that falls (interpolation) of the way
+   from one input frame to the next. Each tap is the filter table linearly
+   interpolated at the tap's exact distance from the output frame. (Before the
+   polyphase resampler, the table difference was scaled by the whole
+   interpolation instead of the fraction between two table entries, which put
+   each tap off by up to one table step. For full scale input, output differs
+   from that by up to about 0.004; the filter itself is unchanged.) */
+static void
+ResamplerTaps(const double interpolation, float *taps)
+{
+    const double position1 = interpolation * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const int filterindex1 = (int) position1;
+    const float frac1 = (float) (position1 - filterindex1);
+    const double position2 = (1.0 - interpolation) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const int filterindex2 = (int) position2;
+    const float frac2 = (float) (position2 - filterindex2);
+    int j;
+
+    /* left wing runs backwards from the source position, right wing forwards from the frame after it. */
+    for (j = 0; j <= RESAMPLER_ZERO_CROSSINGS; j++) {
+        const int index1 = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        const int index2 = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        taps[RESAMPLER_ZERO_CROSSINGS - j] = (index1 < RESAMPLER_FILTER_SIZE) ? (ResamplerFilter[index1] + (frac1 * ResamplerFilterDifference[index1])) : 0.0f;
+        taps[RESAMPLER_ZERO_CROSSINGS + 1 + j] = (index2 < RESAMPLER_FILTER_SIZE) ? (ResamplerFilter[index2] + (frac2 * ResamplerFilterDifference[index2])) : 0.0f;
+    }
+}
+
+static void
+ResamplerBankTaps(const int outrate, float *taps)
+{
+    int i;
+
+    for (i = 0; i < outrate; i++) {
+        ResamplerTaps(((double) i) / ((double) outrate), &taps[i * RESAMPLER_TAPS]);
+    }
+}
+
+static int
+ResamplerGCD(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Find or fill a cache slot for this rate pair and take a reference to it.
+   Returns NULL if the ratio has too many phases to tabulate, or every slot is
+   in use. Call with ResampleFilterSpinlock held. */
+static SDL_ResamplerBank *
+AcquireResamplerBankLocked(const int inrate, const int outrate)
+{
+    const int gcd = ResamplerGCD(inrate, outrate);
+    const int phaseinrate = inrate / gcd;
+    const int phaseoutrate = outrate / gcd;
+    SDL_ResamplerBank *bank = NULL;
+    int i;
+
+    if (phaseoutrate > RESAMPLER_MAX_PHASES) {
+        return NULL;
+    }
+
+    for (i = 0; i < RESAMPLER_MAX_BANKS; i++) {
+        SDL_ResamplerBank *entry = &ResamplerBanks[i];
+        if (entry->taps && (entry->inrate == phaseinrate) && (entry->outrate == phaseoutrate)) {
+            bank = entry;
+            break;
+        } else if (entry->refcount == 0) {
+            /* empty slots sort first, then by age */
+            if (!bank || (bank->taps && (!entry->taps || (entry->lastused < bank->lastused)))) {
+                bank = entry;
+            }
+        }
+    }
+
+    if (bank && (!bank->taps || (bank->inrate != phaseinrate) || (bank->outrate != phaseoutrate))) {
+        float *taps = (float *) SDL_malloc(phaseoutrate * RESAMPLER_TAPS * sizeof (float));
+        if (!taps) {
+            return NULL;
+        }
+        ResamplerBankTaps(phaseoutrate, taps);
+        SDL_free(bank->taps);
+        bank->inrate = phaseinrate;
+        bank->outrate = phaseoutrate;
+        bank->taps = taps;
+    }
+
+    if (bank) {
+        bank->refcount++;
+        bank->lastused = ++ResamplerBankClock;
+    }
+    return bank;
+}
+
+/* Get the taps for an SDL_AudioStream resampling from inrate to outrate. If
+   every cached table is in use, the stream gets one of its own, and (*owned)
+   is set. Returns NULL if the taps have to be computed per frame. Pass the
+   result to ReleaseResamplerBank() when the stream goes away. */
+static float *
+AcquireResamplerBank(const int inrate, const int outrate, SDL_bool *owned)
+{
+    const int gcd = ResamplerGCD(inrate, outrate);
+    const int phaseoutrate = outrate / gcd;
+    SDL_ResamplerBank *bank;
+    float *taps = NULL;
+
+    *owned = SDL_FALSE;
+    if (phaseoutrate > RESAMPLER_MAX_PHASES) {
+        return NULL;
+    }
+
+    SDL_AtomicLock(&ResampleFilterSpinlock);
+    bank = AcquireResamplerBankLocked(inrate, outrate);
+    if (bank) {
+        taps = bank->taps;
+    }
+    SDL_AtomicUnlock(&ResampleFilterSpinlock);
+
+    if (!bank) {
+        taps = (float *) SDL_malloc(phaseoutrate * RESAMPLER_TAPS * sizeof (float));
+        if (taps) {
+            ResamplerBankTaps(phaseoutrate, taps);
+            *owned = SDL_TRUE;
+        }
+    }
+    return taps;
+}
+
+static void
+ReleaseResamplerBank(float *taps, const SDL_bool owned)
+{
+    int i;
+
+    if (owned) {
+        SDL_free(taps);
+    } else if (taps) {
+        SDL_AtomicLock(&ResampleFilterSpinlock);
+        for (i = 0; i < RESAMPLER_MAX_BANKS; i++) {
+            if (ResamplerBanks[i].taps == taps) {
+                ResamplerBanks[i].refcount--;
+                break;
+            }
+        }
+        SDL_AtomicUnlock(&ResampleFilterSpinlock);
+    }
+}
+
+/* Make sure an SDL_AudioCVT resampling from inrate to outrate will find its
+   taps with FindKeptResamplerBank(). The slot keeps its reference for good. */
+static void
+KeepResamplerBank(const int inrate, const int outrate)
+{
+    SDL_ResamplerBank *bank;
+
+    SDL_AtomicLock(&ResampleFilterSpinlock);
+    bank = AcquireResamplerBankLocked(inrate, outrate);
+    if (bank) {
+        if (SDL_AtomicGet(&bank->kept)) {
+            bank->refcount--;  /* already holding one for good. */
+        } else {
+            SDL_AtomicSet(&bank->kept, 1);
+        }
+    }
+    SDL_AtomicUnlock(&ResampleFilterSpinlock);
+}
+
+/* Returns the taps kept for this reduced rate pair, or NULL to compute them
+   per frame. This doesn't lock: kept slots don't change until
+   SDL_FreeResampleFilter(), and the others aren't looked at. */
+static const float *
+FindKeptResamplerBank(const int phaseinrate, const int phaseoutrate)
+{
+    int i;
+
+    for (i = 0; i < RESAMPLER_MAX_BANKS; i++) {
+        const SDL_ResamplerBank *entry = &ResamplerBanks[i];
+        if (SDL_AtomicGet((SDL_atomic_t *) &entry->kept) && (entry->inrate == phaseinrate) && (entry->outrate == phaseoutrate)) {
+            return entry->taps;
+        }
+    }
+    return NULL;
+}
+
+/* Compute one output frame from the RESAMPLER_TAPS input frames starting at src. */
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const float *taps, const float *src, float *dst);
+
+static SDL_INLINE void
+ResampleChannels_Scalar(int chan, const int chans, const float *taps, const float *src, float *dst)
+{
+    int j;
+
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (j = 0; j < RESAMPLER_TAPS; j++) {
+            outsample += src[(j * chans) + chan] * taps[j];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+static void
+SDL_ResampleFrame_Scalar(const int chans, const float *taps, const float *src, float *dst)
+{
+    ResampleChannels_Scalar(0, chans, taps, src, dst);
+}
+
+#if HAVE_SSE_INTRINSICS
+static void
+SDL_ResampleFrame_Mono_SSE(const int chans, const float *taps, const float *src, float *dst)
+{
+    __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(taps));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_loadu_ps(taps + 4)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 8), _mm_loadu_ps(taps + 8)));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    _mm_store_ss(dst, sum);
+}
+
+static void
+SDL_ResampleFrame_Stereo_SSE(const int chans, const float *taps, const float *src, float *dst)
+{
+    __m128 sum = _mm_setzero_ps();
+    int j;
+
+    /* two frames per vector, so each tap is used twice in a row. */
+    for (j = 0; j < RESAMPLER_TAPS; j += 4) {
+        const __m128 t = _mm_loadu_ps(taps + j);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (j * 2)), _mm_unpacklo_ps(t, t)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (j * 2) + 4), _mm_unpackhi_ps(t, t)));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi((__m64 *) dst, sum);
+}
+
+static void
+SDL_ResampleFrame_SSE(const int chans, const float *taps, const float *src, float *dst)
+{
+    int chan, j;
+
+    for (chan = 0; chan < (chans & ~3); chan += 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src + chan), _mm_set1_ps(taps[0]));
+        for (j = 1; j < RESAMPLER_TAPS; j++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (j * chans) + chan), _mm_set1_ps(taps[j])));
+        }
+        _mm_storeu_ps(dst + chan, sum);
+    }
+    ResampleChannels_Scalar(chan, chans, taps, src, dst);
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_ResampleFrame_Stereo_AVX2(const int chans, const float *taps, const float *src, float *dst)
+{
+    const __m256i pairs = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    __m256 sum = _mm256_setzero_ps();
+    __m128 sum128;
+    int j;
+
+    for (j = 0; j < RESAMPLER_TAPS; j += 4) {
+        const __m256 t = _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_loadu_ps(taps + j)), pairs);
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src + (j * 2)), t));
+    }
+    sum128 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    sum128 = _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
+    _mm_storel_pi((__m64 *) dst, sum128);
+}
+
+static void SDL_TARGETING("avx2")
+SDL_ResampleFrame_AVX2(const int chans, const float *taps, const float *src, float *dst)
+{
+    int chan, j;
+
+    for (chan = 0; chan < (chans & ~7); chan += 8) {
+        __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(src + chan), _mm256_set1_ps(taps[0]));
+        for (j = 1; j < RESAMPLER_TAPS; j++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src + (j * chans) + chan), _mm256_set1_ps(taps[j])));
+        }
+        _mm256_storeu_ps(dst + chan, sum);
+    }
+    for (; chan < (chans & ~3); chan += 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src + chan), _mm_set1_ps(taps[0]));
+        for (j = 1; j < RESAMPLER_TAPS; j++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (j * chans) + chan), _mm_set1_ps(taps[j])));
+        }
+        _mm_storeu_ps(dst + chan, sum);
+    }
+    ResampleChannels_Scalar(chan, chans, taps, src, dst);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_ResampleFrame_Mono_NEON(const int chans, const float *taps, const float *src, float *dst)
+{
+    float32x4_t sum = vmulq_f32(vld1q_f32(src), vld1q_f32(taps));
+    float32x2_t sum2;
+    sum = vmlaq_f32(sum, vld1q_f32(src + 4), vld1q_f32(taps + 4));
+    sum = vmlaq_f32(sum, vld1q_f32(src + 8), vld1q_f32(taps + 8));
+    sum2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    sum2 = vpadd_f32(sum2, sum2);
+    vst1_lane_f32(dst, sum2, 0);
+}
+
+static void
+SDL_ResampleFrame_Stereo_NEON(const int chans, const float *taps, const float *src, float *dst)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    int j;
+
+    for (j = 0; j < RESAMPLER_TAPS; j += 2) {
+        const float32x4_t t = vcombine_f32(vdup_n_f32(taps[j]), vdup_n_f32(taps[j + 1]));
+        sum = vmlaq_f32(sum, vld1q_f32(src + (j * 2)), t);
+    }
+    vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+}
+
+static void
+SDL_ResampleFrame_NEON(const int chans, const float *taps, const float *src, float *dst)
+{
+    int chan, j;
+
+    for (chan = 0; chan < (chans & ~3); chan += 4) {
+        float32x4_t sum = vmulq_n_f32(vld1q_f32(src + chan), taps[0]);
+        for (j = 1; j < RESAMPLER_TAPS; j++) {
+            sum = vmlaq_n_f32(sum, vld1q_f32(src + (j * chans) + chan), taps[j]);
+        }
+        vst1q_f32(dst + chan, sum);
+    }
+    ResampleChannels_Scalar(chan, chans, taps, src, dst);
+}
+#endif
+
+static SDL_ResampleFrameFunc
+ChooseResampleFrameFunc(const int chans)
+{
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        if (chans == 2) {
+            return SDL_ResampleFrame_Stereo_AVX2;
+        } else if (chans >= 4) {
+            return SDL_ResampleFrame_AVX2;
+        }
+    }
+#endif
+#if HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        if (chans == 1) {
+            return SDL_ResampleFrame_Mono_SSE;
+        } else if (chans == 2) {
+            return SDL_ResampleFrame_Stereo_SSE;
+        } else if (chans >= 4) {
+            return SDL_ResampleFrame_SSE;
+        }
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        if (chans == 1) {
+            return SDL_ResampleFrame_Mono_NEON;
+        } else if (chans == 2) {
+            return SDL_ResampleFrame_Stereo_NEON;
+        } else if (chans >= 4) {
+            return SDL_ResampleFrame_NEON;
+        }
+    }
+#endif
+    return SDL_ResampleFrame_Scalar;
+}
+
+/* Produce output frames [i, end). Every source frame they touch has to be in
+   src, whose first frame is input frame srcfirst (which may be negative). */
+static void
+SDL_ResampleSpan(const SDL_ResampleFrameFunc resample_frame, const int chans,
+                 const int inrate, const int outrate, const float *bank,
+                 const float *src, const int srcfirst,
+                 int i, const int end, float *dst)
+{
+    const Sint64 position = ((Sint64) i) * inrate;
+    const int step = inrate / outrate;
+    const int phasestep = inrate % outrate;
+    int srcindex = (int) (position / outrate);
+    int phase = (int) (position % outrate);
+    float taps[RESAMPLER_TAPS];
+
+    for (dst += i * chans; i < end; i++, dst += chans) {
+        const float *window = src + ((srcindex - RESAMPLER_ZERO_CROSSINGS - srcfirst) * chans);
+        if (bank) {
+            resample_frame(chans, &bank[phase * RESAMPLER_TAPS], window, dst);
+        } else {
+            ResamplerTaps(((double) phase) / ((double) outrate), taps);
+            resample_frame(chans, taps, window, dst);
+        }
+
+        srcindex += step;
+        phase += phasestep;
+        if (phase >= outrate) {
+            phase -= outrate;
+            srcindex++;
+        }
+    }
+}
+
+/* Copy input frames [first, first + count) into dst, pulling from the padding past either end. */
+static void
+ResamplerGatherFrames(const int chans, const float *lpadding, const int paddinglen,
+                      const float *inbuf, const int inframes, const float *rpadding,
+                      const int first, const int count, float *dst)
+{
+    const int framelen = chans * (int)sizeof (float);
+    int srcframe;
+
+    for (srcframe = first; srcframe < first + count; srcframe++, dst += chans) {
+        if (srcframe < 0) {
+            SDL_memcpy(dst, &lpadding[(paddinglen + srcframe) * chans], framelen);
+        } else if (srcframe < inframes) {
+            SDL_memcpy(dst, &inbuf[srcframe * chans], framelen);
+        } else {
+            SDL_memcpy(dst, &rpadding[(srcframe - inframes) * chans], framelen);
+        }
+    }
+}
+
+/* Frames that are gathered into a temporary window at each end of the input:
+   sources before RESAMPLER_ZERO_CROSSINGS reach into lpadding, and sources at or
+   after (inframes - RESAMPLER_ZERO_CROSSINGS - 1) reach into rpadding. */
+#define RESAMPLER_HEAD_FIRST (-RESAMPLER_ZERO_CROSSINGS)
+#define RESAMPLER_HEAD_FRAMES ((RESAMPLER_ZERO_CROSSINGS * 3) + 1)
+#define RESAMPLER_TAIL_FIRST(inframes) ((inframes) - (RESAMPLER_ZERO_CROSSINGS * 2) - 1)
+#define RESAMPLER_TAIL_FRAMES ((RESAMPLER_ZERO_CROSSINGS * 3) + 3)
+
+/* The resamplers gather edge frames into a caller supplied buffer of
+   (RESAMPLER_EDGE_FRAMES * chans) floats. */
+#define RESAMPLER_EDGE_FRAMES SDL_max(RESAMPLER_TAIL_FRAMES, RESAMPLER_TAPS)
+
+/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes.
+   bank is the taps from AcquireResamplerBank() or FindKeptResamplerBank(), or NULL to compute them per frame. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+SDL_ResampleAudio(const int chans, const int inrate, const int outrate, const float *bank,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
-                        float *outbuf, const int outbuflen)
+                        float *outbuf, const int outbuflen, float *edge)
 {
-    const double finrate = (double) inrate;
-    const double outtimeincr = 1.0 / ((float) outrate);
     const double  ratio = ((float) outrate) / ((float) inrate);
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof (float);
@@ -496,43 +1072,70 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
-    float *dst = outbuf;
-    double outtime = 0.0;
-    int i, j, chan;
-
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const double intime = ((double) srcindex) / finrate;
-        const double innexttime = ((double) (srcindex + 1)) / finrate;
-        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const double interpolation2 = 1.0 - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
-
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            /* !!! FIXME: do both wings in one loop */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
+    const int gcd = ResamplerGCD(inrate, outrate);
+    const int phaseinrate = inrate / gcd;
+    const int phaseoutrate = outrate / gcd;
+    const SDL_ResampleFrameFunc resample_frame = ChooseResampleFrameFunc(chans);
+    const int tailstart = SDL_max(RESAMPLER_ZERO_CROSSINGS, inframes - RESAMPLER_ZERO_CROSSINGS - 1);
+    /* first output frames whose source position reaches RESAMPLER_ZERO_CROSSINGS and tailstart. */
+    const int middle = (int) SDL_min((((Sint64) RESAMPLER_ZERO_CROSSINGS * phaseoutrate) + phaseinrate - 1) / phaseinrate, outframes);
+    const int tail = (int) SDL_min((((Sint64) tailstart * phaseoutrate) + phaseinrate - 1) / phaseinrate, outframes);
 
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * ResamplerFilterDifference[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
-            *(dst++) = outsample;
+    if (middle > 0) {
+        ResamplerGatherFrames(chans, lpadding, paddinglen, inbuf, inframes, rpadding, RESAMPLER_HEAD_FIRST, RESAMPLER_HEAD_FRAMES, edge);
+        SDL_ResampleSpan(resample_frame, chans, phaseinrate, phaseoutrate, bank, edge, RESAMPLER_HEAD_FIRST, 0, middle, outbuf);
+    }
+
+    SDL_ResampleSpan(resample_frame, chans, phaseinrate, phaseoutrate, bank, inbuf, 0, middle, tail, outbuf);
+
+    if (tail < outframes) {
+        ResamplerGatherFrames(chans, lpadding, paddinglen, inbuf, inframes, rpadding, RESAMPLER_TAIL_FIRST(inframes), RESAMPLER_TAIL_FRAMES, edge);
+        SDL_ResampleSpan(resample_frame, chans, phaseinrate, phaseoutrate, bank, edge, RESAMPLER_TAIL_FIRST(inframes), tail, outframes, outbuf);
+    }
+
+    return outframes * chans * sizeof (float);
+}
+
+/* Like SDL_ResampleAudio(), but for a ratio that can change between calls.
+   Output frames are (*step) input frames apart and the first one falls at
+   (*position); the step glides to (target) across this input so a change is
+   never heard as a jump in pitch. Where the next output frame falls, relative
+   to the next input, goes back in (*position). */
+static int
+SDL_ResampleAudioVariable(const int chans, const int paddinglen,
+                          const float *lpadding, const float *rpadding,
+                          const float *inbuf, const int inbuflen,
+                          float *outbuf, const int outbuflen, float *edge,
+                          double *position, double *step, const double target)
+{
+    const int framelen = chans * (int)sizeof (float);
+    const int inframes = inbuflen / framelen;
+    const int maxoutframes = outbuflen / framelen;
+    const SDL_ResampleFrameFunc resample_frame = ChooseResampleFrameFunc(chans);
+    const double start = *step;
+    const double slope = inframes ? ((target - start) / inframes) : 0.0;
+    double pos = *position;
+    int outframes = 0;
+    float taps[RESAMPLER_TAPS];
+
+    while ((pos < inframes) && (outframes < maxoutframes)) {
+        const int srcindex = (int) pos;
+        const int first = srcindex - RESAMPLER_ZERO_CROSSINGS;
+        const float *window = &inbuf[first * chans];
+
+        if ((first < 0) || ((first + RESAMPLER_TAPS) > inframes)) {
+            ResamplerGatherFrames(chans, lpadding, paddinglen, inbuf, inframes, rpadding, first, RESAMPLER_TAPS, edge);
+            window = edge;
         }
 
-        outtime += outtimeincr;
+        ResamplerTaps(pos - srcindex, taps);
+        resample_frame(chans, taps, window, &outbuf[outframes * chans]);
+        outframes++;
+        pos += start + (slope * pos);
     }
 
+    *position = SDL_max(pos - inframes, 0.0);
+    *step = target;
     return outframes * chans * sizeof (float);
 }
 
@@ -720,17 +1323,21 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     const int dstlen = (cvt->len * cvt->len_mult) - srclen;
     const int paddingsamples = (ResamplerPadding(inrate, outrate) * chans);
     float *padding;
+    int gcd;
 
     SDL_assert(format == AUDIO_F32SYS);
 
-    /* we keep no streaming state here, so pad with silence on both ends. */
-    padding = (float *) SDL_calloc(paddingsamples ? paddingsamples : 1, sizeof (float));
+    /* we keep no streaming state here, so pad with silence on both ends. The
+       edge scratch goes after the padding. */
+    padding = (float *) SDL_calloc(paddingsamples + (RESAMPLER_EDGE_FRAMES * chans), sizeof (float));
     if (!padding) {
         SDL_OutOfMemory();
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    gcd = ResamplerGCD(inrate, outrate);
+    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, FindKeptResamplerBank(inrate / gcd, outrate / gcd),
+                                     padding, padding, src, srclen, dst, dstlen, padding + paddingsamples);
 
     SDL_free(padding);
 
@@ -804,6 +1411,7 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, const int dst_channels,
     }
     cvt->filters[SDL_AUDIOCVT_MAX_FILTERS-1] = (SDL_AudioFilter) (size_t) src_rate;
     cvt->filters[SDL_AUDIOCVT_MAX_FILTERS] = (SDL_AudioFilter) (size_t) dst_rate;
+    KeepResamplerBank(src_rate, dst_rate);
 
     if (src_rate < dst_rate) {
         const double mult = ((double) dst_rate) / ((double) src_rate);
@@ -863,92 +1471,10 @@ SDL_SupportedChannelCount(const int channels)
 }
 
 
-/* Creates a set of audio filters to convert from one format to another.
-   Returns 0 if no conversion is needed, 1 if the audio filter is set up,
-   or -1 if an error like invalid parameter, unsupported format, etc. occurred.
-*/
-
-int
-SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
-                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
-                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+/* Adds the filters that change the channel count of AUDIO_F32SYS data. */
+static int
+SDL_BuildAudioChannelCVT(SDL_AudioCVT *cvt, int src_channels, const int dst_channels)
 {
-    /* Sanity check target pointer */
-    if (cvt == NULL) {
-        return SDL_InvalidParamError("cvt");
-    }
-
-    /* Make sure we zero out the audio conversion before error checking */
-    SDL_zerop(cvt);
-
-    if (!SDL_SupportedAudioFormat(src_fmt)) {
-        return SDL_SetError("Invalid source format");
-    } else if (!SDL_SupportedAudioFormat(dst_fmt)) {
-        return SDL_SetError("Invalid destination format");
-    } else if (!SDL_SupportedChannelCount(src_channels)) {
-        return SDL_SetError("Invalid source channels");
-    } else if (!SDL_SupportedChannelCount(dst_channels)) {
-        return SDL_SetError("Invalid destination channels");
-    } else if (src_rate == 0) {
-        return SDL_SetError("Source rate is zero");
-    } else if (dst_rate == 0) {
-        return SDL_SetError("Destination rate is zero");
-    }
-
-#if DEBUG_CONVERT
-    printf("Build format %04x->%04x, channels %u->%u, rate %d->%d\n",
-           src_fmt, dst_fmt, src_channels, dst_channels, src_rate, dst_rate);
-#endif
-
-    /* Start off with no conversion necessary */
-    cvt->src_format = src_fmt;
-    cvt->dst_format = dst_fmt;
-    cvt->needed = 0;
-    cvt->filter_index = 0;
-    SDL_zero(cvt->filters);
-    cvt->len_mult = 1;
-    cvt->len_ratio = 1.0;
-    cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
-
-    /* Make sure we've chosen audio conversion functions (MMX, scalar, etc.) */
-    SDL_ChooseAudioConverters();
-
-    /* Type conversion goes like this now:
-        - byteswap to CPU native format first if necessary.
-        - convert to native Float32 if necessary.
-        - resample and change channel count if necessary.
-        - convert back to native format.
-        - byteswap back to foreign format if necessary.
-
-       The expectation is we can process data faster in float32
-       (possibly with SIMD), and making several passes over the same
-       buffer is likely to be CPU cache-friendly, avoiding the
-       biggest performance hit in modern times. Previously we had
-       (script-generated) custom converters for every data type and
-       it was a bloat on SDL compile times and final library size. */
-
-    /* see if we can skip float conversion entirely. */
-    if (src_rate == dst_rate && src_channels == dst_channels) {
-        if (src_fmt == dst_fmt) {
-            return 0;
-        }
-
-        /* just a byteswap needed? */
-        if ((src_fmt & ~SDL_AUDIO_MASK_ENDIAN) == (dst_fmt & ~SDL_AUDIO_MASK_ENDIAN)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
-                return -1;
-            }
-            cvt->needed = 1;
-            return 1;
-        }
-    }
-
-    /* Convert data types, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioTypeCVTToFloat(cvt, src_fmt) < 0) {
-        return -1;              /* shouldn't happen, but just in case... */
-    }
-
-    /* Channel conversion */
     if (src_channels < dst_channels) {
         /* Upmixing */
         /* Mono -> Stereo [-> ...] */
@@ -1003,7 +1529,15 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         /* 7.1 -> 5.1 [-> Stereo [-> Mono]] */
         /* 7.1 -> 5.1 [-> Quad] */
         if ((src_channels == 8) && (dst_channels <= 6)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert71To51) < 0) {
+            SDL_AudioFilter filter = SDL_Convert71To51;
+
+            #if HAVE_SSE_INTRINSICS
+            if (SDL_HasSSE()) {
+                filter = SDL_Convert71To51_SSE;
+            }
+            #endif
+
+            if (SDL_AddAudioCVTFilter(cvt, filter) < 0) {
                 return -1;
             }
             src_channels = 6;
@@ -1011,7 +1545,15 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [7.1 ->] 5.1 -> Stereo [-> Mono] */
         if ((src_channels == 6) && (dst_channels <= 2)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert51ToStereo) < 0) {
+            SDL_AudioFilter filter = SDL_Convert51ToStereo;
+
+            #if HAVE_SSE_INTRINSICS
+            if (SDL_HasSSE()) {
+                filter = SDL_Convert51ToStereo_SSE;
+            }
+            #endif
+
+            if (SDL_AddAudioCVTFilter(cvt, filter) < 0) {
                 return -1;
             }
             src_channels = 2;
@@ -1019,7 +1561,15 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* 5.1 -> Quad */
         if ((src_channels == 6) && (dst_channels == 4)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert51ToQuad) < 0) {
+            SDL_AudioFilter filter = SDL_Convert51ToQuad;
+
+            #if HAVE_SSE_INTRINSICS
+            if (SDL_HasSSE()) {
+                filter = SDL_Convert51ToQuad_SSE;
+            }
+            #endif
+
+            if (SDL_AddAudioCVTFilter(cvt, filter) < 0) {
                 return -1;
             }
             src_channels = 4;
@@ -1061,7 +1611,448 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
            handled by now, but let's be defensive */
       return SDL_SetError("Invalid channel combination");
     }
-    
+
+    return 0;
+}
+
+/* Every channel layout change above is linear, so each one (or a chain of
+   them) can also be done as a matrix multiply: output channel o of a frame
+   is the sum of input channel i times matrix[(i * 8) + o]. SDL_RemixCVT uses
+   that to convert the sample type and change the channel layout in one pass
+   over the buffer, instead of a pass per filter. */
+
+#define REMIX_MAX_CHANNELS 8
+#define REMIX_BLOCK_FRAMES 128
+
+/* One of these per pair of channel counts, so the compiler can unroll the
+   loops and keep the weights in registers. dst gets frames with dstchans
+   channels; weights hold REMIX_MAX_CHANNELS per input channel. */
+typedef void (*SDL_RemixFramesFunc)(const float *weights, const float *src, float *dst, int frames);
+
+#define REMIX_FRAMES_FUNC(srcchans, dstchans) \
+    static void \
+    SDL_RemixFrames_##srcchans##_to_##dstchans(const float *weights, const float *src, float *dst, int frames) { \
+        float w[srcchans][dstchans]; \
+        int i, o; \
+        for (i = 0; i < srcchans; i++) { \
+            for (o = 0; o < dstchans; o++) { \
+                w[i][o] = weights[(i * REMIX_MAX_CHANNELS) + o]; \
+            } \
+        } \
+        for (; frames; --frames, src += srcchans, dst += dstchans) { \
+            for (o = 0; o < dstchans; o++) { \
+                float sum = src[0] * w[0][o]; \
+                for (i = 1; i < srcchans; i++) { \
+                    sum += src[i] * w[i][o]; \
+                } \
+                dst[o] = sum; \
+            } \
+        } \
+    }
+
+/* The SIMD remixers do four output samples per vector, so they take frames in
+   groups that fill whole vectors: four mono frames, two stereo or 5.1 frames,
+   or one quad or 7.1 frame. Lane l of vector v in a group is output channel
+   ((v * 4) + l) % dstchans of frame ((v * 4) + l) / dstchans. The products are
+   summed in the same order as above, so the results are the same. Frames left
+   over after the last whole group go to the scalar remixer. */
+#define REMIX_GROUP_FRAMES(dstchans) (((dstchans) == 1) ? 4 : (((dstchans) & 3) ? 2 : 1))
+#define REMIX_GROUP_VECTORS 3
+#define REMIX_LANE_FRAME(dstchans, v, l) ((((v) * 4) + (l)) / (dstchans))
+#define REMIX_LANE_CHANNEL(dstchans, v, l) ((((v) * 4) + (l)) % (dstchans))
+
+/* Input channel i of the frames that vector v's lanes belong to. */
+#define REMIX_LANE_INPUT(src, srcchans, dstchans, v, l, i) \
+    (src)[(REMIX_LANE_FRAME(dstchans, v, l) * (srcchans)) + (i)]
+
+SDL_FORCE_INLINE void
+RemixLaneWeights(const int dstchans, const float *weights, const int i, const int v, float *lanes)
+{
+    int l;
+
+    for (l = 0; l < 4; l++) {
+        lanes[l] = weights[(i * REMIX_MAX_CHANNELS) + REMIX_LANE_CHANNEL(dstchans, v, l)];
+    }
+}
+
+#if HAVE_SSE_INTRINSICS
+SDL_FORCE_INLINE __m128
+RemixLaneInputs_SSE(const float *src, const int srcchans, const int dstchans, const int v, const int i)
+{
+    return _mm_set_ps(REMIX_LANE_INPUT(src, srcchans, dstchans, v, 3, i),
+                      REMIX_LANE_INPUT(src, srcchans, dstchans, v, 2, i),
+                      REMIX_LANE_INPUT(src, srcchans, dstchans, v, 1, i),
+                      REMIX_LANE_INPUT(src, srcchans, dstchans, v, 0, i));
+}
+
+SDL_FORCE_INLINE void
+SDL_RemixFrames_SSE(const int srcchans, const int dstchans, const SDL_RemixFramesFunc remix_scalar,
+                    const float *weights, const float *src, float *dst, int frames)
+{
+    const int group = REMIX_GROUP_FRAMES(dstchans);
+    const int vectors = (group * dstchans) / 4;
+    __m128 w[REMIX_MAX_CHANNELS][REMIX_GROUP_VECTORS];
+    int i, v;
+
+    for (i = 0; i < srcchans; i++) {
+        for (v = 0; v < vectors; v++) {
+            float lanes[4];
+            RemixLaneWeights(dstchans, weights, i, v, lanes);
+            w[i][v] = _mm_loadu_ps(lanes);
+        }
+    }
+
+    for (; frames >= group; frames -= group, src += group * srcchans, dst += group * dstchans) {
+        for (v = 0; v < vectors; v++) {
+            __m128 sum = _mm_mul_ps(RemixLaneInputs_SSE(src, srcchans, dstchans, v, 0), w[0][v]);
+            for (i = 1; i < srcchans; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(RemixLaneInputs_SSE(src, srcchans, dstchans, v, i), w[i][v]));
+            }
+            _mm_storeu_ps(dst + (v * 4), sum);
+        }
+    }
+
+    remix_scalar(weights, src, dst, frames);
+}
+
+#define REMIX_FRAMES_FUNC_SSE(srcchans, dstchans) \
+    static void \
+    SDL_RemixFrames_##srcchans##_to_##dstchans##_SSE(const float *weights, const float *src, float *dst, int frames) { \
+        SDL_RemixFrames_SSE(srcchans, dstchans, SDL_RemixFrames_##srcchans##_to_##dstchans, weights, src, dst, frames); \
+    }
+#else
+#define REMIX_FRAMES_FUNC_SSE(srcchans, dstchans)
+#endif
+
+#if HAVE_NEON_INTRINSICS
+SDL_FORCE_INLINE float32x4_t
+RemixLaneInputs_NEON(const float *src, const int srcchans, const int dstchans, const int v, const int i)
+{
+    float lanes[4];
+    int l;
+
+    for (l = 0; l < 4; l++) {
+        lanes[l] = REMIX_LANE_INPUT(src, srcchans, dstchans, v, l, i);
+    }
+    return vld1q_f32(lanes);
+}
+
+SDL_FORCE_INLINE void
+SDL_RemixFrames_NEON(const int srcchans, const int dstchans, const SDL_RemixFramesFunc remix_scalar,
+                     const float *weights, const float *src, float *dst, int frames)
+{
+    const int group = REMIX_GROUP_FRAMES(dstchans);
+    const int vectors = (group * dstchans) / 4;
+    float32x4_t w[REMIX_MAX_CHANNELS][REMIX_GROUP_VECTORS];
+    int i, v;
+
+    for (i = 0; i < srcchans; i++) {
+        for (v = 0; v < vectors; v++) {
+            float lanes[4];
+            RemixLaneWeights(dstchans, weights, i, v, lanes);
+            w[i][v] = vld1q_f32(lanes);
+        }
+    }
+
+    for (; frames >= group; frames -= group, src += group * srcchans, dst += group * dstchans) {
+        for (v = 0; v < vectors; v++) {
+            float32x4_t sum = vmulq_f32(RemixLaneInputs_NEON(src, srcchans, dstchans, v, 0), w[0][v]);
+            for (i = 1; i < srcchans; i++) {
+                sum = vmlaq_f32(sum, RemixLaneInputs_NEON(src, srcchans, dstchans, v, i), w[i][v]);
+            }
+            vst1q_f32(dst + (v * 4), sum);
+        }
+    }
+
+    remix_scalar(weights, src, dst, frames);
+}
+
+#define REMIX_FRAMES_FUNC_NEON(srcchans, dstchans) \
+    static void \
+    SDL_RemixFrames_##srcchans##_to_##dstchans##_NEON(const float *weights, const float *src, float *dst, int frames) { \
+        SDL_RemixFrames_NEON(srcchans, dstchans, SDL_RemixFrames_##srcchans##_to_##dstchans, weights, src, dst, frames); \
+    }
+#else
+#define REMIX_FRAMES_FUNC_NEON(srcchans, dstchans)
+#endif
+
+/* A mono output is a single dot product per frame, which the scalar kernel
+   already does well; gathering it into lanes is slower, so it stays scalar. */
+#if HAVE_SSE_INTRINSICS
+#define REMIX_CHOOSE_FRAMES_FUNC(srcchans, dstchans) \
+    ((dstchans != 1) && SDL_HasSSE() ? SDL_RemixFrames_##srcchans##_to_##dstchans##_SSE : SDL_RemixFrames_##srcchans##_to_##dstchans)
+#elif HAVE_NEON_INTRINSICS
+#define REMIX_CHOOSE_FRAMES_FUNC(srcchans, dstchans) \
+    ((dstchans != 1) && SDL_HasNEON() ? SDL_RemixFrames_##srcchans##_to_##dstchans##_NEON : SDL_RemixFrames_##srcchans##_to_##dstchans)
+#else
+#define REMIX_CHOOSE_FRAMES_FUNC(srcchans, dstchans) SDL_RemixFrames_##srcchans##_to_##dstchans
+#endif
+
+/* one per pair of supported channel counts, indexed by RemixIndex(). */
+static SDL_SpinLock RemixWeightsSpinlock = 0;
+static float RemixWeights[5][5][REMIX_MAX_CHANNELS * REMIX_MAX_CHANNELS];
+static SDL_bool RemixWeightsReady[5][5];
+
+static int
+RemixIndex(const int channels)
+{
+    switch (channels) {
+        case 1: return 0;
+        case 2: return 1;
+        case 4: return 2;
+        case 6: return 3;
+        case 8: return 4;
+        default: break;
+    }
+    SDL_assert(!"Unsupported channel count");
+    return 0;
+}
+
+/* Run one unit impulse per input channel through the layout filters; what
+   comes out are the weights from that channel to each output channel. */
+static int
+SDL_PrepareRemixWeights(const int src_channels, const int dst_channels)
+{
+    float *weights = RemixWeights[RemixIndex(src_channels)][RemixIndex(dst_channels)];
+    SDL_bool *ready = &RemixWeightsReady[RemixIndex(src_channels)][RemixIndex(dst_channels)];
+    float buf[REMIX_MAX_CHANNELS * REMIX_MAX_CHANNELS * 2];
+    SDL_AudioCVT cvt;
+    int retval = 0;
+    int i, o;
+
+    SDL_AtomicLock(&RemixWeightsSpinlock);
+    if (!*ready) {
+        SDL_zero(cvt);
+        cvt.src_format = cvt.dst_format = AUDIO_F32SYS;
+        cvt.len_mult = 1;
+        cvt.len_ratio = 1.0;
+        retval = SDL_BuildAudioChannelCVT(&cvt, src_channels, dst_channels);
+        if (retval == 0) {
+            cvt.buf = (Uint8 *) buf;
+            cvt.len = src_channels * src_channels * sizeof (float);
+            SDL_assert((cvt.len * cvt.len_mult) <= (int) sizeof (buf));
+            SDL_zero(buf);
+            for (i = 0; i < src_channels; i++) {
+                buf[(i * src_channels) + i] = 1.0f;
+            }
+            SDL_ConvertAudio(&cvt);
+
+            for (i = 0; i < src_channels; i++) {
+                for (o = 0; o < dst_channels; o++) {
+                    weights[(i * REMIX_MAX_CHANNELS) + o] = buf[(i * dst_channels) + o];
+                }
+            }
+            *ready = SDL_TRUE;
+        }
+    }
+    SDL_AtomicUnlock(&RemixWeightsSpinlock);
+
+    return retval;
+}
+
+static void
+SDL_RemixCVT(SDL_AudioCVT *cvt, const int src_channels, const int dst_channels,
+             const SDL_RemixFramesFunc remix_frames, SDL_AudioFormat format)
+{
+    /* if we're the last filter, write the final format directly. */
+    const SDL_AudioFormat dst_format = cvt->filters[cvt->filter_index + 1] ? AUDIO_F32SYS : cvt->dst_format;
+    const int src_framelen = (SDL_AUDIO_BITSIZE(format) / 8) * src_channels;
+    const int dst_framelen = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    const int frames = cvt->len_cvt / src_framelen;
+    /* work in place from the end if frames grow, so we don't overwrite frames we haven't read yet. */
+    const SDL_bool backwards = (dst_framelen > src_framelen);
+    const float *weights = RemixWeights[RemixIndex(src_channels)][RemixIndex(dst_channels)];
+    float scratch[(2 * REMIX_BLOCK_FRAMES * REMIX_MAX_CHANNELS) + 4];
+    float *in = scratch;  /* aligned to 16 bytes below, for the SIMD converters. */
+    float *out;
+    SDL_AudioCVT to_float, from_float;
+    int done;
+
+    SDL_assert(RemixWeightsReady[RemixIndex(src_channels)][RemixIndex(dst_channels)]);
+
+    in += (4 - ((((size_t) in) & 15) / sizeof (float))) & 3;
+    out = in + (REMIX_BLOCK_FRAMES * REMIX_MAX_CHANNELS);
+
+    /* the type conversions run on one block at a time, while it's in cache. */
+    SDL_zero(to_float);
+    to_float.src_format = format;
+    SDL_BuildAudioTypeCVTToFloat(&to_float, format);
+    SDL_zero(from_float);
+    from_float.src_format = AUDIO_F32SYS;
+    SDL_BuildAudioTypeCVTFromFloat(&from_float, dst_format);
+
+    for (done = 0; done < frames; ) {
+        const int count = SDL_min(frames - done, REMIX_BLOCK_FRAMES);
+        const int first = backwards ? (frames - done - count) : done;
+
+        SDL_memcpy(in, cvt->buf + (first * src_framelen), count * src_framelen);
+        to_float.buf = (Uint8 *) in;
+        to_float.len = count * src_framelen;
+        SDL_ConvertAudio(&to_float);
+
+        remix_frames(weights, in, out, count);
+
+        from_float.buf = (Uint8 *) out;
+        from_float.len = count * dst_channels * sizeof (float);
+        SDL_ConvertAudio(&from_float);
+        SDL_memcpy(cvt->buf + (first * dst_framelen), out, count * dst_framelen);
+
+        done += count;
+    }
+
+    cvt->len_cvt = frames * dst_framelen;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, dst_format);
+    }
+}
+
+/* SDL_AudioCVT doesn't store channel counts either, so each pair gets its own
+   filter entry point, like RESAMPLER_FUNCS. */
+#define REMIX_FUNCS(src, dst) \
+    REMIX_FRAMES_FUNC(src, dst) \
+    REMIX_FRAMES_FUNC_SSE(src, dst) \
+    REMIX_FRAMES_FUNC_NEON(src, dst) \
+    static void SDLCALL \
+    SDL_RemixCVT_##src##_to_##dst(SDL_AudioCVT *cvt, SDL_AudioFormat format) { \
+        SDL_RemixCVT(cvt, src, dst, REMIX_CHOOSE_FRAMES_FUNC(src, dst), format); \
+    }
+REMIX_FUNCS(1, 2) REMIX_FUNCS(1, 4) REMIX_FUNCS(1, 6) REMIX_FUNCS(1, 8)
+REMIX_FUNCS(2, 1) REMIX_FUNCS(2, 4) REMIX_FUNCS(2, 6) REMIX_FUNCS(2, 8)
+REMIX_FUNCS(4, 1) REMIX_FUNCS(4, 2) REMIX_FUNCS(4, 6) REMIX_FUNCS(4, 8)
+REMIX_FUNCS(6, 1) REMIX_FUNCS(6, 2) REMIX_FUNCS(6, 4) REMIX_FUNCS(6, 8)
+REMIX_FUNCS(8, 1) REMIX_FUNCS(8, 2) REMIX_FUNCS(8, 4) REMIX_FUNCS(8, 6)
+#undef REMIX_FUNCS
+#undef REMIX_FRAMES_FUNC
+#undef REMIX_FRAMES_FUNC_SSE
+#undef REMIX_FRAMES_FUNC_NEON
+#undef REMIX_CHOOSE_FRAMES_FUNC
+
+static const SDL_AudioFilter RemixFilters[5][5] = {
+    { NULL, SDL_RemixCVT_1_to_2, SDL_RemixCVT_1_to_4, SDL_RemixCVT_1_to_6, SDL_RemixCVT_1_to_8 },
+    { SDL_RemixCVT_2_to_1, NULL, SDL_RemixCVT_2_to_4, SDL_RemixCVT_2_to_6, SDL_RemixCVT_2_to_8 },
+    { SDL_RemixCVT_4_to_1, SDL_RemixCVT_4_to_2, NULL, SDL_RemixCVT_4_to_6, SDL_RemixCVT_4_to_8 },
+    { SDL_RemixCVT_6_to_1, SDL_RemixCVT_6_to_2, SDL_RemixCVT_6_to_4, NULL, SDL_RemixCVT_6_to_8 },
+    { SDL_RemixCVT_8_to_1, SDL_RemixCVT_8_to_2, SDL_RemixCVT_8_to_4, SDL_RemixCVT_8_to_6, NULL }
+};
+
+/* Replace the filters so far, which get the data to float and then change
+   its channel count, with a single SDL_RemixCVT filter. len_mult and
+   len_ratio stay as they are; they already cover what it does. */
+static int
+SDL_BuildAudioRemixCVT(SDL_AudioCVT *cvt, const int src_channels, const int dst_channels)
+{
+    if (SDL_PrepareRemixWeights(src_channels, dst_channels) < 0) {
+        return -1;
+    }
+
+    SDL_zero(cvt->filters);
+    cvt->filters[0] = RemixFilters[RemixIndex(src_channels)][RemixIndex(dst_channels)];
+    cvt->filter_index = 1;
+    return 0;
+}
+
+/* Creates a set of audio filters to convert from one format to another.
+   Returns 0 if no conversion is needed, 1 if the audio filter is set up,
+   or -1 if an error like invalid parameter, unsupported format, etc. occurred.
+*/
+
+int
+SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
+                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+{
+    int type_filters;
+    SDL_bool remixed;
+
+    /* Sanity check target pointer */
+    if (cvt == NULL) {
+        return SDL_InvalidParamError("cvt");
+    }
+
+    /* Make sure we zero out the audio conversion before error checking */
+    SDL_zerop(cvt);
+
+    if (!SDL_SupportedAudioFormat(src_fmt)) {
+        return SDL_SetError("Invalid source format");
+    } else if (!SDL_SupportedAudioFormat(dst_fmt)) {
+        return SDL_SetError("Invalid destination format");
+    } else if (!SDL_SupportedChannelCount(src_channels)) {
+        return SDL_SetError("Invalid source channels");
+    } else if (!SDL_SupportedChannelCount(dst_channels)) {
+        return SDL_SetError("Invalid destination channels");
+    } else if (src_rate == 0) {
+        return SDL_SetError("Source rate is zero");
+    } else if (dst_rate == 0) {
+        return SDL_SetError("Destination rate is zero");
+    }
+
+#if DEBUG_CONVERT
+    printf("Build format %04x->%04x, channels %u->%u, rate %d->%d\n",
+           src_fmt, dst_fmt, src_channels, dst_channels, src_rate, dst_rate);
+#endif
+
+    /* Start off with no conversion necessary */
+    cvt->src_format = src_fmt;
+    cvt->dst_format = dst_fmt;
+    cvt->needed = 0;
+    cvt->filter_index = 0;
+    SDL_zero(cvt->filters);
+    cvt->len_mult = 1;
+    cvt->len_ratio = 1.0;
+    cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
+
+    /* Make sure we've chosen audio conversion functions (MMX, scalar, etc.) */
+    SDL_ChooseAudioConverters();
+
+    /* Type conversion goes like this now:
+        - byteswap to CPU native format first if necessary.
+        - convert to native Float32 if necessary.
+        - resample and change channel count if necessary.
+        - convert back to native format.
+        - byteswap back to foreign format if necessary.
+
+       The expectation is we can process data faster in float32
+       (possibly with SIMD), and making several passes over the same
+       buffer is likely to be CPU cache-friendly, avoiding the
+       biggest performance hit in modern times. Previously we had
+       (script-generated) custom converters for every data type and
+       it was a bloat on SDL compile times and final library size. */
+
+    /* see if we can skip float conversion entirely. */
+    if (src_rate == dst_rate && src_channels == dst_channels) {
+        if (src_fmt == dst_fmt) {
+            return 0;
+        }
+
+        /* just a byteswap needed? */
+        if ((src_fmt & ~SDL_AUDIO_MASK_ENDIAN) == (dst_fmt & ~SDL_AUDIO_MASK_ENDIAN)) {
+            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
+                return -1;
+            }
+            cvt->needed = 1;
+            return 1;
+        }
+    }
+
+    /* Convert data types, if necessary. Updates (cvt). */
+    if (SDL_BuildAudioTypeCVTToFloat(cvt, src_fmt) < 0) {
+        return -1;              /* shouldn't happen, but just in case... */
+    }
+    type_filters = cvt->filter_index;
+
+    /* Channel conversion */
+    if (SDL_BuildAudioChannelCVT(cvt, src_channels, dst_channels) < 0) {
+        return -1;
+    }
+
+    /* Changing the channel count can take up to three filters, each a
+       pass over the whole buffer, on top of the type conversion. In that
+       case do all of it in a single pass with one filter instead. */
+    remixed = ((cvt->filter_index - type_filters) > 1);
+    if (remixed && (SDL_BuildAudioRemixCVT(cvt, src_channels, dst_channels) < 0)) {
+        return -1;
+    }
+
     /* Do rate conversion, if necessary. Updates (cvt). */
     if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) < 0) {
         return -1;              /* shouldn't happen, but just in case... */
@@ -1072,10 +2063,18 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         return -1;              /* shouldn't happen, but just in case... */
     }
 
+    /* With no resampling in between, the remix filter gets out of float, too. */
+    if (remixed && (src_rate == dst_rate) && (SDL_BuildAudioRemixCVT(cvt, src_channels, dst_channels) < 0)) {
+        return -1;
+    }
+
     cvt->needed = (cvt->filter_index != 0);
     return (cvt->needed);
 }
 
+/* SDL_AudioStreamSetRateRatio() keeps the ratio in fixed point, so any thread can set it. */
+#define AUDIOSTREAM_RATE_RATIO_ONE (1 << 24)
+
 typedef int (*SDL_ResampleAudioStreamFunc)(SDL_AudioStream *stream, const void *inbuf, const int inbuflen, void *outbuf, const int outbuflen);
 typedef void (*SDL_ResetAudioStreamResamplerFunc)(SDL_AudioStream *stream);
 typedef void (*SDL_CleanupAudioStreamResamplerFunc)(SDL_AudioStream *stream);
@@ -1085,12 +2084,17 @@ struct _SDL_AudioStream
     SDL_AudioCVT cvt_before_resampling;
     SDL_AudioCVT cvt_after_resampling;
     SDL_DataQueue *queue;
+    Uint8 *ring;  /* output buffer in lock-free mode, see SDL_AudioStreamSetLockFree(). */
+    Uint32 ring_size;  /* always a power of two. */
+    SDL_atomic_t ring_read;  /* total bytes ever read from ring; only SDL_AudioStreamGet() moves this. */
+    SDL_atomic_t ring_write;  /* total bytes ever written to ring; only the putting thread moves this. */
     SDL_bool first_run;
     Uint8 *staging_buffer;
     int staging_buffer_size;
     int staging_buffer_filled;
     Uint8 *work_buffer_base;  /* maybe unaligned pointer from SDL_realloc(). */
     int work_buffer_len;
+    const Uint8 *capture_input;  /* handed out by SDL_AudioStreamCaptureBuffer(), not yet converted. */
     int src_sample_frame_size;
     SDL_AudioFormat src_format;
     Uint8 src_channels;
@@ -1100,6 +2104,10 @@ struct _SDL_AudioStream
     Uint8 dst_channels;
     int dst_rate;
     double rate_incr;
+    SDL_atomic_t rate_ratio;  /* AUDIOSTREAM_RATE_RATIO_ONE is 1.0; zero until SDL_AudioStreamSetRateRatio(). */
+    SDL_bool variable_rate;  /* set by the putting thread once it sees a rate_ratio. */
+    double resample_step;  /* input frames per output frame, as of the end of the last put. */
+    double resample_position;  /* where the next output frame falls, relative to the next input. */
     Uint8 pre_resample_channels;
     int packetlen;
     int resampler_padding_samples;
@@ -1108,6 +2116,8 @@ struct _SDL_AudioStream
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    float *resampler_bank;  /* from AcquireResamplerBank(), or NULL to compute taps per frame. */
+    SDL_bool resampler_bank_owned;
 };
 
 static Uint8 *
@@ -1228,13 +2238,19 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
     const int paddingsamples = stream->resampler_padding_samples;
     const int paddingbytes = paddingsamples * sizeof (float);
     float *lpadding = (float *) stream->resampler_state;
+    float *edge = lpadding + paddingsamples;  /* see SetupAudioStreamResampling() */
     const float *rpadding = (const float *) inbufend; /* we set this up so there are valid padding samples at the end of the input buffer. */
     const int cpy = SDL_min(inbuflen, paddingbytes);
     int retval;
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    if (stream->variable_rate) {
+        retval = SDL_ResampleAudioVariable(chans, paddingsamples / chans, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen, edge,
+                                           &stream->resample_position, &stream->resample_step, 1.0 / stream->rate_incr);
+    } else {
+        retval = SDL_ResampleAudio(chans, inrate, outrate, stream->resampler_bank, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen, edge);
+    }
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -1247,6 +2263,8 @@ SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
     /* set all the padding to silence. */
     const int len = stream->resampler_padding_samples;
     SDL_memset(stream->resampler_state, '\0', len * sizeof (float));
+    stream->resample_position = 0.0;
+    stream->resample_step = 1.0 / stream->rate_incr;
 }
 
 static void
@@ -1255,6 +2273,68 @@ SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
     SDL_free(stream->resampler_state);
 }
 
+/* Set the stream up to get to float, resample, and convert to the final
+   format, holding back paddingframes of input for the resampler. Nothing in
+   the stream changes unless this succeeds. */
+static int
+SetupAudioStreamResampling(SDL_AudioStream *stream, const int paddingframes)
+{
+    const int paddingsamples = paddingframes * stream->pre_resample_channels;
+    const int stagingsize = paddingframes * stream->src_sample_frame_size;
+    SDL_AudioCVT before, after;
+    float *padding, *state;
+    Uint8 *staging;
+
+    /* Don't resample at first. Just get us to Float32 format. */
+    /* !!! FIXME: convert to int32 on devices without hardware float. */
+    if (SDL_BuildAudioCVT(&before, stream->src_format, stream->src_channels, stream->src_rate, AUDIO_F32SYS, stream->pre_resample_channels, stream->src_rate) < 0) {
+        return -1;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
+    }
+
+    /* Convert us to the final format after resampling. */
+    if (SDL_BuildAudioCVT(&after, AUDIO_F32SYS, stream->pre_resample_channels, stream->dst_rate, stream->dst_format, stream->dst_channels, stream->dst_rate) < 0) {
+        return -1;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
+    }
+
+    if (SDL_PrepareResampleFilter() < 0) {
+        return -1;
+    }
+
+    padding = (float *) SDL_calloc(paddingsamples, sizeof (float));
+    /* the resampler's left padding, then its scratch for gathering edge frames */
+    state = (float *) SDL_calloc(paddingsamples + (RESAMPLER_EDGE_FRAMES * stream->pre_resample_channels), sizeof (float));
+    staging = (Uint8 *) SDL_malloc(stagingsize);
+    if (!padding || !state || !staging) {
+        SDL_free(padding);
+        SDL_free(state);
+        SDL_free(staging);
+        return SDL_OutOfMemory();
+    }
+
+    SDL_free(stream->resampler_padding);
+    SDL_free(stream->staging_buffer);
+    stream->cvt_before_resampling = before;
+    stream->cvt_after_resampling = after;
+    stream->resampler_padding_samples = paddingsamples;
+    stream->resampler_padding = padding;
+    stream->staging_buffer = staging;
+    stream->staging_buffer_size = stagingsize;
+    stream->staging_buffer_filled = 0;
+
+#ifdef HAVE_LIBSAMPLERATE_H
+    if (SetupLibSampleRateResampling(stream)) {
+        SDL_free(state);
+        return 0;
+    }
+#endif
+
+    stream->resampler_state = state;
+    stream->resampler_func = SDL_ResampleAudioStream;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+    return 0;
+}
+
 SDL_AudioStream *
 SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const Uint8 src_channels,
@@ -1290,24 +2370,6 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     retval->pre_resample_channels = pre_resample_channels;
     retval->packetlen = packetlen;
     retval->rate_incr = ((double) dst_rate) / ((double) src_rate);
-    retval->resampler_padding_samples = ResamplerPadding(retval->src_rate, retval->dst_rate) * pre_resample_channels;
-    retval->resampler_padding = (float *) SDL_calloc(retval->resampler_padding_samples ? retval->resampler_padding_samples : 1, sizeof (float));
-
-    if (retval->resampler_padding == NULL) {
-        SDL_FreeAudioStream(retval);
-        SDL_OutOfMemory();
-        return NULL;
-    }
-
-    retval->staging_buffer_size = ((retval->resampler_padding_samples / retval->pre_resample_channels) * retval->src_sample_frame_size);
-    if (retval->staging_buffer_size > 0) {
-        retval->staging_buffer = (Uint8 *) SDL_malloc(retval->staging_buffer_size);
-        if (retval->staging_buffer == NULL) {
-            SDL_FreeAudioStream(retval);
-            SDL_OutOfMemory();
-            return NULL;
-        }
-    }
 
     /* Not resampling? It's an easy conversion (and maybe not even that!) */
     if (src_rate == dst_rate) {
@@ -1316,43 +2378,12 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
             SDL_FreeAudioStream(retval);
             return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
         }
-    } else {
-        /* Don't resample at first. Just get us to Float32 format. */
-        /* !!! FIXME: convert to int32 on devices without hardware float. */
-        if (SDL_BuildAudioCVT(&retval->cvt_before_resampling, src_format, src_channels, src_rate, AUDIO_F32SYS, pre_resample_channels, src_rate) < 0) {
-            SDL_FreeAudioStream(retval);
-            return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
-        }
-
-#ifdef HAVE_LIBSAMPLERATE_H
-        SetupLibSampleRateResampling(retval);
-#endif
-
-        if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof (float));
-            if (!retval->resampler_state) {
-                SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
-                return NULL;
-            }
-
-            if (SDL_PrepareResampleFilter() < 0) {
-                SDL_free(retval->resampler_state);
-                retval->resampler_state = NULL;
-                SDL_FreeAudioStream(retval);
-                return NULL;
-            }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
-        }
-
-        /* Convert us to the final format after resampling. */
-        if (SDL_BuildAudioCVT(&retval->cvt_after_resampling, AUDIO_F32SYS, pre_resample_channels, dst_rate, dst_format, dst_channels, dst_rate) < 0) {
-            SDL_FreeAudioStream(retval);
-            return NULL;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
-        }
+    } else if (SetupAudioStreamResampling(retval, ResamplerPadding(src_rate, dst_rate)) < 0) {
+        SDL_FreeAudioStream(retval);
+        return NULL;
+    } else if (retval->resampler_func == SDL_ResampleAudioStream) {
+        /* get the taps now, so resampling never has to allocate them. */
+        retval->resampler_bank = AcquireResamplerBank(src_rate, dst_rate, &retval->resampler_bank_owned);
     }
 
     retval->queue = SDL_NewDataQueue(packetlen, packetlen * 2);
@@ -1364,45 +2395,157 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     return retval;
 }
 
+/* Called from the putting thread the first time it sees a rate ratio. A
+   stream that wasn't resampling starts now, from silence; anything it
+   already converted doesn't need the resampler. */
 static int
-SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
+AudioStreamBeginVariableRate(SDL_AudioStream *stream)
 {
-    int buflen = len;
-    int workbuflen;
-    Uint8 *workbuf;
-    Uint8 *resamplebuf = NULL;
-    int resamplebuflen = 0;
-    int neededpaddingbytes;
-    int paddingbytes;
+    if (!stream->resampler_func) {
+        if (SetupAudioStreamResampling(stream, RESAMPLER_SAMPLES_PER_ZERO_CROSSING) < 0) {
+            return -1;
+        }
+        stream->first_run = SDL_TRUE;
+    }
 
-    /* !!! FIXME: several converters can take advantage of SIMD, but only
-       !!! FIXME:  if the data is aligned to 16 bytes. EnsureStreamBufferSize()
-       !!! FIXME:  guarantees the buffer will align, but the
-       !!! FIXME:  converters will iterate over the data backwards if
-       !!! FIXME:  the output grows, and this means we won't align if buflen
-       !!! FIXME:  isn't a multiple of 16. In these cases, we should chop off
-       !!! FIXME:  a few samples at the end and convert them separately. */
+    stream->resample_step = ((double) stream->src_rate) / ((double) stream->dst_rate);
+    stream->resample_position = 0.0;
+    stream->variable_rate = SDL_TRUE;
+    return 0;
+}
 
-    /* no padding prepended on first run. */
-    neededpaddingbytes = stream->resampler_padding_samples * sizeof (float);
-    paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
-    stream->first_run = SDL_FALSE;
+int
+SDL_AudioStreamSetRateRatio(SDL_AudioStream *stream, double ratio)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!((ratio >= 0.25) && (ratio <= 4.0))) {
+        return SDL_InvalidParamError("ratio");
+    }
+
+    SDL_AtomicSet(&stream->rate_ratio, (int) ((ratio * AUDIOSTREAM_RATE_RATIO_ONE) + 0.5));
+    return 0;
+}
+
+/* Lock-free mode: converted audio goes into a ring buffer shared by exactly
+   one putting thread and one getting thread. Each side only ever advances
+   its own counter, so neither needs a lock. Whatever doesn't fit in the ring
+   waits in stream->queue, which in this mode only the putting thread uses. */
+static int
+AudioStreamRingAvailable(SDL_AudioStream *stream)
+{
+    return (int) ((Uint32) SDL_AtomicGet(&stream->ring_write) - (Uint32) SDL_AtomicGet(&stream->ring_read));
+}
+
+/* how many bytes, in whole sample frames, of len fit in the ring, and where they go. */
+static Uint32
+AudioStreamRingSpace(SDL_AudioStream *stream, Uint32 len, Uint32 *write)
+{
+    Uint32 cpy;
+    *write = (Uint32) SDL_AtomicGet(&stream->ring_write);
+    cpy = SDL_min(len, stream->ring_size - (*write - (Uint32) SDL_AtomicGet(&stream->ring_read)));
+    return cpy - (cpy % stream->dst_sample_frame_size);
+}
+
+static int
+AudioStreamRingWrite(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    Uint32 write;
+    const Uint32 cpy = AudioStreamRingSpace(stream, (Uint32) len, &write);
+    const Uint32 pos = write & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(cpy, stream->ring_size - pos);
+
+    SDL_memcpy(stream->ring + pos, buf, first);
+    SDL_memcpy(stream->ring, buf + first, cpy - first);
 
-    /* Make sure the work buffer can hold all the data we need at once... */
-    workbuflen = buflen;
+    /* publish the data only after it's in place. */
+    SDL_AtomicSet(&stream->ring_write, (int) (write + cpy));
+    return (int) cpy;
+}
+
+static int
+AudioStreamRingRead(SDL_AudioStream *stream, Uint8 *buf, int len)
+{
+    const Uint32 read = (Uint32) SDL_AtomicGet(&stream->ring_read);
+    const Uint32 used = (Uint32) SDL_AtomicGet(&stream->ring_write) - read;
+    const Uint32 pos = read & (stream->ring_size - 1);
+    const Uint32 cpy = SDL_min((Uint32) len, used);
+    const Uint32 first = SDL_min(cpy, stream->ring_size - pos);
+
+    SDL_memcpy(buf, stream->ring + pos, first);
+    SDL_memcpy(buf + first, stream->ring, cpy - first);
+
+    /* hand the space back only after we're done reading it. */
+    SDL_AtomicSet(&stream->ring_read, (int) (read + cpy));
+    return (int) cpy;
+}
+
+/* move audio held back from a full ring into it, as space allows. */
+static void
+AudioStreamRingRefill(SDL_AudioStream *stream)
+{
+    Uint32 write;
+    const Uint32 cpy = AudioStreamRingSpace(stream, (Uint32) SDL_CountDataQueue(stream->queue), &write);
+    const Uint32 pos = write & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(cpy, stream->ring_size - pos);
+
+    if (cpy > 0) {
+        SDL_ReadFromDataQueue(stream->queue, stream->ring + pos, first);
+        SDL_ReadFromDataQueue(stream->queue, stream->ring, cpy - first);
+        SDL_AtomicSet(&stream->ring_write, (int) (write + cpy));
+    }
+}
+
+/* where all converted audio ends up. */
+static int
+AudioStreamOutput(SDL_AudioStream *stream, const void *buf, int len)
+{
+    if (stream->ring && (SDL_CountDataQueue(stream->queue) == 0)) {
+        const int cpy = AudioStreamRingWrite(stream, (const Uint8 *) buf, len);
+        buf = ((const Uint8 *) buf) + cpy;
+        len -= cpy;
+    }
+    return len ? SDL_WriteToDataQueue(stream->queue, buf, len) : 0;
+}
+
+/* pick up the latest SDL_AudioStreamSetRateRatio(); the resampler glides to it over the next put. */
+static void
+AudioStreamUpdateRate(SDL_AudioStream *stream)
+{
+    if (stream->variable_rate) {
+        const double ratio = ((double) SDL_AtomicGet(&stream->rate_ratio)) / AUDIOSTREAM_RATE_RATIO_ONE;
+        stream->rate_incr = ((double) stream->dst_rate) / (((double) stream->src_rate) * ratio);
+    }
+}
+
+/* Make sure the work buffer can hold all the data we need to convert buflen
+   bytes at once. The input goes after the resampler padding, if any. */
+static Uint8 *
+AudioStreamWorkBuffer(SDL_AudioStream *stream, const int buflen, int *resamplebuflen)
+{
+    const int neededpaddingbytes = stream->resampler_padding_samples * sizeof (float);
+    int workbuflen = buflen;
+
+    *resamplebuflen = 0;
     if (stream->cvt_before_resampling.needed) {
         workbuflen *= stream->cvt_before_resampling.len_mult;
     }
 
-    if (stream->dst_rate != stream->src_rate) {
+    if (stream->resampler_func) {
         /* resamples can't happen in place, so make space for second buf. */
         const int framesize = stream->pre_resample_channels * sizeof (float);
         const int frames = workbuflen / framesize;
-        resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+        if (stream->variable_rate) {
+            /* while gliding, the step is never shorter than at either end. */
+            const double incr = SDL_max(stream->rate_incr, 1.0 / stream->resample_step);
+            *resamplebuflen = ((int) SDL_ceil(frames * incr) + 1) * framesize;
+        } else {
+            *resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+        }
         #if DEBUG_AUDIOSTREAM
-        printf("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
+        printf("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, *resamplebuflen, stream->rate_incr);
         #endif
-        workbuflen += resamplebuflen;
+        workbuflen += *resamplebuflen;
     }
 
     if (stream->cvt_after_resampling.needed) {
@@ -1416,14 +2559,49 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     printf("AUDIOSTREAM: Putting %d bytes of preconverted audio, need %d byte work buffer\n", buflen, workbuflen);
     #endif
 
-    workbuf = EnsureStreamBufferSize(stream, workbuflen);
+    return EnsureStreamBufferSize(stream, workbuflen);
+}
+
+static int
+SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
+{
+    /* input that is already in the work buffer, see SDL_AudioStreamCaptureBuffer(). */
+    const SDL_bool inplace = (buf == stream->capture_input);
+    int buflen = len;
+    Uint8 *workbuf;
+    Uint8 *resamplebuf = NULL;
+    int resamplebuflen = 0;
+    int neededpaddingbytes;
+    int paddingbytes;
+
+    /* !!! FIXME: several converters can take advantage of SIMD, but only
+       !!! FIXME:  if the data is aligned to 16 bytes. EnsureStreamBufferSize()
+       !!! FIXME:  guarantees the buffer will align, but the
+       !!! FIXME:  converters will iterate over the data backwards if
+       !!! FIXME:  the output grows, and this means we won't align if buflen
+       !!! FIXME:  isn't a multiple of 16. In these cases, we should chop off
+       !!! FIXME:  a few samples at the end and convert them separately. */
+
+    /* in-place input was sized for the rate it saw, so it has to stay put. */
+    if (!inplace) {
+        AudioStreamUpdateRate(stream);
+    }
+
+    workbuf = AudioStreamWorkBuffer(stream, buflen, &resamplebuflen);
     if (!workbuf) {
         return -1;  /* probably out of memory. */
     }
 
+    /* no padding prepended on first run. */
+    neededpaddingbytes = stream->resampler_padding_samples * sizeof (float);
+    paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
+    stream->first_run = SDL_FALSE;
+
     resamplebuf = workbuf;  /* default if not resampling. */
 
-    SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+    if (!inplace) {
+        SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+    }
 
     if (stream->cvt_before_resampling.needed) {
         stream->cvt_before_resampling.buf = workbuf + paddingbytes;
@@ -1438,7 +2616,7 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         #endif
     }
 
-    if (stream->dst_rate != stream->src_rate) {
+    if (stream->resampler_func) {
         /* save off some samples at the end; they are used for padding now so
            the resampler is coherent and then used at the start of the next
            put operation. Prepend last put operation's padding, too. */
@@ -1490,7 +2668,7 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     }
 
     /* resamplebuf holds the final output, even if we didn't resample. */
-    return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
+    return buflen ? AudioStreamOutput(stream, resamplebuf, buflen) : 0;
 }
 
 int
@@ -1512,19 +2690,31 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
         return SDL_InvalidParamError("stream");
     } else if (!buf) {
         return SDL_InvalidParamError("buf");
-    } else if (len == 0) {
-        return 0;  /* nothing to do. */
     } else if ((len % stream->src_sample_frame_size) != 0) {
         return SDL_SetError("Can't add partial sample frames");
     }
 
+    if (stream->ring) {
+        AudioStreamRingRefill(stream);  /* older audio goes in first. */
+    }
+
+    if (!stream->variable_rate && SDL_AtomicGet(&stream->rate_ratio)) {
+        if (AudioStreamBeginVariableRate(stream) < 0) {
+            return -1;
+        }
+    }
+
+    if (len == 0) {
+        return 0;  /* nothing (else) to do. */
+    }
+
     if (!stream->cvt_before_resampling.needed &&
-        (stream->dst_rate == stream->src_rate) &&
+        !stream->resampler_func &&
         !stream->cvt_after_resampling.needed) {
         #if DEBUG_AUDIOSTREAM
         printf("AUDIOSTREAM: no conversion needed at all, queueing %d bytes.\n", len);
         #endif
-        return SDL_WriteToDataQueue(stream->queue, buf, len);
+        return AudioStreamOutput(stream, buf, len);
     }
 
     while (len > 0) {
@@ -1558,6 +2748,69 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
     return 0;
 }
 
+Uint8 *
+SDL_AudioStreamCaptureBuffer(SDL_AudioStream *stream, int len)
+{
+    int resamplebuflen;
+    Uint8 *workbuf;
+
+    if (stream->ring) {
+        AudioStreamRingRefill(stream);  /* older audio goes in first. */
+    }
+
+    if (!stream->variable_rate && SDL_AtomicGet(&stream->rate_ratio)) {
+        if (AudioStreamBeginVariableRate(stream) < 0) {
+            return NULL;
+        }
+    }
+
+    /* anything that would have to be staged goes through SDL_AudioStreamPut() instead. */
+    if ((len <= 0) || ((len % stream->src_sample_frame_size) != 0) ||
+        (stream->staging_buffer_filled > 0) || (len < stream->staging_buffer_size)) {
+        return NULL;
+    }
+
+    AudioStreamUpdateRate(stream);
+    workbuf = AudioStreamWorkBuffer(stream, len, &resamplebuflen);
+    if (!workbuf) {
+        return NULL;
+    }
+
+    if (!stream->first_run) {
+        workbuf += stream->resampler_padding_samples * sizeof (float);
+    }
+    stream->capture_input = workbuf;
+    return workbuf;
+}
+
+int
+SDL_AudioStreamCapture(SDL_AudioStream *stream, const void *buf, int len)
+{
+    int retval;
+
+    if (buf == stream->capture_input) {
+        retval = SDL_AudioStreamPutInternal(stream, buf, len, NULL);
+    } else {
+        retval = SDL_AudioStreamPut(stream, buf, len);
+    }
+    stream->capture_input = NULL;
+
+    if (retval < 0) {
+        return -1;
+    }
+
+    /* in lock-free mode the queue only holds what didn't fit in the ring. Drop
+       it here, instead of letting it grow for as long as nobody reads. */
+    retval = 0;
+    if (stream->ring) {
+        retval = (int) SDL_CountDataQueue(stream->queue);
+        if (retval > 0) {
+            SDL_ClearDataQueue(stream->queue, stream->packetlen * 2);
+        }
+    }
+    return retval;
+}
+
 int SDL_AudioStreamFlush(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -1569,7 +2822,11 @@ int SDL_AudioStreamFlush(SDL_AudioStream *stream)
     #endif
 
     /* shouldn't use a staging buffer if we're not resampling. */
-    SDL_assert((stream->dst_rate != stream->src_rate) || (stream->staging_buffer_filled == 0));
+    SDL_assert(stream->resampler_func || (stream->staging_buffer_filled == 0));
+
+    if (stream->ring) {
+        AudioStreamRingRefill(stream);
+    }
 
     if (stream->staging_buffer_filled > 0) {
         /* push the staging buffer + silence. We need to flush out not just
@@ -1610,6 +2867,38 @@ int SDL_AudioStreamFlush(SDL_AudioStream *stream)
     return 0;
 }
 
+int
+SDL_AudioStreamSetLockFree(SDL_AudioStream *stream, int len)
+{
+    Uint32 size = 1;
+    Uint8 *ring;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (stream->ring) {
+        return SDL_SetError("Stream is already lock-free");
+    } else if ((len <= 0) || (len > 0x40000000)) {
+        return SDL_InvalidParamError("len");
+    }
+
+    while (size < (Uint32) len) {
+        size <<= 1;
+    }
+
+    ring = (Uint8 *) SDL_malloc(size);
+    if (!ring) {
+        return SDL_OutOfMemory();
+    }
+
+    /* anything already converted just waits in the queue until the next put. */
+    stream->ring = ring;
+    stream->ring_size = size;
+    SDL_AtomicSet(&stream->ring_read, 0);
+    SDL_AtomicSet(&stream->ring_write, 0);
+    AudioStreamRingRefill(stream);
+    return 0;
+}
+
 /* get converted/resampled data from the stream */
 int
 SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
@@ -1628,6 +2917,10 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
         return SDL_SetError("Can't request partial sample frames");
     }
 
+    if (stream->ring) {
+        return AudioStreamRingRead(stream, (Uint8 *) buf, len);
+    }
+
     return (int) SDL_ReadFromDataQueue(stream->queue, buf, len);
 }
 
@@ -1635,7 +2928,12 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
 int
 SDL_AudioStreamAvailable(SDL_AudioStream *stream)
 {
-    return stream ? (int) SDL_CountDataQueue(stream->queue) : 0;
+    if (!stream) {
+        return 0;
+    } else if (stream->ring) {
+        return AudioStreamRingAvailable(stream);
+    }
+    return (int) SDL_CountDataQueue(stream->queue);
 }
 
 void
@@ -1645,6 +2943,9 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
         SDL_InvalidParamError("stream");
     } else {
         SDL_ClearDataQueue(stream->queue, stream->packetlen * 2);
+        if (stream->ring) {
+            SDL_AtomicSet(&stream->ring_read, SDL_AtomicGet(&stream->ring_write));
+        }
         if (stream->reset_resampler_func) {
             stream->reset_resampler_func(stream);
         }
@@ -1653,6 +2954,14 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
     }
 }
 
+void
+SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate)
+{
+    *format = stream->dst_format;
+    *channels = stream->dst_channels;
+    *rate = stream->dst_rate;
+}
+
 /* dispose of a stream */
 void
 SDL_FreeAudioStream(SDL_AudioStream *stream)
@@ -1662,9 +2971,11 @@ SDL_FreeAudioStream(SDL_AudioStream *stream)
             stream->cleanup_resampler_func(stream);
         }
         SDL_FreeDataQueue(stream->queue);
+        SDL_free(stream->ring);
         SDL_free(stream->staging_buffer);
         SDL_free(stream->work_buffer_base);
         SDL_free(stream->resampler_padding);
+        ReleaseResamplerBank(stream->resampler_bank, stream->resampler_bank_owned);
         SDL_free(stream);
     }
 }
@@ -25,8 +25,21 @@
 #include "SDL_cpuinfo.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
+#include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __SSE__
+#define HAVE_SSE_INTRINSICS 1
+#endif
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  * Changed to use 0xFE instead of 0xFF for better sound quality.
@@ -85,6 +98,345 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* SIMD mixers for the native-endian formats. Each one handles as many whole
+   vectors as fit in len and returns the number of bytes it mixed; the scalar
+   code below does the rest. They're only used for 0 < volume <= 128, and they
+   match the scalar code bit for bit: ADJUST_VOLUME divides toward zero, mix8
+   pins U8 to 0..0xFE, and F32 pins to +/-FLT_MAX. */
+typedef Uint32 (*SDL_MixAudioFunc) (Uint8 *dst, const Uint8 *src, Uint32 len, int volume);
+
+static SDL_MixAudioFunc SDL_MixAudio_U8 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S8 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S16 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S32 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_F32 = NULL;
+
+#if HAVE_SSE2_INTRINSICS
+/* (p / 128), rounded toward zero like the C division in ADJUST_VOLUME. */
+#define DIV128_EPI16_SSE2(p) \
+    _mm_srai_epi16(_mm_add_epi16(p, _mm_srli_epi16(_mm_srai_epi16(p, 15), 9)), 7)
+
+static Uint32
+SDL_MixAudio_U8_SSE2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const __m128i maxval = _mm_set1_epi8((char) 0xFE);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        const __m128i plo = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(s, zero), bias), vol);
+        const __m128i phi = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(s, zero), bias), vol);
+        const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(d, zero), DIV128_EPI16_SSE2(plo));
+        const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(d, zero), DIV128_EPI16_SSE2(phi));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_min_epu8(_mm_packus_epi16(lo, hi), maxval));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S8_SSE2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        const __m128i plo = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8), vol);
+        const __m128i phi = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8), vol);
+        const __m128i adjusted = _mm_packs_epi16(DIV128_EPI16_SSE2(plo), DIV128_EPI16_SSE2(phi));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi8(d, adjusted));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S16_SSE2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const __m128i fracmask = _mm_set1_epi16(SDL_MIX_MAXVOLUME - 1);
+    const __m128i zero = _mm_setzero_si128();
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        /* the 32-bit product is hi:lo, so (p >> 7) is (hi << 9) | (lo >> 7).
+           That rounds down, so add one back for negative inexact results. */
+        const __m128i lo = _mm_mullo_epi16(s, vol);
+        const __m128i hi = _mm_mulhi_epi16(s, vol);
+        const __m128i floored = _mm_or_si128(_mm_slli_epi16(hi, 9), _mm_srli_epi16(lo, 7));
+        const __m128i inexact = _mm_cmpeq_epi16(_mm_and_si128(lo, fracmask), zero);
+        const __m128i roundup = _mm_andnot_si128(inexact, _mm_srai_epi16(s, 15));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi16(d, _mm_sub_epi16(floored, roundup)));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S32_SSE2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    /* Doubles hold every Sint32 * volume exactly, and cvttpd truncates. */
+    const __m128d scale = _mm_set1_pd(((double) volume) / SDL_MIX_MAXVOLUME);
+    const __m128d maxval = _mm_set1_pd(2147483647.0);
+    const __m128d minval = _mm_set1_pd(-2147483648.0);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        const __m128i shi = _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2));
+        const __m128i dhi = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+        const __m128i alo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), scale));
+        const __m128i ahi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(shi), scale));
+        __m128d lo = _mm_add_pd(_mm_cvtepi32_pd(alo), _mm_cvtepi32_pd(d));
+        __m128d hi = _mm_add_pd(_mm_cvtepi32_pd(ahi), _mm_cvtepi32_pd(dhi));
+        lo = _mm_max_pd(_mm_min_pd(lo, maxval), minval);
+        hi = _mm_max_pd(_mm_min_pd(hi, maxval), minval);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_F32_SSE2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 maxval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 minval = _mm_set1_ps(-3.402823466e+38F);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps((const float *) (src + i)), fvolume), fmaxvolume);
+        const __m128 sum = _mm_add_ps(s, _mm_loadu_ps((const float *) (dst + i)));
+        /* operand order keeps the same NaN the scalar code would. */
+        _mm_storeu_ps((float *) (dst + i), _mm_max_ps(minval, _mm_min_ps(maxval, sum)));
+    }
+    return total;
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+#define DIV128_EPI16_AVX2(p) \
+    _mm256_srai_epi16(_mm256_add_epi16(p, _mm256_srli_epi16(_mm256_srai_epi16(p, 15), 9)), 7)
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_U8_AVX2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i bias = _mm256_set1_epi16(128);
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+    const __m256i maxval = _mm256_set1_epi8((char) 0xFE);
+    const Uint32 total = len & ~31;
+    Uint32 i;
+
+    /* unpack and pack both work within 128-bit lanes, so they cancel out. */
+    for (i = 0; i < total; i += 32) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        const __m256i plo = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero), bias), vol);
+        const __m256i phi = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero), bias), vol);
+        const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(d, zero), DIV128_EPI16_AVX2(plo));
+        const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(d, zero), DIV128_EPI16_AVX2(phi));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_min_epu8(_mm256_packus_epi16(lo, hi), maxval));
+    }
+    return total;
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_S8_AVX2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+    const Uint32 total = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 32) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        const __m256i plo = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(s, s), 8), vol);
+        const __m256i phi = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(s, s), 8), vol);
+        const __m256i adjusted = _mm256_packs_epi16(DIV128_EPI16_AVX2(plo), DIV128_EPI16_AVX2(phi));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_adds_epi8(d, adjusted));
+    }
+    return total;
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_S16_AVX2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+    const __m256i fracmask = _mm256_set1_epi16(SDL_MIX_MAXVOLUME - 1);
+    const __m256i zero = _mm256_setzero_si256();
+    const Uint32 total = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 32) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        const __m256i lo = _mm256_mullo_epi16(s, vol);
+        const __m256i hi = _mm256_mulhi_epi16(s, vol);
+        const __m256i floored = _mm256_or_si256(_mm256_slli_epi16(hi, 9), _mm256_srli_epi16(lo, 7));
+        const __m256i inexact = _mm256_cmpeq_epi16(_mm256_and_si256(lo, fracmask), zero);
+        const __m256i roundup = _mm256_andnot_si256(inexact, _mm256_srai_epi16(s, 15));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_adds_epi16(d, _mm256_sub_epi16(floored, roundup)));
+    }
+    return total;
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_S32_AVX2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m256d scale = _mm256_set1_pd(((double) volume) / SDL_MIX_MAXVOLUME);
+    const __m256d maxval = _mm256_set1_pd(2147483647.0);
+    const __m256d minval = _mm256_set1_pd(-2147483648.0);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        const __m128i adjusted = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(s), scale));
+        __m256d sum = _mm256_add_pd(_mm256_cvtepi32_pd(adjusted), _mm256_cvtepi32_pd(d));
+        sum = _mm256_max_pd(_mm256_min_pd(sum, maxval), minval);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm256_cvttpd_epi32(sum));
+    }
+    return total;
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_F32_AVX2(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 maxval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 minval = _mm256_set1_ps(-3.402823466e+38F);
+    const Uint32 total = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 32) {
+        const __m256 s = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps((const float *) (src + i)), fvolume), fmaxvolume);
+        const __m256 sum = _mm256_add_ps(s, _mm256_loadu_ps((const float *) (dst + i)));
+        _mm256_storeu_ps((float *) (dst + i), _mm256_max_ps(minval, _mm256_min_ps(maxval, sum)));
+    }
+    return total;
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+#define DIV128_S16_NEON(p) \
+    vshrq_n_s16(vaddq_s16(p, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(vshrq_n_s16(p, 15)), 9))), 7)
+#define DIV128_S32_NEON(p) \
+    vshrq_n_s32(vaddq_s32(p, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p, 31)), 25))), 7)
+#define DIV128_S64_NEON(p) \
+    vshrq_n_s64(vaddq_s64(p, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(p, 63)), 57))), 7)
+
+static Uint32
+SDL_MixAudio_U8_NEON(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const uint8x8_t bias = vdup_n_u8(128);
+    const uint8x16_t maxval = vdupq_n_u8(0xFE);
+    const Sint16 vol = (Sint16) volume;
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const uint8x16_t s = vld1q_u8(src + i);
+        const uint8x16_t d = vld1q_u8(dst + i);
+        const int16x8_t plo = vmulq_n_s16(vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(s), bias)), vol);
+        const int16x8_t phi = vmulq_n_s16(vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(s), bias)), vol);
+        const int16x8_t lo = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(d))), DIV128_S16_NEON(plo));
+        const int16x8_t hi = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(d))), DIV128_S16_NEON(phi));
+        vst1q_u8(dst + i, vminq_u8(vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)), maxval));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S8_NEON(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const Sint16 vol = (Sint16) volume;
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const int8x16_t s = vld1q_s8((const Sint8 *) (src + i));
+        const int8x16_t d = vld1q_s8((const Sint8 *) (dst + i));
+        const int16x8_t plo = vmulq_n_s16(vmovl_s8(vget_low_s8(s)), vol);
+        const int16x8_t phi = vmulq_n_s16(vmovl_s8(vget_high_s8(s)), vol);
+        const int8x16_t adjusted = vcombine_s8(vmovn_s16(DIV128_S16_NEON(plo)), vmovn_s16(DIV128_S16_NEON(phi)));
+        vst1q_s8((Sint8 *) (dst + i), vqaddq_s8(d, adjusted));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S16_NEON(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const Sint16 vol = (Sint16) volume;
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const int16x8_t s = vld1q_s16((const Sint16 *) (src + i));
+        const int16x8_t d = vld1q_s16((const Sint16 *) (dst + i));
+        const int32x4_t plo = vmull_n_s16(vget_low_s16(s), vol);
+        const int32x4_t phi = vmull_n_s16(vget_high_s16(s), vol);
+        const int16x8_t adjusted = vcombine_s16(vmovn_s32(DIV128_S32_NEON(plo)), vmovn_s32(DIV128_S32_NEON(phi)));
+        vst1q_s16((Sint16 *) (dst + i), vqaddq_s16(d, adjusted));
+    }
+    return total;
+}
+
+static Uint32
+SDL_MixAudio_S32_NEON(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const Sint32 vol = (Sint32) volume;
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const int32x4_t s = vld1q_s32((const Sint32 *) (src + i));
+        const int32x4_t d = vld1q_s32((const Sint32 *) (dst + i));
+        const int64x2_t plo = vmull_n_s32(vget_low_s32(s), vol);
+        const int64x2_t phi = vmull_n_s32(vget_high_s32(s), vol);
+        const int32x4_t adjusted = vcombine_s32(vmovn_s64(DIV128_S64_NEON(plo)), vmovn_s64(DIV128_S64_NEON(phi)));
+        vst1q_s32((Sint32 *) (dst + i), vqaddq_s32(d, adjusted));
+    }
+    return total;
+}
+
+#ifdef __aarch64__  /* ARMv7 NEON flushes denormals to zero, the scalar code doesn't. */
+static Uint32
+SDL_MixAudio_F32_NEON(Uint8 *dst, const Uint8 *src, Uint32 len, int volume)
+{
+    const float fvolume = (float) volume;
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float32x4_t maxval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t minval = vdupq_n_f32(-3.402823466e+38F);
+    const Uint32 total = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < total; i += 16) {
+        const float32x4_t s = vmulq_n_f32(vmulq_n_f32(vld1q_f32((const float *) (src + i)), fvolume), fmaxvolume);
+        const float32x4_t sum = vaddq_f32(s, vld1q_f32((const float *) (dst + i)));
+        vst1q_f32((float *) (dst + i), vmaxq_f32(vminq_f32(sum, maxval), minval));
+    }
+    return total;
+}
+#endif
+#endif
+
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
@@ -94,6 +446,27 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    SDL_ChooseAudioMixers();
+
+    if (volume <= SDL_MIX_MAXVOLUME) {
+        SDL_MixAudioFunc mixer = NULL;
+        switch (format) {
+            case AUDIO_U8: mixer = SDL_MixAudio_U8; break;
+            case AUDIO_S8: mixer = SDL_MixAudio_S8; break;
+            case AUDIO_S16SYS: mixer = SDL_MixAudio_S16; break;
+            case AUDIO_S32SYS: mixer = SDL_MixAudio_S32; break;
+            case AUDIO_F32SYS: mixer = SDL_MixAudio_F32; break;
+            default: break;
+        }
+
+        if (mixer) {
+            const Uint32 mixed = mixer(dst, src, len, volume);
+            dst += mixed;
+            src += mixed;
+            len -= mixed;
+        }
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -366,4 +739,135 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+/* Float mixing for streams bound to a device: dst += src * gain.
+   These don't clamp; the final conversion to the device format does. */
+
+static void SDLCALL
+SDL_MixFloat32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+    for (i = 0; i < num_samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+#if HAVE_SSE_INTRINSICS
+static void SDLCALL
+SDL_MixFloat32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    int i;
+
+    for (i = 0; i < (num_samples & ~7); i += 8) {
+        const __m128 s0 = _mm_mul_ps(_mm_loadu_ps(src + i), g);
+        const __m128 s1 = _mm_mul_ps(_mm_loadu_ps(src + i + 4), g);
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), s0));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_loadu_ps(dst + i + 4), s1));
+    }
+    SDL_MixFloat32_Scalar(dst + i, src + i, num_samples - i, gain);
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_MixFloat32_AVX2(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+    int i;
+
+    /* mul then add, not FMA, so the result matches the other paths exactly. */
+    for (i = 0; i < (num_samples & ~15); i += 16) {
+        const __m256 s0 = _mm256_mul_ps(_mm256_loadu_ps(src + i), g);
+        const __m256 s1 = _mm256_mul_ps(_mm256_loadu_ps(src + i + 8), g);
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), s0));
+        _mm256_storeu_ps(dst + i + 8, _mm256_add_ps(_mm256_loadu_ps(dst + i + 8), s1));
+    }
+    SDL_MixFloat32_Scalar(dst + i, src + i, num_samples - i, gain);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void SDLCALL
+SDL_MixFloat32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < (num_samples & ~7); i += 8) {
+        const float32x4_t s0 = vmulq_n_f32(vld1q_f32(src + i), gain);
+        const float32x4_t s1 = vmulq_n_f32(vld1q_f32(src + i + 4), gain);
+        vst1q_f32(dst + i, vaddq_f32(vld1q_f32(dst + i), s0));
+        vst1q_f32(dst + i + 4, vaddq_f32(vld1q_f32(dst + i + 4), s1));
+    }
+    SDL_MixFloat32_Scalar(dst + i, src + i, num_samples - i, gain);
+}
+#endif
+
+SDL_MixFloat32Func SDL_MixFloat32 = NULL;
+
+/* Point the mixers at the best kernels this CPU has. */
+static void
+ChooseAudioMixerKernels(void)
+{
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_MixAudio_U8 = SDL_MixAudio_U8_AVX2;
+        SDL_MixAudio_S8 = SDL_MixAudio_S8_AVX2;
+        SDL_MixAudio_S16 = SDL_MixAudio_S16_AVX2;
+        SDL_MixAudio_S32 = SDL_MixAudio_S32_AVX2;
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_AVX2;
+        SDL_MixFloat32 = SDL_MixFloat32_AVX2;
+        return;
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_MixAudio_U8 = SDL_MixAudio_U8_SSE2;
+        SDL_MixAudio_S8 = SDL_MixAudio_S8_SSE2;
+        SDL_MixAudio_S16 = SDL_MixAudio_S16_SSE2;
+        SDL_MixAudio_S32 = SDL_MixAudio_S32_SSE2;
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_SSE2;
+    }
+#endif
+#if HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_MixFloat32 = SDL_MixFloat32_SSE;
+        return;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_MixAudio_U8 = SDL_MixAudio_U8_NEON;
+        SDL_MixAudio_S8 = SDL_MixAudio_S8_NEON;
+        SDL_MixAudio_S16 = SDL_MixAudio_S16_NEON;
+        SDL_MixAudio_S32 = SDL_MixAudio_S32_NEON;
+#ifdef __aarch64__
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_NEON;
+#endif
+        SDL_MixFloat32 = SDL_MixFloat32_NEON;
+        return;
+    }
+#endif
+    SDL_MixFloat32 = SDL_MixFloat32_Scalar;
+}
+
+/* This is called from SDL_AudioInit(), but SDL_MixAudioFormat() works without
+   it, so any thread can get here first. */
+void
+SDL_ChooseAudioMixers(void)
+{
+    static SDL_SpinLock lock = 0;
+    static SDL_atomic_t chosen;
+
+    if (SDL_AtomicGet(&chosen)) {
+        return;
+    }
+
+    SDL_AtomicLock(&lock);
+    if (!SDL_AtomicGet(&chosen)) {
+        ChooseAudioMixerKernels();
+        SDL_AtomicSet(&chosen, 1);
+    }
+    SDL_AtomicUnlock(&lock);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -128,6 +128,13 @@ typedef struct SDL_AudioDriver
 } SDL_AudioDriver;
 
 
+/* A stream mixed into a device's output, see SDL_BindAudioStream() */
+typedef struct SDL_BoundAudioStream
+{
+    SDL_AudioStream *stream;
+    float gain;
+} SDL_BoundAudioStream;
+
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -166,6 +173,33 @@ struct SDL_AudioDevice
     /* Queued buffers (if app not using callback). */
     SDL_DataQueue *buffer_queue;
 
+    /* Streams mixed into the callback's output, protected by mixer_lock. */
+    SDL_BoundAudioStream *bound_streams;
+    int num_bound_streams;
+    int max_bound_streams;
+
+    /* A capture stream the device is writing into directly, outside the
+       lock. It can't be unbound until this goes back to NULL. Protected by
+       mixer_lock. */
+    SDL_AudioStream *pinned_stream;
+
+    /* Float mixing buffers and the conversions to and from callbackspec.
+       Allocated when the first stream is bound. */
+    float *mix_buffer;
+    float *mix_stream_buffer;
+    SDL_AudioCVT mix_to_float;
+    SDL_AudioCVT mix_from_float;
+
+    /* Sample frames the callback has handled, protected by mixer_lock. */
+    Uint64 frames_played;
+
+    /* Telemetry for SDL_GetAudioDeviceStats(), protected by mixer_lock.
+       period_ticks is how long one callback's worth of audio lasts. */
+    SDL_AudioDeviceStats stats;
+    Uint64 stats_period_ticks;
+    Uint64 stats_last_start;
+    SDL_bool stats_starved;
+
     /* * * */
     /* Data private to this driver */
     struct SDL_PrivateAudioData *hidden;
@@ -26,7 +26,16 @@
 #include "SDL_wave.h"
 
 
-static int ReadChunk(SDL_RWops * src, Chunk * chunk);
+/* How much SDL_WAVDecoderPut() decodes at once, in sample frames */
+#define WAVE_PUT_FRAMES 4096
+
+typedef enum
+{
+    WAVE_DECODE_PCM,            /* PCM and float data, used as-is */
+    WAVE_DECODE_PCM24,          /* 24-bit PCM, expanded to 32 bits */
+    WAVE_DECODE_MS_ADPCM,
+    WAVE_DECODE_IMA_ADPCM
+} WaveDecodeType;
 
 struct MS_ADPCM_decodestate
 {
@@ -35,49 +44,82 @@ struct MS_ADPCM_decodestate
     Sint16 iSamp1;
     Sint16 iSamp2;
 };
-static struct MS_ADPCM_decoder
+
+struct IMA_ADPCM_decodestate
+{
+    Sint32 sample;
+    Sint8 index;
+};
+
+struct _SDL_WAVDecoder
 {
-    WaveFMT wavefmt;
-    Uint16 wSamplesPerBlock;
+    SDL_RWops *src;
+    int freesrc;
+    SDL_AudioSpec spec;
+    WaveDecodeType type;
+
+    Sint64 riff_end;            /* Offset just past the RIFF chunk */
+    Sint64 data_start;          /* Offset of the data chunk contents */
+    Uint32 data_length;         /* Length of the data chunk contents */
+    Uint32 blockalign;          /* Bytes per encoded block */
+    Uint32 block_frames;        /* Sample frames per encoded block */
+    Uint32 frame_size;          /* Bytes per decoded sample frame */
+    Uint32 total_frames;
+    Uint32 position;            /* Next sample frame to be returned */
+
+    /* ADPCM only: the encoded block, and what is left of it once decoded */
+    Uint8 *block;
+    Uint8 *decoded;
+    Uint32 decoded_pos;
+    Uint32 decoded_frames;
+    Uint32 next_block;
+
     Uint16 wNumCoef;
     Sint16 aCoeff[7][2];
-    /* * * */
-    struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
+    struct MS_ADPCM_decodestate ms_state[2];
+    struct IMA_ADPCM_decodestate ima_state[2];
+
+    Uint8 *putbuf;
+};
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(SDL_WAVDecoder * decoder, const WaveFMT * format, Uint32 fmtlen)
 {
-    Uint8 *rogue_feel;
+    const Uint8 *rogue_feel;
+    const Uint32 channels = decoder->spec.channels;
+    Uint32 wSamplesPerBlock;
     int i;
 
-    /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
-        rogue_feel += sizeof(Uint16);
+    if (fmtlen < sizeof(*format) + 3 * sizeof(Uint16)) {
+        return SDL_SetError("Invalid MS_ADPCM format chunk");
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Set the rogue pointer to the MS_ADPCM specific data, past its size */
+    rogue_feel = (const Uint8 *) format + sizeof(*format) + sizeof(Uint16);
+    wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
-        SDL_SetError("Unknown set of MS_ADPCM coefficients");
-        return (-1);
+    if (decoder->wNumCoef != 7 ||
+        fmtlen < sizeof(*format) + 3 * sizeof(Uint16) + 7 * 2 * sizeof(Sint16)) {
+        return SDL_SetError("Unknown set of MS_ADPCM coefficients");
+    }
+    if (channels > SDL_arraysize(decoder->ms_state)) {
+        return SDL_SetError("MS ADPCM decoder can only handle %u channels",
+                            (unsigned int)SDL_arraysize(decoder->ms_state));
+    }
+    /* Each block has a 7 byte header per channel, then 4 bits per sample */
+    if (wSamplesPerBlock < 2 ||
+        decoder->blockalign < 7 * channels + ((wSamplesPerBlock - 2) * channels + 1) / 2) {
+        return SDL_SetError("Invalid MS_ADPCM block size");
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < decoder->wNumCoef; ++i) {
+        decoder->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        decoder->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
+    decoder->block_frames = wSamplesPerBlock;
     return (0);
 }
 
@@ -115,138 +157,124 @@ MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
     return (new_sample);
 }
 
+/* Decode the block in decoder->block to decoder->decoded */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decode(SDL_WAVDecoder * decoder)
 {
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    const Uint8 *encoded = decoder->block;
+    Uint8 *decoded = decoder->decoded;
+    Sint32 samplesleft;
     Sint8 nybble;
     Uint8 stereo;
     Sint16 *coeff[2];
     Sint32 new_sample;
 
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        return SDL_OutOfMemory();
-    }
-    decoded = *audio_buf;
-
     /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
-        }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    stereo = (decoder->spec.channels == 2);
+    state[0] = &decoder->ms_state[0];
+    state[1] = &decoder->ms_state[stereo];
+
+    /* Grab the initial information for this block */
+    state[0]->hPredictor = *encoded++;
+    if (stereo) {
+        state[1]->hPredictor = *encoded++;
+    }
+    if (state[0]->hPredictor >= decoder->wNumCoef ||
+        state[1]->hPredictor >= decoder->wNumCoef) {
+        return SDL_SetError("Invalid MS_ADPCM predictor");
+    }
+    state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
-
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
+    }
+    coeff[0] = decoder->aCoeff[state[0]->hPredictor];
+    coeff[1] = decoder->aCoeff[state[1]->hPredictor];
+
+    /* Store the two initial samples we start with */
+    decoded[0] = state[0]->iSamp2 & 0xFF;
+    decoded[1] = state[0]->iSamp2 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp2 & 0xFF;
+        decoded[1] = state[1]->iSamp2 >> 8;
         decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
+    }
+    decoded[0] = state[0]->iSamp1 & 0xFF;
+    decoded[1] = state[0]->iSamp1 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp1 & 0xFF;
+        decoded[1] = state[1]->iSamp1 >> 8;
         decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
+    }
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
-        while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->block_frames - 2) * decoder->spec.channels;
+    while (samplesleft > 0) {
+        nybble = (*encoded) >> 4;
+        new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
+        decoded += 2;
 
+        if (samplesleft > 1) {
             nybble = (*encoded) & 0x0F;
             new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
             decoded[0] = new_sample & 0xFF;
             new_sample >>= 8;
             decoded[1] = new_sample & 0xFF;
             decoded += 2;
-
-            ++encoded;
-            samplesleft -= 2;
         }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
+
+        ++encoded;
+        samplesleft -= 2;
     }
-    SDL_free(freeable);
     return (0);
 }
 
-struct IMA_ADPCM_decodestate
-{
-    Sint32 sample;
-    Sint8 index;
-};
-static struct IMA_ADPCM_decoder
-{
-    WaveFMT wavefmt;
-    Uint16 wSamplesPerBlock;
-    /* * * */
-    struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
-
 static int
-InitIMA_ADPCM(WaveFMT * format)
+InitIMA_ADPCM(SDL_WAVDecoder * decoder, const WaveFMT * format, Uint32 fmtlen)
 {
-    Uint8 *rogue_feel;
-
-    /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
-        rogue_feel += sizeof(Uint16);
+    const Uint8 *rogue_feel;
+    const Uint32 channels = decoder->spec.channels;
+    Uint32 wSamplesPerBlock;
+
+    if (fmtlen < sizeof(*format) + 2 * sizeof(Uint16)) {
+        return SDL_SetError("Invalid IMA ADPCM format chunk");
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Set the rogue pointer to the IMA_ADPCM specific data, past its size */
+    rogue_feel = (const Uint8 *) format + sizeof(*format) + sizeof(Uint16);
+    wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Check to make sure we have enough variables in the state array */
+    if (channels > SDL_arraysize(decoder->ima_state)) {
+        return SDL_SetError("IMA ADPCM decoder can only handle %u channels",
+                            (unsigned int)SDL_arraysize(decoder->ima_state));
+    }
+    /* Each block has a 4 byte header per channel, then runs of 8 samples
+       packed into 4 bytes per channel */
+    if (wSamplesPerBlock < 1 || ((wSamplesPerBlock - 1) % 8) != 0 ||
+        decoder->blockalign < (4 + (wSamplesPerBlock - 1) / 2) * channels) {
+        return SDL_SetError("Invalid IMA ADPCM block size");
+    }
+    decoder->block_frames = wSamplesPerBlock;
     return (0);
 }
 
@@ -306,7 +334,7 @@ IMA_ADPCM_nibble(struct IMA_ADPCM_decodestate *state, Uint8 nybble)
 
 /* Fill the decode buffer with a channel block of data (8 samples) */
 static void
-Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
+Fill_IMA_ADPCM_block(Uint8 * decoded, const Uint8 * encoded,
                      int channel, int numchannels,
                      struct IMA_ADPCM_decodestate *state)
 {
@@ -334,98 +362,62 @@ Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
     }
 }
 
+/* Decode the block in decoder->block to decoder->decoded */
 static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+IMA_ADPCM_decode(SDL_WAVDecoder * decoder)
 {
-    struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    unsigned int c, channels;
+    struct IMA_ADPCM_decodestate *state = decoder->ima_state;
+    const Uint8 *encoded = decoder->block;
+    Uint8 *decoded = decoder->decoded;
+    Sint32 samplesleft;
+    unsigned int c, channels = decoder->spec.channels;
+
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        /* Fill the state information for this block */
+        state[c].sample = ((encoded[1] << 8) | encoded[0]);
+        encoded += 2;
+        if (state[c].sample & 0x8000) {
+            state[c].sample -= 0x10000;
+        }
+        state[c].index = *encoded++;
+        /* Reserved byte in buffer header, should be 0 */
+        if (*encoded++ != 0) {
+            /* Uh oh, corrupt data?  Buggy code? */ ;
+        }
 
-    /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
-        SDL_SetError("IMA ADPCM decoder can only handle %u channels",
-                     (unsigned int)SDL_arraysize(IMA_ADPCM_state.state));
-        return (-1);
-    }
-    state = IMA_ADPCM_state.state;
-
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        return SDL_OutOfMemory();
-    }
-    decoded = *audio_buf;
+        /* Store the initial sample we start with */
+        decoded[0] = (Uint8) (state[c].sample & 0xFF);
+        decoded[1] = (Uint8) (state[c].sample >> 8);
+        decoded += 2;
+    }
 
-    /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->block_frames - 1) * channels;
+    while (samplesleft > 0) {
         for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
-
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
-            }
-            decoded += (channels * 8 * 2);
+            Fill_IMA_ADPCM_block(decoded, encoded,
+                                 c, channels, &state[c]);
+            encoded += 4;
+            samplesleft -= 8;
         }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
+        decoded += (channels * 8 * 2);
     }
-    SDL_free(freeable);
     return (0);
 }
 
-
-static int
-ConvertSint24ToSint32(Uint8 ** audio_buf, Uint32 * audio_len)
+/* Expand 'samples' packed 24-bit samples at the start of buf to 32 bits */
+static void
+ConvertSint24ToSint32(Uint8 * buf, Uint32 samples)
 {
     const double DIVBY8388608 = 0.00000011920928955078125;
-    const Uint32 original_len = *audio_len;
-    const Uint32 samples = original_len / 3;
-    const Uint32 expanded_len = samples * sizeof (Uint32);
-    Uint8 *ptr = (Uint8 *) SDL_realloc(*audio_buf, expanded_len);
     const Uint8 *src;
     Uint32 *dst;
     Uint32 i;
 
-    if (!ptr) {
-        return SDL_OutOfMemory();
-    }
-
-    *audio_buf = ptr;
-    *audio_len = expanded_len;
-
     /* work from end to start, since we're expanding in-place. */
-    src = (ptr + original_len) - 3;
-    dst = ((Uint32 *) (ptr + expanded_len)) - 1;
+    src = (buf + samples * 3) - 3;
+    dst = ((Uint32 *) (buf + samples * sizeof (Uint32))) - 1;
     for (i = 0; i < samples; i++) {
         /* There's probably a faster way to do all this. */
         const Sint32 converted = ((Sint32) ( (((Uint32) src[2]) << 24) |
@@ -435,44 +427,141 @@ ConvertSint24ToSint32(Uint8 ** audio_buf, Uint32 * audio_len)
         src -= 3;
         *(dst--) = (Sint32) (scaled * 2147483647.0);
     }
+}
 
+/* Read and decode the next ADPCM block, leaving decoded_frames at 0 if the
+   data chunk ends early */
+static int
+WaveReadBlock(SDL_WAVDecoder * decoder)
+{
+    decoder->decoded_pos = decoder->decoded_frames = 0;
+    if (SDL_RWread(decoder->src, decoder->block, decoder->blockalign, 1) != 1) {
+        /* The file is shorter than its data chunk claims */
+        decoder->total_frames = decoder->next_block * decoder->block_frames;
+        return 0;
+    }
+    if (decoder->type == WAVE_DECODE_MS_ADPCM) {
+        if (MS_ADPCM_decode(decoder) < 0) {
+            return -1;
+        }
+    } else {
+        if (IMA_ADPCM_decode(decoder) < 0) {
+            return -1;
+        }
+    }
+    ++decoder->next_block;
+    decoder->decoded_frames = decoder->block_frames;
     return 0;
 }
 
+/* Decode up to *frames sample frames to buf, returning how many were
+   decoded in *frames */
+static int
+WaveDecode(SDL_WAVDecoder * decoder, Uint8 * buf, Uint32 * frames)
+{
+    const Uint32 frame_size = decoder->frame_size;
+    const Uint32 wanted = SDL_min(*frames, decoder->total_frames - decoder->position);
+    Uint32 done = 0;
+
+    if (decoder->type == WAVE_DECODE_PCM || decoder->type == WAVE_DECODE_PCM24) {
+        /* PCM is read straight into buf; 24-bit samples are packed at the
+           start of it, then expanded in place */
+        if (wanted > 0) {
+            done = (Uint32) SDL_RWread(decoder->src, buf, decoder->blockalign, wanted);
+            if (done < wanted) {
+                /* The file is shorter than its data chunk claims */
+                decoder->total_frames = decoder->position + done;
+            }
+            if (decoder->type == WAVE_DECODE_PCM24) {
+                ConvertSint24ToSint32(buf, done * decoder->spec.channels);
+            }
+        }
+    } else {
+        while (done < wanted) {
+            Uint32 avail;
+
+            if (decoder->decoded_pos == decoder->decoded_frames) {
+                if (WaveReadBlock(decoder) < 0) {
+                    return -1;
+                }
+                if (decoder->decoded_frames == 0) {
+                    break;
+                }
+            }
+            avail = SDL_min(decoder->decoded_frames - decoder->decoded_pos, wanted - done);
+            SDL_memcpy(buf + done * frame_size,
+                       decoder->decoded + decoder->decoded_pos * frame_size,
+                       avail * frame_size);
+            decoder->decoded_pos += avail;
+            done += avail;
+        }
+    }
+
+    decoder->position += done;
+    *frames = done;
+    return 0;
+}
+
+static int
+ReadChunkHeader(SDL_RWops * src, Chunk * chunk)
+{
+    Uint32 header[2];
+
+    if (SDL_RWread(src, header, sizeof (header), 1) != 1) {
+        return SDL_Error(SDL_EFREAD);
+    }
+    chunk->magic = SDL_SwapLE32(header[0]);
+    chunk->length = SDL_SwapLE32(header[1]);
+    return 0;
+}
+
+static int
+SkipChunk(SDL_RWops * src, Uint32 length)
+{
+    Uint8 scratch[256];
+
+    /* Seek over the chunk if we can, otherwise read through it */
+    if (SDL_RWseek(src, length, RW_SEEK_CUR) >= 0) {
+        return 0;
+    }
+    while (length > 0) {
+        const Uint32 len = SDL_min(length, sizeof (scratch));
+        if (SDL_RWread(src, scratch, len, 1) != 1) {
+            return SDL_Error(SDL_EFREAD);
+        }
+        length -= len;
+    }
+    return 0;
+}
 
 /* GUIDs that are used by WAVE_FORMAT_EXTENSIBLE */
 static const Uint8 extensible_pcm_guid[16] = { 1, 0, 0, 0, 0, 0, 16, 0, 128, 0, 0, 170, 0, 56, 155, 113 };
 static const Uint8 extensible_ieee_guid[16] = { 3, 0, 0, 0, 0, 0, 16, 0, 128, 0, 0, 170, 0, 56, 155, 113 };
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
-               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+/* Parse the WAVE header, leaving src at the start of the audio data */
+static int
+WaveOpen(SDL_WAVDecoder * decoder)
 {
-    int was_error;
+    SDL_RWops *src = decoder->src;
+    SDL_AudioSpec *spec = &decoder->spec;
     Chunk chunk;
-    int lenread;
     int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
-    int samplesize;
+    Uint16 channels, bitspersample;
+    Uint32 blocks;
 
     /* WAV magic header */
     Uint32 RIFFchunk;
-    Uint32 wavelen = 0;
+    Uint32 wavelen;
     Uint32 WAVEmagic;
-    Uint32 headerDiff = 0;
 
-    /* FMT chunk */
-    WaveFMT *format = NULL;
+    /* FMT chunk; the largest one we understand is MS ADPCM's */
+    Uint32 fmtbuf[16];
+    Uint32 fmtlen;
+    WaveFMT *format = (WaveFMT *) fmtbuf;
     WaveExtensibleFMT *ext = NULL;
 
     SDL_zero(chunk);
 
-    /* Make sure we are passed a valid data source */
-    was_error = 0;
-    if (src == NULL) {
-        was_error = 1;
-        goto done;
-    }
-
     /* Check the magic header */
     RIFFchunk = SDL_ReadLE32(src);
     wavelen = SDL_ReadLE32(src);
@@ -484,33 +573,50 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         WAVEmagic = SDL_ReadLE32(src);
     }
     if ((RIFFchunk != RIFF) || (WAVEmagic != WAVE)) {
-        SDL_SetError("Unrecognized file type (not WAVE)");
-        was_error = 1;
-        goto done;
+        return SDL_SetError("Unrecognized file type (not WAVE)");
     }
-    headerDiff += sizeof(Uint32);       /* for WAVE */
+    /* wavelen counts the WAVE magic and everything after it */
+    decoder->riff_end = SDL_RWtell(src) - sizeof(Uint32) + wavelen;
 
     /* Read the audio data format chunk */
-    chunk.data = NULL;
-    do {
-        SDL_free(chunk.data);
-        chunk.data = NULL;
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
-            was_error = 1;
-            goto done;
+    for (;;) {
+        if (ReadChunkHeader(src, &chunk) < 0) {
+            return -1;
+        }
+        if ((chunk.magic != FACT) && (chunk.magic != LIST) &&
+            (chunk.magic != BEXT) && (chunk.magic != JUNK)) {
+            break;
         }
-        /* 2 Uint32's for chunk header+len, plus the lenread */
-        headerDiff += lenread + 2 * sizeof(Uint32);
-    } while ((chunk.magic == FACT) || (chunk.magic == LIST) || (chunk.magic == BEXT) || (chunk.magic == JUNK));
+        if (SkipChunk(src, chunk.length) < 0) {
+            return -1;
+        }
+    }
+    if (chunk.magic != FMT) {
+        return SDL_SetError("Complex WAVE files not supported");
+    }
+    if (chunk.length < sizeof(*format)) {
+        return SDL_SetError("Invalid WAVE format chunk");
+    }
+    fmtlen = SDL_min(chunk.length, sizeof(fmtbuf));
+    if (SDL_RWread(src, fmtbuf, fmtlen, 1) != 1) {
+        return SDL_Error(SDL_EFREAD);
+    }
+    if (SkipChunk(src, chunk.length - fmtlen) < 0) {
+        return -1;
+    }
 
     /* Decode the audio data format */
-    format = (WaveFMT *) chunk.data;
-    if (chunk.magic != FMT) {
-        SDL_SetError("Complex WAVE files not supported");
-        was_error = 1;
-        goto done;
+    channels = SDL_SwapLE16(format->channels);
+    bitspersample = SDL_SwapLE16(format->bitspersample);
+    if (channels == 0 || channels > 255) {
+        return SDL_SetError("Invalid number of WAVE channels: %d", channels);
     }
+    spec->freq = SDL_SwapLE32(format->frequency);
+    spec->channels = (Uint8) channels;
+    spec->samples = 4096;       /* Good default buffer size */
+    decoder->blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->block_frames = 1;
+
     IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
     switch (SDL_SwapLE16(format->encoding)) {
     case PCM_CODE:
@@ -522,17 +628,15 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         break;
     case MS_ADPCM_CODE:
         /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
+        if (InitMS_ADPCM(decoder, format, fmtlen) < 0) {
+            return -1;
         }
         MS_ADPCM_encoded = 1;
         break;
     case IMA_ADPCM_CODE:
         /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
+        if (InitIMA_ADPCM(decoder, format, fmtlen) < 0) {
+            return -1;
         }
         IMA_ADPCM_encoded = 1;
         break;
@@ -542,10 +646,8 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
            to get things that didn't really _need_ WAVE_FORMAT_EXTENSIBLE
            to be useful working when they use this format flag. */
         ext = (WaveExtensibleFMT *) format;
-        if (SDL_SwapLE16(ext->size) < 22) {
-            SDL_SetError("bogus extended .wav header");
-            was_error = 1;
-            goto done;
+        if (fmtlen < sizeof(*ext) || SDL_SwapLE16(ext->size) < 22) {
+            return SDL_SetError("bogus extended .wav header");
         }
         if (SDL_memcmp(ext->subformat, extensible_pcm_guid, 16) == 0) {
             break;  /* cool. */
@@ -555,109 +657,295 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         }
         break;
     case MP3_CODE:
-        SDL_SetError("MPEG Layer 3 data not supported");
-        was_error = 1;
-        goto done;
+        return SDL_SetError("MPEG Layer 3 data not supported");
     default:
-        SDL_SetError("Unknown WAVE data format: 0x%.4x",
-                     SDL_SwapLE16(format->encoding));
-        was_error = 1;
-        goto done;
+        return SDL_SetError("Unknown WAVE data format: 0x%.4x",
+                            SDL_SwapLE16(format->encoding));
     }
-    SDL_zerop(spec);
-    spec->freq = SDL_SwapLE32(format->frequency);
 
-    if (IEEE_float_encoded) {
-        if ((SDL_SwapLE16(format->bitspersample)) != 32) {
-            was_error = 1;
-        } else {
-            spec->format = AUDIO_F32;
-        }
+    if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
+        spec->format = AUDIO_S16;
+        decoder->type = MS_ADPCM_encoded ? WAVE_DECODE_MS_ADPCM : WAVE_DECODE_IMA_ADPCM;
     } else {
-        switch (SDL_SwapLE16(format->bitspersample)) {
-        case 4:
-            if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
-                spec->format = AUDIO_S16;
+        int was_error = 0;
+
+        decoder->type = WAVE_DECODE_PCM;
+        if (IEEE_float_encoded) {
+            if (bitspersample != 32) {
+                was_error = 1;
             } else {
+                spec->format = AUDIO_F32;
+            }
+        } else {
+            switch (bitspersample) {
+            case 8:
+                spec->format = AUDIO_U8;
+                break;
+            case 16:
+                spec->format = AUDIO_S16;
+                break;
+            case 24:  /* convert this. */
+                spec->format = AUDIO_S32;
+                decoder->type = WAVE_DECODE_PCM24;
+                break;
+            case 32:
+                spec->format = AUDIO_S32;
+                break;
+            default:
                 was_error = 1;
+                break;
             }
+        }
+        if (was_error) {
+            return SDL_SetError("Unknown %d-bit PCM data format", bitspersample);
+        }
+        /* PCM is handled one sample frame at a time */
+        decoder->blockalign = (bitspersample / 8) * channels;
+    }
+    decoder->frame_size = (SDL_AUDIO_BITSIZE(spec->format) / 8) * channels;
+
+    /* Find the audio data chunk */
+    for (;;) {
+        if (ReadChunkHeader(src, &chunk) < 0) {
+            return -1;
+        }
+        if (chunk.magic == DATA) {
             break;
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16;
-            break;
-        case 24:  /* convert this. */
-            spec->format = AUDIO_S32;
-            break;
-        case 32:
-            spec->format = AUDIO_S32;
-            break;
-        default:
-            was_error = 1;
-            break;
+        }
+        if (SkipChunk(src, chunk.length) < 0) {
+            return -1;
+        }
+    }
+    decoder->data_start = SDL_RWtell(src);
+    decoder->data_length = chunk.length;
+
+    /* A trailing partial block is ignored */
+    blocks = SDL_min(chunk.length / decoder->blockalign,
+                     SDL_MAX_UINT32 / decoder->block_frames);
+    decoder->total_frames = blocks * decoder->block_frames;
+
+    if (decoder->type == WAVE_DECODE_MS_ADPCM || decoder->type == WAVE_DECODE_IMA_ADPCM) {
+        decoder->block = (Uint8 *) SDL_malloc(decoder->blockalign);
+        decoder->decoded = (Uint8 *) SDL_malloc(decoder->block_frames * decoder->frame_size);
+        if (!decoder->block || !decoder->decoded) {
+            return SDL_OutOfMemory();
         }
     }
+    return 0;
+}
 
-    if (was_error) {
-        SDL_SetError("Unknown %d-bit PCM data format",
-                     SDL_SwapLE16(format->bitspersample));
-        goto done;
+SDL_WAVDecoder *
+SDL_NewWAVDecoder(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVDecoder *decoder;
+
+    if (!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+    if (!spec) {
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        SDL_InvalidParamError("spec");
+        return NULL;
     }
-    spec->channels = (Uint8) SDL_SwapLE16(format->channels);
-    spec->samples = 4096;       /* Good default buffer size */
 
-    /* Read the audio data chunk */
-    *audio_buf = NULL;
-    do {
-        SDL_free(*audio_buf);
-        *audio_buf = NULL;
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
-            was_error = 1;
-            goto done;
+    decoder = (SDL_WAVDecoder *) SDL_calloc(1, sizeof (*decoder));
+    if (!decoder) {
+        if (freesrc) {
+            SDL_RWclose(src);
         }
-        *audio_len = lenread;
-        *audio_buf = chunk.data;
-        if (chunk.magic != DATA)
-            headerDiff += lenread + 2 * sizeof(Uint32);
-    } while (chunk.magic != DATA);
-    headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
-
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
-            was_error = 1;
-            goto done;
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    decoder->src = src;
+    decoder->freesrc = freesrc;
+
+    if (WaveOpen(decoder) < 0) {
+        SDL_FreeWAVDecoder(decoder);
+        return NULL;
+    }
+    *spec = decoder->spec;
+    return decoder;
+}
+
+int
+SDL_WAVDecoderRead(SDL_WAVDecoder * decoder, void *buf, int len)
+{
+    Uint32 frames;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    frames = ((Uint32) len) / decoder->frame_size;
+    if (WaveDecode(decoder, (Uint8 *) buf, &frames) < 0) {
+        return -1;
+    }
+    return (int) (frames * decoder->frame_size);
+}
+
+int
+SDL_WAVDecoderPut(SDL_WAVDecoder * decoder, SDL_AudioStream * stream, int len)
+{
+    int total = 0;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    if (!decoder->putbuf) {
+        decoder->putbuf = (Uint8 *) SDL_malloc(WAVE_PUT_FRAMES * decoder->frame_size);
+        if (!decoder->putbuf) {
+            return SDL_OutOfMemory();
         }
     }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
-            was_error = 1;
-            goto done;
+
+    while ((Uint32) (len - total) >= decoder->frame_size) {
+        Uint32 frames = SDL_min(((Uint32) (len - total)) / decoder->frame_size, WAVE_PUT_FRAMES);
+        if (WaveDecode(decoder, decoder->putbuf, &frames) < 0) {
+            return -1;
+        } else if (frames == 0) {
+            break;
+        }
+        if (SDL_AudioStreamPut(stream, decoder->putbuf, (int) (frames * decoder->frame_size)) < 0) {
+            return -1;
         }
+        total += (int) (frames * decoder->frame_size);
+    }
+    return total;
+}
+
+int
+SDL_WAVDecoderSeek(SDL_WAVDecoder * decoder, Uint32 frame)
+{
+    Uint32 block;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    } else if (frame > decoder->total_frames) {
+        return SDL_SetError("WAVE seek position out of range");
     }
 
-    if (SDL_SwapLE16(format->bitspersample) == 24) {
-        if (ConvertSint24ToSint32(audio_buf, audio_len) < 0) {
-            was_error = 1;
-            goto done;
+    block = frame / decoder->block_frames;
+    if (SDL_RWseek(decoder->src, decoder->data_start + ((Sint64) block) * decoder->blockalign, RW_SEEK_SET) < 0) {
+        return -1;
+    }
+    decoder->position = block * decoder->block_frames;
+    decoder->next_block = block;
+    decoder->decoded_pos = decoder->decoded_frames = 0;
+
+    /* ADPCM has to decode its way into the block */
+    if (frame > decoder->position) {
+        if (WaveReadBlock(decoder) < 0) {
+            return -1;
         }
+        decoder->decoded_pos = SDL_min(frame - decoder->position, decoder->decoded_frames);
+        decoder->position += decoder->decoded_pos;
+    }
+    return 0;
+}
+
+Uint32
+SDL_WAVDecoderTell(SDL_WAVDecoder * decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return 0;
+    }
+    return decoder->position;
+}
+
+Uint32
+SDL_WAVDecoderLength(SDL_WAVDecoder * decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return 0;
+    }
+    return decoder->total_frames;
+}
+
+void
+SDL_FreeWAVDecoder(SDL_WAVDecoder * decoder)
+{
+    if (decoder) {
+        if (decoder->freesrc) {
+            SDL_RWclose(decoder->src);
+        }
+        SDL_free(decoder->block);
+        SDL_free(decoder->decoded);
+        SDL_free(decoder->putbuf);
+        SDL_free(decoder);
+    }
+}
+
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
+               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    SDL_WAVDecoder *decoder;
+    Uint8 *buf = NULL;
+    Uint32 frames, expected;
+    int was_error;
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        SDL_InvalidParamError("src");
+        return NULL;
     }
 
-    /* Don't return a buffer that isn't a multiple of samplesize */
-    samplesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
-    *audio_len &= ~(samplesize - 1);
+    /* The decoder borrows src, so we can seek past the RIFF chunk below */
+    was_error = 1;
+    decoder = SDL_NewWAVDecoder(src, 0, spec);
+    if (decoder == NULL) {
+        goto done;
+    }
+
+    /* Decode all of the audio data in one go, straight into the buffer we
+       hand back; ADPCM only needs one encoded block of scratch space */
+    if (decoder->total_frames > SDL_MAX_UINT32 / decoder->frame_size) {
+        SDL_SetError("WAVE data too large");
+        goto done;
+    }
+    buf = (Uint8 *) SDL_malloc(decoder->total_frames * decoder->frame_size);
+    if (buf == NULL) {
+        SDL_OutOfMemory();
+        goto done;
+    }
+    frames = expected = decoder->total_frames;
+    if (WaveDecode(decoder, buf, &frames) < 0) {
+        goto done;
+    }
+    if (frames < expected) {
+        SDL_Error(SDL_EFREAD);
+        goto done;
+    }
+    *audio_buf = buf;
+    *audio_len = frames * decoder->frame_size;
+    buf = NULL;
+    was_error = 0;
 
   done:
-    SDL_free(format);
-    if (src) {
-        if (freesrc) {
-            SDL_RWclose(src);
-        } else {
+    SDL_free(buf);
+    if (decoder) {
+        if (!freesrc) {
             /* seek to the end of the file (given by the RIFF chunk) */
-            SDL_RWseek(src, wavelen - chunk.length - headerDiff, RW_SEEK_CUR);
+            SDL_RWseek(src, decoder->riff_end, RW_SEEK_SET);
         }
+        SDL_FreeWAVDecoder(decoder);
+    }
+    if (freesrc) {
+        SDL_RWclose(src);
     }
     if (was_error) {
         spec = NULL;
@@ -674,21 +962,4 @@ SDL_FreeWAV(Uint8 * audio_buf)
     SDL_free(audio_buf);
 }
 
-static int
-ReadChunk(SDL_RWops * src, Chunk * chunk)
-{
-    chunk->magic = SDL_ReadLE32(src);
-    chunk->length = SDL_ReadLE32(src);
-    chunk->data = (Uint8 *) SDL_malloc(chunk->length);
-    if (chunk->data == NULL) {
-        return SDL_OutOfMemory();
-    }
-    if (SDL_RWread(src, chunk->data, chunk->length, 1) != 1) {
-        SDL_free(chunk->data);
-        chunk->data = NULL;
-        return SDL_Error(SDL_EFREAD);
-    }
-    return (chunk->length);
-}
-
 /* vi: set ts=4 sw=4 expandtab: */
@@ -57,12 +57,11 @@ typedef struct WaveFMT
     Uint16 bitspersample;       /* One of 8, 12, 16, or 4 for ADPCM */
 } WaveFMT;
 
-/* The general chunk found in the WAVE file */
+/* The header of the general chunk found in the WAVE file */
 typedef struct Chunk
 {
     Uint32 magic;
     Uint32 length;
-    Uint8 *data;
 } Chunk;
 
 typedef struct WaveExtensibleFMT
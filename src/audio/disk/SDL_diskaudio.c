@@ -29,6 +29,7 @@
 #endif
 
 #include "SDL_rwops.h"
+#include "SDL_endian.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "../SDL_audio_c.h"
@@ -42,34 +43,116 @@
 #define DISKENVR_INFILE         "SDL_DISKAUDIOFILEIN"
 #define DISKDEFAULT_INFILE      "sdlaudio-in.raw"
 #define DISKENVR_IODELAY      "SDL_DISKAUDIODELAY"
+#define DISKENVR_FREERUN      "SDL_DISKAUDIOFREERUN"
+#define DISKENVR_WAV          "SDL_DISKAUDIOWAV"
+#define DISKENVR_BATCH        "SDL_DISKAUDIOBATCH"
+#define DISKDEFAULT_FREERUN_BATCH  (256 * 1024)
+#define DISKMAX_BATCH  (16 * 1024 * 1024)
+
+#define WAV_HEADER_SIZE  44
+#define WAVE_FORMAT_PCM  0x0001
+#define WAVE_FORMAT_IEEE_FLOAT  0x0003
+
+static SDL_bool
+env_flag(const char *name)
+{
+    const char *envr = SDL_getenv(name);
+    return (envr && *envr && (SDL_atoi(envr) != 0)) ? SDL_TRUE : SDL_FALSE;
+}
+
+static SDL_bool
+is_wav_filename(const char *fname)
+{
+    const size_t len = SDL_strlen(fname);
+    return ((len >= 4) && (SDL_strcasecmp(fname + len - 4, ".wav") == 0)) ? SDL_TRUE : SDL_FALSE;
+}
+
+static int
+write_wav_header(_THIS)
+{
+    SDL_RWops *io = this->hidden->io;
+    const Uint16 bits = (Uint16) SDL_AUDIO_BITSIZE(this->spec.format);
+    const Uint16 block_align = (Uint16) ((bits / 8) * this->spec.channels);
+    const Uint32 datalen = this->hidden->data_written;
+    int ok = 1;
+
+    ok &= (SDL_RWwrite(io, "RIFF", 4, 1) == 1);
+    ok &= SDL_WriteLE32(io, (WAV_HEADER_SIZE - 8) + datalen);
+    ok &= (SDL_RWwrite(io, "WAVEfmt ", 8, 1) == 1);
+    ok &= SDL_WriteLE32(io, 16);
+    ok &= SDL_WriteLE16(io, SDL_AUDIO_ISFLOAT(this->spec.format) ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM);
+    ok &= SDL_WriteLE16(io, this->spec.channels);
+    ok &= SDL_WriteLE32(io, (Uint32) this->spec.freq);
+    ok &= SDL_WriteLE32(io, (Uint32) this->spec.freq * block_align);
+    ok &= SDL_WriteLE16(io, block_align);
+    ok &= SDL_WriteLE16(io, bits);
+    ok &= (SDL_RWwrite(io, "data", 4, 1) == 1);
+    ok &= SDL_WriteLE32(io, datalen);
+
+    return ok ? 0 : SDL_SetError("Couldn't write WAV header");
+}
+
+static int
+flush_mixbuf(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const Uint32 len = h->mixbuf_used;
+
+    if (len == 0) {
+        return 0;
+    }
+
+    h->mixbuf_used = 0;
+    if (SDL_RWwrite(h->io, h->mixbuf, 1, len) != len) {
+        return -1;
+    }
+    h->data_written += len;
+#ifdef DEBUG_AUDIO
+    fprintf(stderr, "Wrote %u bytes of audio data\n", (unsigned int) len);
+#endif
+    return 0;
+}
 
 /* This function waits until it is possible to write a full sound buffer */
 static void
 DISKAUDIO_WaitDevice(_THIS)
 {
-    SDL_Delay(this->hidden->io_delay);
+    if (!this->hidden->freerun) {
+        SDL_Delay(this->hidden->io_delay);
+    }
+}
+
+static void
+DISKAUDIO_BeginLoopIteration(_THIS)
+{
+    /* In freerun mode the thread would otherwise spin out silence as fast
+       as it can while paused, so park it instead. Being paused stops the
+       clock, and the output only holds what the callback produced. */
+    if (this->hidden->freerun) {
+        while (SDL_AtomicGet(&this->paused) && !SDL_AtomicGet(&this->shutdown)) {
+            SDL_Delay(1);
+        }
+    }
 }
 
 static void
 DISKAUDIO_PlayDevice(_THIS)
 {
-    const size_t written = SDL_RWwrite(this->hidden->io,
-                                       this->hidden->mixbuf,
-                                       1, this->spec.size);
+    struct SDL_PrivateAudioData *h = this->hidden;
 
-    /* If we couldn't write, assume fatal error for now */
-    if (written != this->spec.size) {
-        SDL_OpenedAudioDeviceDisconnected(this);
+    h->mixbuf_used += this->spec.size;
+    if ((h->mixbuf_used + this->spec.size) > h->mixbuf_len) {
+        /* If we couldn't write, assume fatal error for now */
+        if (flush_mixbuf(this) < 0) {
+            SDL_OpenedAudioDeviceDisconnected(this);
+        }
     }
-#ifdef DEBUG_AUDIO
-    fprintf(stderr, "Wrote %d bytes of audio data\n", written);
-#endif
 }
 
 static Uint8 *
 DISKAUDIO_GetDeviceBuf(_THIS)
 {
-    return (this->hidden->mixbuf);
+    return (this->hidden->mixbuf + this->hidden->mixbuf_used);
 }
 
 static int
@@ -78,7 +161,9 @@ DISKAUDIO_CaptureFromDevice(_THIS, void *buffer, int buflen)
     struct SDL_PrivateAudioData *h = this->hidden;
     const int origbuflen = buflen;
 
-    SDL_Delay(h->io_delay);
+    if (!h->freerun) {
+        SDL_Delay(h->io_delay);
+    }
 
     if (h->io) {
         const size_t br = SDL_RWread(h->io, buffer, 1, buflen);
@@ -106,8 +191,17 @@ DISKAUDIO_FlushCapture(_THIS)
 static void
 DISKAUDIO_CloseDevice(_THIS)
 {
-    if (this->hidden->io != NULL) {
-        SDL_RWclose(this->hidden->io);
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->io != NULL) {
+        if (!this->iscapture) {
+            flush_mixbuf(this);
+            /* Fill in the sizes, if we can seek back to the header. */
+            if (h->wav && (SDL_RWseek(h->io, 0, RW_SEEK_SET) == 0)) {
+                write_wav_header(this);
+            }
+        }
+        SDL_RWclose(h->io);
     }
     SDL_free(this->hidden->mixbuf);
     SDL_free(this->hidden);
@@ -146,19 +240,50 @@ DISKAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
         this->hidden->io_delay = ((this->spec.samples * 1000) / this->spec.freq);
     }
 
+    this->hidden->freerun = env_flag(DISKENVR_FREERUN);
+    if (!iscapture) {
+        this->hidden->wav = (env_flag(DISKENVR_WAV) || is_wav_filename(fname));
+    }
+
+    if (this->hidden->wav) {
+        /* WAV files are little endian, and only unsigned at 8 bits. */
+        switch (SDL_AUDIO_BITSIZE(this->spec.format)) {
+            case 8: this->spec.format = AUDIO_U8; break;
+            case 16: this->spec.format = AUDIO_S16LSB; break;
+            default:
+                this->spec.format = SDL_AUDIO_ISFLOAT(this->spec.format) ? AUDIO_F32LSB : AUDIO_S32LSB;
+                break;
+        }
+        SDL_CalculateAudioSpec(&this->spec);
+    }
+
     /* Open the audio device */
     this->hidden->io = SDL_RWFromFile(fname, iscapture ? "rb" : "wb");
     if (this->hidden->io == NULL) {
         return -1;
     }
 
-    /* Allocate mixing buffer */
+    /* Allocate mixing buffer, big enough to batch up several writes if asked to. */
     if (!iscapture) {
-        this->hidden->mixbuf = (Uint8 *) SDL_malloc(this->spec.size);
+        Uint32 batch = this->hidden->freerun ? DISKDEFAULT_FREERUN_BATCH : 0;
+        envr = SDL_getenv(DISKENVR_BATCH);
+        if (envr != NULL) {
+            /* ignore anything that isn't a sane positive byte count */
+            const int requested = SDL_atoi(envr);
+            if ((requested > 0) && (requested <= DISKMAX_BATCH)) {
+                batch = (Uint32) requested;
+            }
+        }
+        this->hidden->mixbuf_len = SDL_max(batch - (batch % this->spec.size), this->spec.size);
+        this->hidden->mixbuf = (Uint8 *) SDL_malloc(this->hidden->mixbuf_len);
         if (this->hidden->mixbuf == NULL) {
             return SDL_OutOfMemory();
         }
-        SDL_memset(this->hidden->mixbuf, this->spec.silence, this->spec.size);
+        SDL_memset(this->hidden->mixbuf, this->spec.silence, this->hidden->mixbuf_len);
+
+        if (this->hidden->wav && (write_wav_header(this) < 0)) {
+            return -1;
+        }
     }
 
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO,
@@ -185,6 +310,7 @@ DISKAUDIO_Init(SDL_AudioDriverImpl * impl)
     impl->OpenDevice = DISKAUDIO_OpenDevice;
     impl->WaitDevice = DISKAUDIO_WaitDevice;
     impl->PlayDevice = DISKAUDIO_PlayDevice;
+    impl->BeginLoopIteration = DISKAUDIO_BeginLoopIteration;
     impl->GetDeviceBuf = DISKAUDIO_GetDeviceBuf;
     impl->CaptureFromDevice = DISKAUDIO_CaptureFromDevice;
     impl->FlushCapture = DISKAUDIO_FlushCapture;
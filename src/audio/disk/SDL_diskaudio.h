@@ -35,6 +35,15 @@ struct SDL_PrivateAudioData
     SDL_RWops *io;
     Uint32 io_delay;
     Uint8 *mixbuf;
+
+    /* Playback buffers are handed out of mixbuf until it's full, then it
+       gets written in one go. */
+    Uint32 mixbuf_len;
+    Uint32 mixbuf_used;
+
+    SDL_bool freerun;  /* don't pace to the wall clock, run as fast as possible. */
+    SDL_bool wav;  /* write a WAV header, patched with the data size on close. */
+    Uint32 data_written;
 };
 
 #endif /* SDL_diskaudio_h_ */
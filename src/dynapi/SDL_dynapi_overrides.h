@@ -713,3 +713,33 @@
 #define SDL_RenderCopyF SDL_RenderCopyF_REAL
 #define SDL_RenderCopyExF SDL_RenderCopyExF_REAL
 #define SDL_GetTouchDeviceType SDL_GetTouchDeviceType_REAL
+#define SDL_GetEventQueueStats SDL_GetEventQueueStats_REAL
+#define SDL_ResetEventQueueStats SDL_ResetEventQueueStats_REAL
+#define SDL_AddTimerNS SDL_AddTimerNS_REAL
+#define SDL_CreateJobCounter SDL_CreateJobCounter_REAL
+#define SDL_DestroyJobCounter SDL_DestroyJobCounter_REAL
+#define SDL_GetJobCounterValue SDL_GetJobCounterValue_REAL
+#define SDL_AddJob SDL_AddJob_REAL
+#define SDL_WaitJobCounter SDL_WaitJobCounter_REAL
+#define SDL_GetNumJobThreads SDL_GetNumJobThreads_REAL
+#define SDL_RWFromFileMapped SDL_RWFromFileMapped_REAL
+#define SDL_RWborrow SDL_RWborrow_REAL
+#define SDL_RenderGetStats SDL_RenderGetStats_REAL
+#define SDL_BindAudioStream SDL_BindAudioStream_REAL
+#define SDL_UnbindAudioStream SDL_UnbindAudioStream_REAL
+#define SDL_GetAudioDevicePosition SDL_GetAudioDevicePosition_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_NewWAVDecoder SDL_NewWAVDecoder_REAL
+#define SDL_WAVDecoderRead SDL_WAVDecoderRead_REAL
+#define SDL_WAVDecoderPut SDL_WAVDecoderPut_REAL
+#define SDL_WAVDecoderSeek SDL_WAVDecoderSeek_REAL
+#define SDL_WAVDecoderTell SDL_WAVDecoderTell_REAL
+#define SDL_WAVDecoderLength SDL_WAVDecoderLength_REAL
+#define SDL_FreeWAVDecoder SDL_FreeWAVDecoder_REAL
+#define SDL_ReserveQueuedAudio SDL_ReserveQueuedAudio_REAL
+#define SDL_CommitQueuedAudio SDL_CommitQueuedAudio_REAL
+#define SDL_PeekQueuedAudio SDL_PeekQueuedAudio_REAL
+#define SDL_ConsumeQueuedAudio SDL_ConsumeQueuedAudio_REAL
+#define SDL_AudioStreamSetLockFree SDL_AudioStreamSetLockFree_REAL
+#define SDL_AudioStreamSetRateRatio SDL_AudioStreamSetRateRatio_REAL
+#define SDL_NewCaptureAudioStream SDL_NewCaptureAudioStream_REAL
@@ -767,3 +767,33 @@ SDL_DYNAPI_PROC(int,SDL_RenderFillRectsF,(SDL_Renderer *a, const SDL_FRect *b, i
 SDL_DYNAPI_PROC(int,SDL_RenderCopyF,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_RenderCopyExF,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d, const double e, const SDL_FPoint *f, const SDL_RendererFlip g),(a,b,c,d,e,f,g),return)
 SDL_DYNAPI_PROC(SDL_TouchDeviceType,SDL_GetTouchDeviceType,(SDL_TouchID a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_GetEventQueueStats,(SDL_EventQueueStats *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_ResetEventQueueStats,(void),(),)
+SDL_DYNAPI_PROC(SDL_TimerID,SDL_AddTimerNS,(Uint64 a, SDL_NSTimerCallback b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_JobCounter*,SDL_CreateJobCounter,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetJobCounterValue,(SDL_JobCounter *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AddJob,(SDL_JobFunction a, void *b, SDL_JobCounter *c, SDL_JobCounter *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobThreads,(void),(),return)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromFileMapped,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const void*,SDL_RWborrow,(SDL_RWops *a, size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetStats,(SDL_Renderer *a, SDL_RenderStats *b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_BindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_UnbindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b),(a,b),)
+SDL_DYNAPI_PROC(Uint64,SDL_GetAudioDevicePosition,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_WAVDecoder*,SDL_NewWAVDecoder,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderRead,(SDL_WAVDecoder *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderPut,(SDL_WAVDecoder *a, SDL_AudioStream *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderSeek,(SDL_WAVDecoder *a, Uint32 b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_WAVDecoderTell,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(Uint32,SDL_WAVDecoderLength,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_FreeWAVDecoder,(SDL_WAVDecoder *a),(a),)
+SDL_DYNAPI_PROC(void*,SDL_ReserveQueuedAudio,(SDL_AudioDeviceID a, Uint32 *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_CommitQueuedAudio,(SDL_AudioDeviceID a, Uint32 b),(a,b),return)
+SDL_DYNAPI_PROC(const void*,SDL_PeekQueuedAudio,(SDL_AudioDeviceID a, Uint32 *b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_ConsumeQueuedAudio,(SDL_AudioDeviceID a, Uint32 b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetLockFree,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetRateRatio,(SDL_AudioStream *a, double b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_NewCaptureAudioStream,(SDL_AudioDeviceID a, const SDL_AudioFormat b, const Uint8 c, const int d, int e),(a,b,c,d,e),return)
@@ -73,18 +73,40 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* Events added from any thread go into a bounded ring without taking the
+   queue lock. Whoever holds the lock moves them onto the end of the list, in
+   the order they were added, before looking at it. Everything on the list
+   was added before everything still in the ring. */
+#define SDL_EVENT_RING_SIZE 1024    /* must be a power of two */
+
+typedef struct
+{
+    /* Equal to the lap the slot is on (its position rounded down to a multiple
+       of SDL_EVENT_RING_SIZE) while free, and that plus one once an event is
+       stored in it. This way an all-zero ring starts out empty. */
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
 static struct
 {
     SDL_mutex *lock;
     SDL_atomic_t active;
     SDL_atomic_t count;
-    int max_events_seen;
+    SDL_atomic_t max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+    int type_count[256];    /* events on the list, by the high byte of their type */
+    SDL_atomic_t ring_tail;
+    Uint32 ring_head;
+    SDL_atomic_t locked_pushes;
+    SDL_atomic_t push_retries;
+    SDL_atomic_t lock_contention;
+    SDL_EventRingSlot ring[SDL_EVENT_RING_SIZE];
+} SDL_EventQ = { NULL, { 1 }, { 0 }, { 0 }, NULL, NULL, NULL, NULL, NULL };
 
 
 #ifdef SDL_DEBUG_EVENTS
@@ -310,6 +332,183 @@ SDL_DebugPrintEvent(const SDL_Event *event)
 #endif
 
 
+/* Lock the event queue, counting the times another thread already had it */
+static int
+SDL_LockEventQueue(void)
+{
+    int status;
+
+    if (!SDL_EventQ.lock) {
+        return 0;
+    }
+    status = SDL_TryLockMutex(SDL_EventQ.lock);
+    if (status == SDL_MUTEX_TIMEDOUT) {
+        SDL_AtomicIncRef(&SDL_EventQ.lock_contention);
+        status = SDL_LockMutex(SDL_EventQ.lock);
+    }
+    return status;
+}
+
+static void
+SDL_UnlockEventQueue(void)
+{
+    if (SDL_EventQ.lock) {
+        SDL_UnlockMutex(SDL_EventQ.lock);
+    }
+}
+
+static int
+SDL_EventTypeBucket(Uint32 type)
+{
+    return (type > 0xFFFF) ? 0xFF : (int) (type >> 8);
+}
+
+/* See if the list might hold an event in the type range -- called with the queue locked */
+static SDL_bool
+SDL_HasListedEvents(Uint32 minType, Uint32 maxType)
+{
+    int i;
+
+    if (minType > maxType) {
+        return SDL_FALSE;
+    }
+    for (i = SDL_EventTypeBucket(minType); i <= SDL_EventTypeBucket(maxType); ++i) {
+        if (SDL_EventQ.type_count[i]) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+static void
+SDL_UpdateMaxEventsSeen(int count)
+{
+    int max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+
+    while (count > max_events_seen) {
+        if (SDL_AtomicCAS(&SDL_EventQ.max_events_seen, max_events_seen, count)) {
+            break;
+        }
+        max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    }
+}
+
+/* Put an event on the end of the list -- called with the queue locked */
+static int
+SDL_AppendEvent(const SDL_Event * event)
+{
+    SDL_EventEntry *entry;
+
+    if (SDL_EventQ.free == NULL) {
+        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+        if (!entry) {
+            return 0;
+        }
+    } else {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+    }
+
+    entry->event = *event;
+    if (event->type == SDL_SYSWMEVENT) {
+        entry->msg = *event->syswm.msg;
+        entry->event.syswm.msg = &entry->msg;
+    }
+
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
+    }
+    ++SDL_EventQ.type_count[SDL_EventTypeBucket(event->type)];
+
+    return 1;
+}
+
+/* Add an event to the ring without locking, returns 0 if it's full */
+static int
+SDL_PushEventRing(const SDL_Event * event)
+{
+    for (;;) {
+        const Uint32 pos = (Uint32) SDL_AtomicGet(&SDL_EventQ.ring_tail);
+        const Uint32 lap = pos & ~(SDL_EVENT_RING_SIZE - 1);
+        SDL_EventRingSlot *slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        const int state = (int) ((Uint32) SDL_AtomicGet(&slot->sequence) - lap);
+
+        if (state < 0) {
+            /* Still holding the event from the previous lap */
+            return 0;
+        }
+        if (state == 0 && SDL_AtomicCAS(&SDL_EventQ.ring_tail, (int) pos, (int) (pos + 1))) {
+            slot->event = *event;
+            SDL_AtomicSet(&slot->sequence, (int) (lap + 1));
+            return 1;
+        }
+        /* Another thread took this slot first */
+        SDL_AtomicIncRef(&SDL_EventQ.push_retries);
+    }
+}
+
+/* Take the oldest event out of the ring -- called with the queue locked */
+static int
+SDL_PopEventRing(SDL_Event * event)
+{
+    const Uint32 pos = SDL_EventQ.ring_head;
+    const Uint32 lap = pos & ~(SDL_EVENT_RING_SIZE - 1);
+    SDL_EventRingSlot *slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+
+    if ((Uint32) SDL_AtomicGet(&slot->sequence) != (lap + 1)) {
+        /* Empty, or the thread adding the next event hasn't finished yet */
+        return 0;
+    }
+    *event = slot->event;
+    SDL_AtomicSet(&slot->sequence, (int) (lap + SDL_EVENT_RING_SIZE));
+    SDL_EventQ.ring_head = pos + 1;
+    return 1;
+}
+
+/* Move events from the ring onto the end of the list -- called with the queue locked.
+   If wait is set this doesn't return until every event that was already being
+   added when it was called is on the list, so the caller can add to the list
+   without getting ahead of them. */
+static void
+SDL_DrainEventRing(SDL_bool wait)
+{
+    const Uint32 tail = (Uint32) SDL_AtomicGet(&SDL_EventQ.ring_tail);
+    SDL_Event event;
+
+    for (;;) {
+        if (SDL_PopEventRing(&event)) {
+            if (!SDL_AppendEvent(&event)) {
+                SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            }
+        } else if (wait && (Sint32) (tail - SDL_EventQ.ring_head) > 0) {
+            /* The slot is taken, but the thread adding to it hasn't stored its
+               event yet. Wait for it without the lock, so nobody else is held up;
+               the sequence moves on once the event is in, or if someone else
+               takes it out meanwhile. */
+            const Uint32 pos = SDL_EventQ.ring_head;
+            const Uint32 lap = pos & ~(SDL_EVENT_RING_SIZE - 1);
+            SDL_EventRingSlot *slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+
+            SDL_UnlockEventQueue();
+            while ((Uint32) SDL_AtomicGet(&slot->sequence) == lap) {
+                SDL_Delay(1);
+            }
+            SDL_LockEventQueue();
+        } else {
+            break;
+        }
+    }
+}
+
 
 /* Public functions */
 
@@ -320,6 +519,7 @@ SDL_StopEventLoop(void)
     int i;
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
+    SDL_Event event;
 
     if (SDL_EventQ.lock) {
         SDL_LockMutex(SDL_EventQ.lock);
@@ -329,10 +529,17 @@ SDL_StopEventLoop(void)
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
-                SDL_EventQ.max_events_seen);
+                SDL_AtomicGet(&SDL_EventQ.max_events_seen));
+        SDL_Log("SDL EVENT QUEUE: Locked pushes: %d, push retries: %d, lock contention: %d\n",
+                SDL_AtomicGet(&SDL_EventQ.locked_pushes),
+                SDL_AtomicGet(&SDL_EventQ.push_retries),
+                SDL_AtomicGet(&SDL_EventQ.lock_contention));
     }
 
     /* Clean out EventQ */
+    while (SDL_PopEventRing(&event)) {
+        continue;
+    }
     for (entry = SDL_EventQ.head; entry; ) {
         SDL_EventEntry *next = entry->next;
         SDL_free(entry);
@@ -355,7 +562,11 @@ SDL_StopEventLoop(void)
     }
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_AtomicSet(&SDL_EventQ.max_events_seen, 0);
+    SDL_AtomicSet(&SDL_EventQ.locked_pushes, 0);
+    SDL_AtomicSet(&SDL_EventQ.push_retries, 0);
+    SDL_AtomicSet(&SDL_EventQ.lock_contention, 0);
+    SDL_zero(SDL_EventQ.type_count);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -428,56 +639,51 @@ SDL_StartEventLoop(void)
 }
 
 
+/* Add an event to the event queue without locking, returns 0 if it needs to go through SDL_AddEvent() */
+static int
+SDL_AddEventLockFree(SDL_Event * event)
+{
+    int count;
+
+    if (event->type == SDL_SYSWMEVENT) {
+        return 0;  /* the message has to be copied onto the list entry */
+    }
+
+    count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
+    if (count > SDL_MAX_QUEUED_EVENTS || !SDL_PushEventRing(event)) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        return 0;
+    }
+
+    #ifdef SDL_DEBUG_EVENTS
+    SDL_DebugPrintEvent(event);
+    #endif
+
+    SDL_UpdateMaxEventsSeen(count);
+    return 1;
+}
+
 /* Add an event to the event queue -- called with the queue locked */
 static int
 SDL_AddEvent(SDL_Event * event)
 {
-    SDL_EventEntry *entry;
     const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
 
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (!entry) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+    if (!SDL_AppendEvent(event)) {
+        return 0;
     }
 
     #ifdef SDL_DEBUG_EVENTS
     SDL_DebugPrintEvent(event);
     #endif
 
-    entry->event = *event;
-    if (event->type == SDL_SYSWMEVENT) {
-        entry->msg = *event->syswm.msg;
-        entry->event.syswm.msg = &entry->msg;
-    }
-
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
-    }
-
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
-    }
+    SDL_AtomicIncRef(&SDL_EventQ.locked_pushes);
+    SDL_UpdateMaxEventsSeen(SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1);
 
     return 1;
 }
@@ -502,6 +708,7 @@ SDL_CutEvent(SDL_EventEntry *entry)
         SDL_EventQ.tail = entry->prev;
     }
 
+    --SDL_EventQ.type_count[SDL_EventTypeBucket(entry->event.type)];
     entry->next = SDL_EventQ.free;
     SDL_EventQ.free = entry;
     SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
@@ -523,31 +730,56 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
-    /* Lock the event queue */
+
     used = 0;
-    if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+    if (action == SDL_ADDEVENT) {
+        for (i = 0; i < numevents; ++i) {
+            if (SDL_AddEventLockFree(&events[i])) {
+                ++used;
+                continue;
             }
-        } else {
-            SDL_EventEntry *entry, *next;
-            SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            Uint32 type;
-
-            if (action == SDL_GETEVENT) {
-                /* Clean out any used wmmsg data
-                   FIXME: Do we want to retain the data for some period of time?
-                 */
-                for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
-                    wmmsg_next = wmmsg->next;
-                    wmmsg->next = SDL_EventQ.wmmsg_free;
-                    SDL_EventQ.wmmsg_free = wmmsg;
-                }
-                SDL_EventQ.wmmsg_used = NULL;
+
+            /* The ring is full (or this event can't go in it), add it to the list behind everything in the ring */
+            if (SDL_LockEventQueue() < 0) {
+                return SDL_SetError("Couldn't lock event queue");
+            }
+            SDL_DrainEventRing(SDL_TRUE);
+            used += SDL_AddEvent(&events[i]);
+            SDL_UnlockEventQueue();
+        }
+        return (used);
+    }
+
+    /* Lock the event queue */
+    if (SDL_LockEventQueue() == 0) {
+        SDL_EventEntry *entry, *next;
+        SDL_SysWMEntry *wmmsg, *wmmsg_next;
+        Uint32 type;
+
+        if (action == SDL_GETEVENT) {
+            /* Clean out any used wmmsg data
+               FIXME: Do we want to retain the data for some period of time?
+             */
+            for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
+                wmmsg_next = wmmsg->next;
+                wmmsg->next = SDL_EventQ.wmmsg_free;
+                SDL_EventQ.wmmsg_free = wmmsg;
+            }
+            SDL_EventQ.wmmsg_used = NULL;
+        }
+
+        if (action == SDL_GETEVENT && events && !SDL_EventQ.head &&
+            minType <= SDL_FIRSTEVENT && maxType >= SDL_LASTEVENT) {
+            /* Taking everything in order, so skip the list and read straight out of the ring */
+            while (used < numevents && SDL_PopEventRing(&events[used])) {
+                SDL_AtomicAdd(&SDL_EventQ.count, -1);
+                ++used;
             }
+        } else {
+            SDL_DrainEventRing(SDL_FALSE);
 
-            for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
+            for (entry = SDL_HasListedEvents(minType, maxType) ? SDL_EventQ.head : NULL;
+                 entry && (!events || used < numevents); entry = next) {
                 next = entry->next;
                 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -578,9 +810,7 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                 }
             }
         }
-        if (SDL_EventQ.lock) {
-            SDL_UnlockMutex(SDL_EventQ.lock);
-        }
+        SDL_UnlockEventQueue();
     } else {
         return SDL_SetError("Couldn't lock event queue");
     }
@@ -626,22 +856,43 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 #endif
 
     /* Lock the event queue */
-    if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+    if (SDL_LockEventQueue() == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
-        for (entry = SDL_EventQ.head; entry; entry = next) {
+        SDL_DrainEventRing(SDL_FALSE);
+        for (entry = SDL_HasListedEvents(minType, maxType) ? SDL_EventQ.head : NULL; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
             if (minType <= type && type <= maxType) {
                 SDL_CutEvent(entry);
             }
         }
-        if (SDL_EventQ.lock) {
-            SDL_UnlockMutex(SDL_EventQ.lock);
-        }
+        SDL_UnlockEventQueue();
     }
 }
 
+void
+SDL_GetEventQueueStats(SDL_EventQueueStats * stats)
+{
+    if (!stats) {
+        return;
+    }
+    stats->num_events = SDL_AtomicGet(&SDL_EventQ.count);
+    stats->max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    stats->locked_pushes = (Uint32) SDL_AtomicGet(&SDL_EventQ.locked_pushes);
+    stats->push_retries = (Uint32) SDL_AtomicGet(&SDL_EventQ.push_retries);
+    stats->lock_contention = (Uint32) SDL_AtomicGet(&SDL_EventQ.lock_contention);
+}
+
+void
+SDL_ResetEventQueueStats(void)
+{
+    SDL_AtomicSet(&SDL_EventQ.max_events_seen, SDL_AtomicGet(&SDL_EventQ.count));
+    SDL_AtomicSet(&SDL_EventQ.locked_pushes, 0);
+    SDL_AtomicSet(&SDL_EventQ.push_retries, 0);
+    SDL_AtomicSet(&SDL_EventQ.lock_contention, 0);
+}
+
 /* Run the system dependent event loops */
 void
 SDL_PumpEvents(void)
@@ -861,17 +1112,16 @@ SDL_DelEventWatch(SDL_EventFilter filter, void *userdata)
 void
 SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
-    if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+    if (SDL_LockEventQueue() == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(SDL_FALSE);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
                 SDL_CutEvent(entry);
             }
         }
-        if (SDL_EventQ.lock) {
-            SDL_UnlockMutex(SDL_EventQ.lock);
-        }
+        SDL_UnlockEventQueue();
     }
 }
 
@@ -40,6 +40,14 @@
 #include <limits.h>
 #endif
 
+#if defined(HAVE_MMAP) && !defined(__WIN32__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 /* This file provides a general interface for SDL to read and write
    data sources.  It can easily be extended to files, memory, etc.
 */
@@ -504,6 +512,143 @@ mem_close(SDL_RWops * context)
     return 0;
 }
 
+/* Functions to map files into memory */
+
+static Uint8 mapped_empty[1];
+
+#if defined(__WIN32__) && !defined(__WINRT__)
+#define HAVE_MAPPED_FILES
+
+static void *
+mapped_file_map(const char *file, size_t *size)
+{
+    UINT old_error_mode;
+    HANDLE h, mapping;
+    LARGE_INTEGER filesize;
+    void *data = NULL;
+
+    /* Do not open a dialog box if failure */
+    old_error_mode =
+        SetErrorMode(SEM_NOOPENFILEERRORBOX | SEM_FAILCRITICALERRORS);
+    {
+        LPTSTR tstr = WIN_UTF8ToString(file);
+        h = CreateFile(tstr, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        SDL_free(tstr);
+    }
+    SetErrorMode(old_error_mode);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    if (!GetFileSizeEx(h, &filesize) || (Uint64)filesize.QuadPart > (Uint64)((size_t)-1)) {
+        CloseHandle(h);
+        return NULL;
+    }
+    if (filesize.QuadPart == 0) {
+        CloseHandle(h);
+        *size = 0;
+        return mapped_empty;
+    }
+
+    /* The view keeps the file open, the handles aren't needed anymore */
+    mapping = CreateFileMapping(h, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping) {
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+    }
+    CloseHandle(h);
+
+    if (data) {
+        *size = (size_t)filesize.QuadPart;
+    }
+    return data;
+}
+
+static void
+mapped_file_unmap(void *data, size_t size)
+{
+    UnmapViewOfFile(data);
+}
+
+#elif defined(HAVE_MMAP)
+#define HAVE_MAPPED_FILES
+
+static void *
+mapped_file_map(const char *file, size_t *size)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+#if defined(__ANDROID__) || defined(__APPLE__)
+    /* Relative paths may refer to assets or bundle resources */
+    if (*file != '/') {
+        return NULL;
+    }
+#endif
+
+    fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) ||
+        (Uint64)st.st_size > (Uint64)((size_t)-1)) {
+        close(fd);
+        return NULL;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        *size = 0;
+        return mapped_empty;
+    }
+
+    /* The mapping keeps the file open, the descriptor isn't needed anymore */
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (size_t)st.st_size;
+    return data;
+}
+
+static void
+mapped_file_unmap(void *data, size_t size)
+{
+    munmap(data, size);
+}
+
+#endif /* HAVE_MMAP */
+
+#ifdef HAVE_MAPPED_FILES
+static int SDLCALL
+mapped_close(SDL_RWops * context)
+{
+    if (context) {
+        if (context->hidden.mem.base != mapped_empty) {
+            mapped_file_unmap(context->hidden.mem.base,
+                (size_t)(context->hidden.mem.stop - context->hidden.mem.base));
+        }
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+#endif /* HAVE_MAPPED_FILES */
+
+static int SDLCALL
+loaded_close(SDL_RWops * context)
+{
+    if (context) {
+        if (context->hidden.mem.base != mapped_empty) {
+            SDL_free(context->hidden.mem.base);
+        }
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+
 
 /* Functions to create SDL_RWops structures from various data sources */
 
@@ -679,6 +824,87 @@ SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *
+SDL_RWFromFileMapped(const char *file)
+{
+    SDL_RWops *rwops = NULL;
+    void *data = NULL;
+    size_t size = 0;
+    int (SDLCALL * closefunc) (SDL_RWops * context) = loaded_close;
+
+    if (!file || !*file) {
+        SDL_SetError("SDL_RWFromFileMapped(): No file specified");
+        return NULL;
+    }
+
+#ifdef HAVE_MAPPED_FILES
+    data = mapped_file_map(file, &size);
+    if (data) {
+        closefunc = mapped_close;
+    }
+#endif
+    if (!data) {
+        /* Fall back to reading the whole file into memory */
+        data = SDL_LoadFile(file, &size);
+        if (!data) {
+            return NULL;
+        }
+        if (size == 0) {
+            SDL_free(data);
+            data = mapped_empty;
+        }
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        if (closefunc == loaded_close) {
+            if (data != mapped_empty) {
+                SDL_free(data);
+            }
+#ifdef HAVE_MAPPED_FILES
+        } else if (data != mapped_empty) {
+            mapped_file_unmap(data, size);
+#endif
+        }
+        return NULL;
+    }
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+    rwops->close = closefunc;
+    rwops->hidden.mem.base = (Uint8 *) data;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+    rwops->type = SDL_RWOPS_MAPPED;
+    return rwops;
+}
+
+const void *
+SDL_RWborrow(SDL_RWops * context, size_t *available)
+{
+    if (available) {
+        *available = 0;
+    }
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPPED:
+        if (available) {
+            *available = (size_t)(context->hidden.mem.stop - context->hidden.mem.here);
+        }
+        return context->hidden.mem.here;
+    default:
+        SDL_SetError("Stream isn't backed by memory");
+        return NULL;
+    }
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -713,6 +939,30 @@ SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize, int freesrc)
         return NULL;
     }
 
+    /* Memory backed streams can be copied out in one go */
+    switch (src->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPPED:
+        {
+            const void *mem = SDL_RWborrow(src, &size_total);
+            data = SDL_malloc(size_total + 1);
+            if (!data) {
+                SDL_OutOfMemory();
+                goto done;
+            }
+            SDL_memcpy(data, mem, size_total);
+            SDL_RWseek(src, 0, RW_SEEK_END);
+            if (datasize) {
+                *datasize = size_total;
+            }
+            ((char *)data)[size_total] = '\0';
+            goto done;
+        }
+    default:
+        break;
+    }
+
     size = SDL_RWsize(src);
     if (size < 0) {
         size = FILE_CHUNK_SIZE;
@@ -26,6 +26,7 @@
 #include "SDL_hints.h"
 #include "SDL_log.h"
 #include "SDL_render.h"
+#include "SDL_timer.h"
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 
@@ -196,11 +197,37 @@ DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+static void
+CountRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderStats *stats = &renderer->stats;
+    const SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_NO_OP: stats->noop_commands++; break;
+            case SDL_RENDERCMD_SETVIEWPORT: stats->viewport_commands++; break;
+            case SDL_RENDERCMD_SETCLIPRECT: stats->cliprect_commands++; break;
+            case SDL_RENDERCMD_SETDRAWCOLOR: stats->drawcolor_commands++; break;
+            case SDL_RENDERCMD_CLEAR: stats->clear_commands++; break;
+            case SDL_RENDERCMD_DRAW_POINTS: stats->point_commands++; break;
+            case SDL_RENDERCMD_DRAW_LINES: stats->line_commands++; break;
+            case SDL_RENDERCMD_FILL_RECTS: stats->fillrect_commands++; break;
+            case SDL_RENDERCMD_COPY: stats->copy_commands++; break;
+            case SDL_RENDERCMD_COPY_EX: stats->copyex_commands++; break;
+        }
+        stats->commands++;
+    }
+    stats->vertex_bytes += renderer->vertex_data_used;
+    stats->flushes++;
+}
+
 static int
 FlushRenderCommands(SDL_Renderer *renderer)
 {
     SDL_AllocVertGap *prevgap = &renderer->vertex_data_gaps;
     SDL_AllocVertGap *gap = prevgap;
+    Uint64 start;
     int retval;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
@@ -211,8 +238,11 @@ FlushRenderCommands(SDL_Renderer *renderer)
     }
 
     DebugLogRenderCommands(renderer->render_commands);
+    CountRenderCommands(renderer);
 
+    start = SDL_GetPerformanceCounter();
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    renderer->stats.run_ticks += SDL_GetPerformanceCounter() - start;
 
     while (gap) {
         prevgap = gap;
@@ -243,6 +273,9 @@ FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
     SDL_Renderer *renderer = texture->renderer;
     if (texture->last_command_generation == renderer->render_command_generation) {
         /* the current command queue depends on this texture, flush the queue now before it changes */
+        if (renderer->render_commands) {
+            renderer->stats.texture_flushes++;
+        }
         return FlushRenderCommands(renderer);
     }
     return 0;
@@ -260,6 +293,18 @@ SDL_RenderFlush(SDL_Renderer * renderer)
     return FlushRenderCommands(renderer);
 }
 
+int
+SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats * stats, SDL_bool last_frame)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    *stats = last_frame ? renderer->last_stats : renderer->stats;
+    return 0;
+}
+
 static SDL_AllocVertGap *
 AllocateVertexGap(SDL_Renderer *renderer)
 {
@@ -320,6 +365,7 @@ SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const
             if (offset) {
                 *offset = aligned;
             }
+            renderer->stats.vertex_gap_reuses++;
             return ((Uint8 *) renderer->vertex_data) + aligned;
         }
 
@@ -412,6 +458,8 @@ QueueCmdSetViewport(SDL_Renderer *renderer)
                 renderer->viewport_queued = SDL_TRUE;
             }
         }
+    } else {
+        renderer->stats.elided_state_changes++;
     }
     return retval;
 }
@@ -434,6 +482,8 @@ QueueCmdSetClipRect(SDL_Renderer *renderer)
             renderer->last_queued_cliprect_enabled = renderer->clipping_enabled;
             renderer->cliprect_queued = SDL_TRUE;
         }
+    } else {
+        renderer->stats.elided_state_changes++;
     }
     return retval;
 }
@@ -463,6 +513,8 @@ QueueCmdSetDrawColor(SDL_Renderer *renderer, const Uint8 r, const Uint8 g, const
                 renderer->color_queued = SDL_TRUE;
             }
         }
+    } else {
+        renderer->stats.elided_state_changes++;
     }
     return retval;
 }
@@ -3077,6 +3129,11 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
+    /* Start gathering statistics for the next frame */
+    renderer->last_stats = renderer->stats;
+    SDL_zero(renderer->stats);
+    renderer->stats.frame = renderer->last_stats.frame + 1;
+
     /* Don't present while we're hidden */
     if (renderer->hidden) {
         return;
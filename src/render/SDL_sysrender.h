@@ -229,6 +229,9 @@ struct SDL_Renderer
     SDL_AllocVertGap vertex_data_gaps;
     SDL_AllocVertGap *vertex_data_gaps_pool;
 
+    SDL_RenderStats stats;
+    SDL_RenderStats last_stats;
+
     void *driverdata;
 };
 
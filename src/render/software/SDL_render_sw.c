@@ -26,6 +26,10 @@
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_thread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -37,10 +41,44 @@
 
 /* SDL surface based renderer implementation */
 
+/* The size of the screen tiles used by the tiled command queue */
+#define SW_TILE_SIZE    128
+
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect clip;              /* surface clip rect in effect for this command */
+    SDL_BlitInfo info;          /* snapshot of the source blit state (COPY only) */
+    SDL_BlitFunc blit;          /* blitter chosen for the source (COPY only) */
+    int tx0, ty0, tx1, ty1;     /* tiles touched by this command, inclusive */
+} SW_TileOp;
+
+typedef struct
+{
+    SDL_JobCounter *jobs;
+    int num_threads;
+    SDL_atomic_t next_tile;
+
+    /* The batch of commands currently being binned / rasterized */
+    SDL_Surface *surface;
+    const void *vertices;
+    SW_TileOp *ops;
+    int num_ops;
+    int max_ops;
+    int tiles_x;
+    int tiles_y;
+    int *bin_offsets;           /* tiles_x * tiles_y + 1 entries */
+    int max_tiles;
+    int *bins;                  /* op indices, grouped by tile, in submission order */
+    int max_bins;
+} SW_TileContext;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SDL_bool tiled;
+    SW_TileContext *tiles;
 } SW_RenderData;
 
 
@@ -418,7 +456,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
-            retval = SDL_BlitScaled(src_clone, srcrect, src_scaled, &scale_rect);
+            retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect, texture->scaleMode);
             SDL_FreeSurface(src_clone);
             src_clone = src_scaled;
             src_scaled = NULL;
@@ -568,19 +606,512 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+/* Tiled command queue execution.
+
+   When SDL_HINT_RENDER_SOFTWARE_TILED is enabled, drawing commands whose
+   result for a pixel doesn't depend on how the clip rectangle is split up
+   (clears, fills, points and unscaled copies) are binned into screen tiles
+   and rasterized on the shared job pool. Each tile runs its commands
+   in submission order, so every pixel sees the same sequence of operations
+   as the serial path. Anything else (lines, scaled and rotated copies, RLE
+   sources) flushes the pending tiles and runs serially on the calling thread.
+*/
+
+static void
+SW_RunTileOp(const SW_TileOp *op, SDL_Surface *view, const void *vertices)
+{
+    const SDL_RenderCommand *cmd = op->cmd;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            const Uint8 r = cmd->data.color.r;
+            const Uint8 g = cmd->data.color.g;
+            const Uint8 b = cmd->data.color.b;
+            const Uint8 a = cmd->data.color.a;
+            SDL_FillRect(view, NULL, SDL_MapRGBA(view->format, r, g, b, a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (const SDL_Point *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(view, verts, count, SDL_MapRGBA(view->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(view, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(view, verts, count, SDL_MapRGBA(view->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(view, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_Rect *srcrect = verts;
+            const SDL_Rect *dstrect = verts + 1;
+            const SDL_Surface *src = (const SDL_Surface *) cmd->data.draw.texture->driverdata;
+            const SDL_Rect *clip = &view->clip_rect;
+            SDL_BlitInfo info = op->info;
+            int srcx, srcy, dstx, dsty, w, h, maxw, maxh, dx, dy;
+
+            /* Same clipping as SDL_UpperBlit(), against this tile's clip rect */
+            dstx = dstrect->x;
+            dsty = dstrect->y;
+            srcx = srcrect->x;
+            w = srcrect->w;
+            if (srcx < 0) {
+                w += srcx;
+                dstx -= srcx;
+                srcx = 0;
+            }
+            maxw = src->w - srcx;
+            if (maxw < w) {
+                w = maxw;
+            }
+            srcy = srcrect->y;
+            h = srcrect->h;
+            if (srcy < 0) {
+                h += srcy;
+                dsty -= srcy;
+                srcy = 0;
+            }
+            maxh = src->h - srcy;
+            if (maxh < h) {
+                h = maxh;
+            }
+
+            dx = clip->x - dstx;
+            if (dx > 0) {
+                w -= dx;
+                dstx += dx;
+                srcx += dx;
+            }
+            dx = dstx + w - clip->x - clip->w;
+            if (dx > 0) {
+                w -= dx;
+            }
+            dy = clip->y - dsty;
+            if (dy > 0) {
+                h -= dy;
+                dsty += dy;
+                srcy += dy;
+            }
+            dy = dsty + h - clip->y - clip->h;
+            if (dy > 0) {
+                h -= dy;
+            }
+
+            if (w <= 0 || h <= 0) {
+                break;
+            }
+
+            /* Same setup as SDL_SoftBlit(), but on a private copy of the blit info */
+            info.src = (Uint8 *) src->pixels + srcy * src->pitch + srcx * info.src_fmt->BytesPerPixel;
+            info.src_w = w;
+            info.src_h = h;
+            info.src_pitch = src->pitch;
+            info.src_skip = info.src_pitch - w * info.src_fmt->BytesPerPixel;
+            info.dst = (Uint8 *) view->pixels + dsty * view->pitch + dstx * info.dst_fmt->BytesPerPixel;
+            info.dst_w = w;
+            info.dst_h = h;
+            info.dst_pitch = view->pitch;
+            info.dst_skip = info.dst_pitch - w * info.dst_fmt->BytesPerPixel;
+            op->blit(&info);
+            break;
+        }
+
+        default:
+            SDL_assert(!"Unexpected command in a tile");
+            break;
+    }
+}
+
+static void
+SW_RunTiles(SW_TileContext *ctx)
+{
+    const int num_tiles = ctx->tiles_x * ctx->tiles_y;
+    SDL_Surface *surface = ctx->surface;
+    int tile;
+
+    while ((tile = SDL_AtomicAdd(&ctx->next_tile, 1)) < num_tiles) {
+        const int first = ctx->bin_offsets[tile];
+        const int last = ctx->bin_offsets[tile + 1];
+        SDL_Surface view;
+        SDL_Rect tile_rect;
+        int i;
+
+        if (first == last) {
+            continue;
+        }
+
+        tile_rect.x = (tile % ctx->tiles_x) * SW_TILE_SIZE;
+        tile_rect.y = (tile / ctx->tiles_x) * SW_TILE_SIZE;
+        tile_rect.w = SDL_min(SW_TILE_SIZE, surface->w - tile_rect.x);
+        tile_rect.h = SDL_min(SW_TILE_SIZE, surface->h - tile_rect.y);
+
+        /* A private header for the target, so each tile can have its own clip rect */
+        SDL_memcpy(&view, surface, sizeof (view));
+
+        for (i = first; i < last; ++i) {
+            const SW_TileOp *op = &ctx->ops[ctx->bins[i]];
+            if (SDL_IntersectRect(&op->clip, &tile_rect, &view.clip_rect)) {
+                SW_RunTileOp(op, &view, ctx->vertices);
+            }
+        }
+    }
+}
+
+static void SDLCALL
+SW_TileJob(void *userdata)
+{
+    SW_RunTiles((SW_TileContext *) userdata);
+}
+
+static void
+SW_DestroyTileContext(SW_TileContext *ctx)
+{
+    if (!ctx) {
+        return;
+    }
+
+    SDL_DestroyJobCounter(ctx->jobs);
+    SDL_free(ctx->ops);
+    SDL_free(ctx->bin_offsets);
+    SDL_free(ctx->bins);
+    SDL_free(ctx);
+}
+
+static SW_TileContext *
+SW_CreateTileContext(void)
+{
+    SW_TileContext *ctx;
+
+    ctx = (SW_TileContext *) SDL_calloc(1, sizeof (*ctx));
+    if (!ctx) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    ctx->jobs = SDL_CreateJobCounter();
+    ctx->num_threads = SDL_GetNumJobThreads();
+    if (!ctx->jobs || ctx->num_threads == 0) {
+        SW_DestroyTileContext(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static SDL_bool
+SW_CommandDraws(const SDL_RenderCommand *cmd)
+{
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+            return SDL_TRUE;
+        default:
+            return SDL_FALSE;
+    }
+}
+
+/* Queue a drawing command for tiled rasterization.
+   Returns SDL_FALSE if the command has to run serially instead. */
+static SDL_bool
+SW_AddTileOp(SW_TileContext *ctx, SDL_Surface *surface, const SDL_RenderCommand *cmd, const void *vertices)
+{
+    SW_TileOp *op;
+    SDL_Rect bounds;
+
+    if (ctx->num_ops == ctx->max_ops) {
+        const int max_ops = ctx->max_ops ? (ctx->max_ops * 2) : 64;
+        SW_TileOp *ops = (SW_TileOp *) SDL_realloc(ctx->ops, max_ops * sizeof (SW_TileOp));
+        if (!ops) {
+            return SDL_FALSE;
+        }
+        ctx->ops = ops;
+        ctx->max_ops = max_ops;
+    }
+    op = &ctx->ops[ctx->num_ops];
+    op->cmd = cmd;
+    op->clip = surface->clip_rect;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            /* By definition the clear ignores the clip rect */
+            op->clip.x = op->clip.y = 0;
+            op->clip.w = surface->w;
+            op->clip.h = surface->h;
+            bounds = op->clip;
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const size_t count = cmd->data.draw.count;
+            const SDL_Point *verts = (const SDL_Point *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            int minx, miny, maxx, maxy;
+            size_t i;
+
+            if (count == 0) {
+                return SDL_TRUE;  /* nothing to draw */
+            }
+            minx = maxx = verts[0].x;
+            miny = maxy = verts[0].y;
+            for (i = 1; i < count; ++i) {
+                minx = SDL_min(minx, verts[i].x);
+                maxx = SDL_max(maxx, verts[i].x);
+                miny = SDL_min(miny, verts[i].y);
+                maxy = SDL_max(maxy, verts[i].y);
+            }
+            bounds.x = minx;
+            bounds.y = miny;
+            bounds.w = (maxx - minx) + 1;
+            bounds.h = (maxy - miny) + 1;
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            int i;
+
+            if (count == 0) {
+                return SDL_TRUE;  /* nothing to draw */
+            }
+            bounds = verts[0];
+            for (i = 1; i < count; ++i) {
+                SDL_UnionRect(&bounds, &verts[i], &bounds);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_Rect *srcrect = verts;
+            const SDL_Rect *dstrect = verts + 1;
+            SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+            SDL_BlitMap *map = src->map;
+
+            if (srcrect->w != dstrect->w || srcrect->h != dstrect->h) {
+                return SDL_FALSE;  /* scaled blits sample differently when clipped */
+            }
+            if (src->locked || surface->locked) {
+                return SDL_FALSE;  /* let SDL_UpperBlit() report the error */
+            }
+
+            /* Set up the blit mapping exactly as SDL_UpperBlit() would */
+            PrepTextureForCopy(cmd);
+            if (map->info.flags & SDL_COPY_NEAREST) {
+                map->info.flags &= ~SDL_COPY_NEAREST;
+                SDL_InvalidateMap(map);
+            }
+            if ((map->dst != surface) ||
+                (surface->format->palette &&
+                 map->dst_palette_version != surface->format->palette->version) ||
+                (src->format->palette &&
+                 map->src_palette_version != src->format->palette->version)) {
+                if (SDL_MapSurface(src, surface) < 0) {
+                    return SDL_FALSE;
+                }
+            }
+
+            /* RLE sources don't keep their pixels around, and lookup tables
+               are freed whenever the mapping changes, so those run serially. */
+            if ((src->flags & SDL_RLEACCEL) || (map->info.flags & SDL_COPY_RLE_MASK) ||
+                map->info.table || !map->data || !src->pixels) {
+                return SDL_FALSE;
+            }
+
+            op->info = map->info;
+            op->blit = (SDL_BlitFunc) map->data;
+            bounds = *dstrect;
+            break;
+        }
+
+        default:
+            return SDL_FALSE;
+    }
+
+    if (!SDL_IntersectRect(&bounds, &op->clip, &bounds)) {
+        return SDL_TRUE;  /* entirely clipped, nothing to draw */
+    }
+
+    op->tx0 = bounds.x / SW_TILE_SIZE;
+    op->ty0 = bounds.y / SW_TILE_SIZE;
+    op->tx1 = (bounds.x + bounds.w - 1) / SW_TILE_SIZE;
+    op->ty1 = (bounds.y + bounds.h - 1) / SW_TILE_SIZE;
+    ctx->num_ops++;
+    return SDL_TRUE;
+}
+
+/* Rasterize all the queued tile ops and wait for them to finish */
+static void
+SW_FlushTileOps(SW_TileContext *ctx)
+{
+    const int num_tiles = ctx->tiles_x * ctx->tiles_y;
+    int *offsets;
+    int total, i, tx, ty;
+
+    if (ctx->num_ops == 0) {
+        return;
+    }
+
+    /* Count the ops per tile, then lay the bins out in one array */
+    offsets = ctx->bin_offsets;
+    SDL_memset(offsets, 0, (num_tiles + 1) * sizeof (int));
+    for (i = 0; i < ctx->num_ops; ++i) {
+        const SW_TileOp *op = &ctx->ops[i];
+        for (ty = op->ty0; ty <= op->ty1; ++ty) {
+            for (tx = op->tx0; tx <= op->tx1; ++tx) {
+                offsets[ty * ctx->tiles_x + tx + 1]++;
+            }
+        }
+    }
+    for (i = 0; i < num_tiles; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    total = offsets[num_tiles];
+
+    if (total > ctx->max_bins) {
+        int *bins = (int *) SDL_realloc(ctx->bins, total * sizeof (int));
+        if (!bins) {
+            /* Run everything as a single tile spanning the whole target */
+            SDL_OutOfMemory();
+            total = 0;
+        } else {
+            ctx->bins = bins;
+            ctx->max_bins = total;
+        }
+    }
+
+    if (total > 0) {
+        /* Fill the bins in submission order, using offsets as cursors */
+        for (i = 0; i < ctx->num_ops; ++i) {
+            const SW_TileOp *op = &ctx->ops[i];
+            for (ty = op->ty0; ty <= op->ty1; ++ty) {
+                for (tx = op->tx0; tx <= op->tx1; ++tx) {
+                    ctx->bins[offsets[ty * ctx->tiles_x + tx]++] = i;
+                }
+            }
+        }
+        /* The cursors now point at the end of each bin, shift them back */
+        for (i = num_tiles; i > 0; --i) {
+            offsets[i] = offsets[i - 1];
+        }
+        offsets[0] = 0;
+
+        /* The rendering thread works on tiles too */
+        SDL_AtomicSet(&ctx->next_tile, 0);
+        for (i = 0; i < ctx->num_threads; ++i) {
+            if (SDL_AddJob(SW_TileJob, ctx, ctx->jobs, NULL) < 0) {
+                break;
+            }
+        }
+        SW_RunTiles(ctx);
+        SDL_WaitJobCounter(ctx->jobs);
+    } else {
+        SDL_Surface view;
+        SDL_memcpy(&view, ctx->surface, sizeof (view));
+        for (i = 0; i < ctx->num_ops; ++i) {
+            view.clip_rect = ctx->ops[i].clip;
+            SW_RunTileOp(&ctx->ops[i], &view, ctx->vertices);
+        }
+    }
+
+    ctx->num_ops = 0;
+}
+
+/* Prepare the tile context for a command queue, or return NULL to run serially */
+static SW_TileContext *
+SW_BeginTiles(SW_RenderData *data, SDL_Surface *surface, const void *vertices)
+{
+    SW_TileContext *ctx;
+    int tiles_x, tiles_y;
+
+    if (!data->tiled || SDL_MUSTLOCK(surface) || !surface->pixels) {
+        return NULL;
+    }
+
+    tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    if ((tiles_x * tiles_y) < 2) {
+        return NULL;  /* not worth waking up the workers */
+    }
+
+    if (!data->tiles) {
+        data->tiles = SW_CreateTileContext();
+        if (!data->tiles) {
+            data->tiled = SDL_FALSE;
+            return NULL;
+        }
+    }
+    ctx = data->tiles;
+
+    if ((tiles_x * tiles_y) > ctx->max_tiles) {
+        int *offsets = (int *) SDL_realloc(ctx->bin_offsets, (tiles_x * tiles_y + 1) * sizeof (int));
+        if (!offsets) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        ctx->bin_offsets = offsets;
+        ctx->max_tiles = tiles_x * tiles_y;
+    }
+
+    ctx->surface = surface;
+    ctx->vertices = vertices;
+    ctx->tiles_x = tiles_x;
+    ctx->tiles_y = tiles_y;
+    ctx->num_ops = 0;
+    return ctx;
+}
+
 static int
 SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    const SDL_Rect *viewport = NULL;
+    SW_TileContext *tiles;
+    /* A queue flushed by SDL_RenderSetClipRect() doesn't start with a viewport command */
+    const SDL_Rect *viewport = &renderer->viewport;
     const SDL_Rect *cliprect = NULL;
 
     if (!surface) {
         return -1;
     }
 
+    tiles = SW_BeginTiles(data, surface, vertices);
+
     while (cmd) {
+        if (tiles && SW_CommandDraws(cmd)) {
+            if (SW_AddTileOp(tiles, surface, cmd, vertices)) {
+                cmd = cmd->next;
+                continue;
+            }
+            /* This one runs serially, after everything queued before it */
+            SW_FlushTileOps(tiles);
+        }
+
         switch (cmd->command) {
             case SDL_RENDERCMD_SETDRAWCOLOR: {
                 break;  /* Not used in this backend. */
@@ -593,7 +1124,6 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
             }
 
             case SDL_RENDERCMD_SETCLIPRECT: {
-                SDL_assert(viewport != NULL);
                 cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
                 if (cliprect) {
                     SDL_Rect clip_rect;
@@ -686,7 +1216,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                      * to avoid potentially frequent RLE encoding/decoding.
                      */
                     SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+                    SDL_PrivateUpperBlitScaled(src, srcrect, surface, dstrect, texture->scaleMode);
                 }
                 break;
             }
@@ -706,6 +1236,10 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
         cmd = cmd->next;
     }
 
+    if (tiles) {
+        SW_FlushTileOps(tiles);
+    }
+
     return 0;
 }
 
@@ -763,6 +1297,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_DestroyTileContext(data->tiles);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -792,6 +1329,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->tiled = SDL_GetHintBoolean(SDL_HINT_RENDER_SOFTWARE_TILED, SDL_FALSE);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -0,0 +1,621 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* The shared job pool */
+
+#include "SDL_thread.h"
+#include "SDL_atomic.h"
+#include "SDL_assert.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_systhread.h"
+
+/* The number of jobs each worker can queue locally, must be a power of two */
+#define SDL_JOB_DEQUE_SIZE  1024
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction function;
+    void *data;
+    SDL_JobCounter *counter;
+    struct SDL_Job *next;
+} SDL_Job;
+
+struct SDL_JobCounter
+{
+    SDL_atomic_t value;
+    SDL_SpinLock lock;
+    SDL_Job *pending;   /* jobs waiting for the value to reach zero */
+};
+
+/* A work-stealing deque (Chase and Lev): the owning worker pushes and pops
+   at the bottom, other threads steal from the top. The indices only ever
+   grow, and are compared through unsigned differences so they can wrap. */
+typedef struct
+{
+    SDL_atomic_t top;
+    SDL_atomic_t bottom;
+    void *slots[SDL_JOB_DEQUE_SIZE];
+} SDL_JobDeque;
+
+typedef struct SDL_JobPool SDL_JobPool;
+
+typedef struct
+{
+    SDL_JobPool *pool;
+    int index;
+    SDL_Thread *thread;
+    SDL_JobDeque deque;
+} SDL_JobWorker;
+
+struct SDL_JobPool
+{
+    SDL_JobWorker *workers;
+    int num_workers;
+    SDL_atomic_t quit;
+
+    /* Jobs added from outside the pool, or when a worker's deque is full */
+    SDL_SpinLock queue_lock;
+    SDL_Job *queue_head;
+    SDL_Job *queue_tail;
+    SDL_atomic_t queue_count;
+
+    /* Idle workers sleep on the semaphore, waiting threads on the condition */
+    SDL_sem *work_sem;
+    SDL_atomic_t sleeping;
+    SDL_mutex *wait_lock;
+    SDL_cond *wait_cond;
+    SDL_atomic_t waiting;
+
+    SDL_SpinLock free_lock;
+    SDL_Job *free_jobs;
+};
+
+static SDL_SpinLock SDL_job_pool_lock;
+static SDL_JobPool *SDL_job_pool;
+static SDL_TLSID SDL_job_worker_tls;
+
+
+static SDL_bool
+SDL_PushJobDeque(SDL_JobDeque *deque, SDL_Job *job)
+{
+    const Uint32 b = (Uint32) SDL_AtomicGet(&deque->bottom);
+    const Uint32 t = (Uint32) SDL_AtomicGet(&deque->top);
+
+    if ((b - t) >= SDL_JOB_DEQUE_SIZE) {
+        return SDL_FALSE;
+    }
+    SDL_AtomicSetPtr(&deque->slots[b & (SDL_JOB_DEQUE_SIZE - 1)], job);
+    SDL_AtomicSet(&deque->bottom, (int) (b + 1));
+    return SDL_TRUE;
+}
+
+static SDL_Job *
+SDL_PopJobDeque(SDL_JobDeque *deque)
+{
+    const Uint32 b = (Uint32) SDL_AtomicGet(&deque->bottom) - 1;
+    Uint32 t;
+    SDL_Job *job;
+
+    /* Claim the bottom slot before looking at the top, so a thief that
+       takes the same job afterwards sees the deque as empty. */
+    SDL_AtomicSet(&deque->bottom, (int) b);
+    t = (Uint32) SDL_AtomicGet(&deque->top);
+    if ((int) (b - t) < 0) {
+        SDL_AtomicSet(&deque->bottom, (int) (b + 1));
+        return NULL;
+    }
+
+    job = (SDL_Job *) SDL_AtomicGetPtr(&deque->slots[b & (SDL_JOB_DEQUE_SIZE - 1)]);
+    if (b == t) {
+        /* The last job, race the thieves for it */
+        if (!SDL_AtomicCAS(&deque->top, (int) t, (int) (t + 1))) {
+            job = NULL;
+        }
+        SDL_AtomicSet(&deque->bottom, (int) (b + 1));
+    }
+    return job;
+}
+
+static SDL_Job *
+SDL_StealJobDeque(SDL_JobDeque *deque)
+{
+    const Uint32 t = (Uint32) SDL_AtomicGet(&deque->top);
+    const Uint32 b = (Uint32) SDL_AtomicGet(&deque->bottom);
+    SDL_Job *job;
+
+    if ((int) (b - t) <= 0) {
+        return NULL;
+    }
+    job = (SDL_Job *) SDL_AtomicGetPtr(&deque->slots[t & (SDL_JOB_DEQUE_SIZE - 1)]);
+    if (!SDL_AtomicCAS(&deque->top, (int) t, (int) (t + 1))) {
+        return NULL;  /* somebody else got it */
+    }
+    return job;
+}
+
+static SDL_bool
+SDL_JobDequeEmpty(SDL_JobDeque *deque)
+{
+    const Uint32 t = (Uint32) SDL_AtomicGet(&deque->top);
+    const Uint32 b = (Uint32) SDL_AtomicGet(&deque->bottom);
+    return ((int) (b - t) <= 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+static SDL_bool
+SDL_HasJobs(SDL_JobPool *pool)
+{
+    int i;
+
+    if (SDL_AtomicGet(&pool->queue_count) > 0) {
+        return SDL_TRUE;
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        if (!SDL_JobDequeEmpty(&pool->workers[i].deque)) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* Wake up the threads waiting on a counter, so they can help out or return */
+static void
+SDL_WakeJobWaiters(SDL_JobPool *pool)
+{
+    if (SDL_AtomicGet(&pool->waiting) > 0) {
+        SDL_LockMutex(pool->wait_lock);
+        SDL_CondBroadcast(pool->wait_cond);
+        SDL_UnlockMutex(pool->wait_lock);
+    }
+}
+
+static void
+SDL_SubmitJob(SDL_JobPool *pool, SDL_Job *job)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *) SDL_TLSGet(SDL_job_worker_tls);
+
+    if (!worker || worker->pool != pool || !SDL_PushJobDeque(&worker->deque, job)) {
+        job->next = NULL;
+        SDL_AtomicLock(&pool->queue_lock);
+        if (pool->queue_tail) {
+            pool->queue_tail->next = job;
+        } else {
+            pool->queue_head = job;
+        }
+        pool->queue_tail = job;
+        SDL_AtomicIncRef(&pool->queue_count);
+        SDL_AtomicUnlock(&pool->queue_lock);
+    }
+
+    if (SDL_AtomicGet(&pool->sleeping) > 0) {
+        SDL_SemPost(pool->work_sem);
+    }
+    SDL_WakeJobWaiters(pool);
+}
+
+static SDL_Job *
+SDL_FindJob(SDL_JobPool *pool, SDL_JobWorker *self)
+{
+    SDL_Job *job = NULL;
+    int first, i;
+
+    if (self) {
+        job = SDL_PopJobDeque(&self->deque);
+        if (job) {
+            return job;
+        }
+    }
+
+    if (SDL_AtomicGet(&pool->queue_count) > 0) {
+        SDL_AtomicLock(&pool->queue_lock);
+        job = pool->queue_head;
+        if (job) {
+            pool->queue_head = job->next;
+            if (!pool->queue_head) {
+                pool->queue_tail = NULL;
+            }
+            SDL_AtomicAdd(&pool->queue_count, -1);
+        }
+        SDL_AtomicUnlock(&pool->queue_lock);
+        if (job) {
+            return job;
+        }
+    }
+
+    /* Steal from the other workers, starting with our neighbor */
+    first = self ? (self->index + 1) : 0;
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_JobWorker *victim = &pool->workers[(first + i) % pool->num_workers];
+        if (victim != self) {
+            job = SDL_StealJobDeque(&victim->deque);
+            if (job) {
+                return job;
+            }
+        }
+    }
+    return NULL;
+}
+
+static SDL_Job *
+SDL_AllocJob(SDL_JobPool *pool)
+{
+    SDL_Job *job;
+
+    SDL_AtomicLock(&pool->free_lock);
+    job = pool->free_jobs;
+    if (job) {
+        pool->free_jobs = job->next;
+    }
+    SDL_AtomicUnlock(&pool->free_lock);
+
+    if (!job) {
+        job = (SDL_Job *) SDL_malloc(sizeof (*job));
+        if (!job) {
+            SDL_OutOfMemory();
+        }
+    }
+    return job;
+}
+
+static void
+SDL_FreeJob(SDL_JobPool *pool, SDL_Job *job)
+{
+    SDL_AtomicLock(&pool->free_lock);
+    job->next = pool->free_jobs;
+    pool->free_jobs = job;
+    SDL_AtomicUnlock(&pool->free_lock);
+}
+
+/* Count a job of 'counter' as done, submitting the jobs that were waiting
+   for the counter to reach zero */
+static void
+SDL_FinishJob(SDL_JobPool *pool, SDL_JobCounter *counter)
+{
+    SDL_bool done = SDL_FALSE;
+    SDL_Job *pending = NULL;
+
+    /* The counter is only touched under its lock, so that whoever sees
+       it reach zero can destroy it as soon as they can take the lock. */
+    SDL_AtomicLock(&counter->lock);
+    if (SDL_AtomicDecRef(&counter->value)) {
+        pending = counter->pending;
+        counter->pending = NULL;
+        done = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&counter->lock);
+
+    while (pending) {
+        SDL_Job *next = pending->next;
+        SDL_SubmitJob(pool, pending);
+        pending = next;
+    }
+    if (done) {
+        SDL_WakeJobWaiters(pool);
+    }
+}
+
+static void
+SDL_RunJob(SDL_JobPool *pool, SDL_Job *job)
+{
+    SDL_JobCounter *counter = job->counter;
+
+    job->function(job->data);
+    SDL_FreeJob(pool, job);
+
+    if (counter) {
+        SDL_FinishJob(pool, counter);
+    }
+}
+
+static int SDLCALL
+SDL_JobWorkerThread(void *userdata)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *) userdata;
+    SDL_JobPool *pool = worker->pool;
+
+    SDL_TLSSet(SDL_job_worker_tls, worker, NULL);
+
+    for ( ; ; ) {
+        SDL_Job *job = SDL_FindJob(pool, worker);
+        if (job) {
+            SDL_RunJob(pool, job);
+            continue;
+        }
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+
+        /* Announce that we're going to sleep before the last look for
+           work, so a job added in between always posts the semaphore. */
+        SDL_AtomicIncRef(&pool->sleeping);
+        if (!SDL_HasJobs(pool) && !SDL_AtomicGet(&pool->quit)) {
+            SDL_SemWait(pool->work_sem);
+        }
+        SDL_AtomicAdd(&pool->sleeping, -1);
+    }
+    return 0;
+}
+
+static void
+SDL_DestroyJobPool(SDL_JobPool *pool)
+{
+    SDL_Job *job;
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_SemPost(pool->work_sem);
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_WaitThread(pool->workers[i].thread, NULL);
+    }
+
+    /* The workers drain the queues before they leave */
+    SDL_assert(!SDL_HasJobs(pool));
+
+    while (pool->free_jobs) {
+        job = pool->free_jobs;
+        pool->free_jobs = job->next;
+        SDL_free(job);
+    }
+    if (pool->work_sem) {
+        SDL_DestroySemaphore(pool->work_sem);
+    }
+    if (pool->wait_cond) {
+        SDL_DestroyCond(pool->wait_cond);
+    }
+    if (pool->wait_lock) {
+        SDL_DestroyMutex(pool->wait_lock);
+    }
+    SDL_free(pool->workers);
+    SDL_free(pool);
+}
+
+static SDL_JobPool *
+SDL_CreateJobPool(void)
+{
+    /* Whoever waits for the jobs runs them too */
+    const int num_workers = SDL_max(SDL_GetCPUCount() - 1, 1);
+    SDL_JobPool *pool;
+
+    if (!SDL_job_worker_tls) {
+        SDL_job_worker_tls = SDL_TLSCreate();
+        if (!SDL_job_worker_tls) {
+            return NULL;
+        }
+    }
+
+    pool = (SDL_JobPool *) SDL_calloc(1, sizeof (*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->workers = (SDL_JobWorker *) SDL_calloc(num_workers, sizeof (SDL_JobWorker));
+    pool->work_sem = SDL_CreateSemaphore(0);
+    pool->wait_lock = SDL_CreateMutex();
+    pool->wait_cond = SDL_CreateCond();
+    if (!pool->workers || !pool->work_sem || !pool->wait_lock || !pool->wait_cond) {
+        if (!pool->workers) {
+            SDL_OutOfMemory();
+        }
+        SDL_DestroyJobPool(pool);
+        return NULL;
+    }
+
+    /* If a worker can't be started, the waiting threads pick up the slack */
+    while (pool->num_workers < num_workers) {
+        SDL_JobWorker *worker = &pool->workers[pool->num_workers];
+        worker->pool = pool;
+        worker->index = pool->num_workers;
+        worker->thread = SDL_CreateThreadInternal(SDL_JobWorkerThread, "SDLJobWorker", 0, worker);
+        if (!worker->thread) {
+            break;
+        }
+        pool->num_workers++;
+    }
+    return pool;
+}
+
+static SDL_JobPool *
+SDL_GetJobPool(void)
+{
+    SDL_JobPool *pool;
+
+    SDL_AtomicLock(&SDL_job_pool_lock);
+    if (!SDL_job_pool) {
+        SDL_job_pool = SDL_CreateJobPool();
+    }
+    pool = SDL_job_pool;
+    SDL_AtomicUnlock(&SDL_job_pool_lock);
+    return pool;
+}
+
+void
+SDL_JobsQuit(void)
+{
+    SDL_JobPool *pool;
+
+    SDL_AtomicLock(&SDL_job_pool_lock);
+    pool = SDL_job_pool;
+    SDL_job_pool = NULL;
+    SDL_AtomicUnlock(&SDL_job_pool_lock);
+
+    if (pool) {
+        SDL_DestroyJobPool(pool);
+    }
+}
+
+SDL_JobCounter *
+SDL_CreateJobCounter(void)
+{
+    SDL_JobCounter *counter = (SDL_JobCounter *) SDL_calloc(1, sizeof (*counter));
+    if (!counter) {
+        SDL_OutOfMemory();
+    }
+    return counter;
+}
+
+void
+SDL_DestroyJobCounter(SDL_JobCounter *counter)
+{
+    SDL_Job *pending;
+
+    if (!counter) {
+        return;
+    }
+
+    /* Let the job that finished last get out of the counter */
+    SDL_AtomicLock(&counter->lock);
+    SDL_assert(SDL_AtomicGet(&counter->value) == 0);
+    pending = counter->pending;
+    counter->pending = NULL;
+    SDL_AtomicUnlock(&counter->lock);
+
+    /* Jobs still waiting for this counter are discarded, but they count as
+       finished for their own counters so nobody waits on them forever. They
+       were added to the pool, so it is still running. */
+    if (pending) {
+        SDL_JobPool *pool = SDL_GetJobPool();
+        while (pending) {
+            SDL_Job *job = pending;
+            SDL_JobCounter *job_counter = job->counter;
+            pending = job->next;
+            if (!pool) {
+                SDL_free(job);
+                continue;
+            }
+            SDL_FreeJob(pool, job);
+            if (job_counter) {
+                SDL_FinishJob(pool, job_counter);
+            }
+        }
+    }
+
+    SDL_free(counter);
+}
+
+int
+SDL_GetJobCounterValue(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        return SDL_InvalidParamError("counter");
+    }
+    return SDL_AtomicGet(&counter->value);
+}
+
+int
+SDL_AddJob(SDL_JobFunction function, void *data, SDL_JobCounter *counter, SDL_JobCounter *dependency)
+{
+    SDL_JobPool *pool;
+    SDL_Job *job;
+
+    if (!function) {
+        return SDL_InvalidParamError("function");
+    }
+
+    pool = SDL_GetJobPool();
+    if (!pool) {
+        return -1;
+    }
+    job = SDL_AllocJob(pool);
+    if (!job) {
+        return -1;
+    }
+    job->function = function;
+    job->data = data;
+    job->counter = counter;
+    job->next = NULL;
+
+    if (counter) {
+        SDL_AtomicIncRef(&counter->value);
+    }
+
+    if (dependency) {
+        SDL_bool deferred = SDL_FALSE;
+
+        SDL_AtomicLock(&dependency->lock);
+        if (SDL_AtomicGet(&dependency->value) > 0) {
+            job->next = dependency->pending;
+            dependency->pending = job;
+            deferred = SDL_TRUE;
+        }
+        SDL_AtomicUnlock(&dependency->lock);
+
+        if (deferred) {
+            return 0;
+        }
+    }
+
+    SDL_SubmitJob(pool, job);
+    return 0;
+}
+
+void
+SDL_WaitJobCounter(SDL_JobCounter *counter)
+{
+    SDL_JobPool *pool;
+    SDL_JobWorker *self;
+
+    if (!counter || SDL_AtomicGet(&counter->value) == 0) {
+        return;
+    }
+
+    pool = SDL_GetJobPool();
+    if (!pool) {
+        return;  /* can't happen, the pool holds the jobs being waited on */
+    }
+    self = (SDL_JobWorker *) SDL_TLSGet(SDL_job_worker_tls);
+    if (self && self->pool != pool) {
+        self = NULL;
+    }
+
+    while (SDL_AtomicGet(&counter->value) > 0) {
+        SDL_Job *job = SDL_FindJob(pool, self);
+        if (job) {
+            SDL_RunJob(pool, job);
+            continue;
+        }
+
+        /* Nothing to help with, sleep until a job is added or a counter
+           reaches zero. Both of those wake us under the lock once they see
+           that we're waiting, so the checks here can't miss them. */
+        SDL_LockMutex(pool->wait_lock);
+        SDL_AtomicIncRef(&pool->waiting);
+        if (SDL_AtomicGet(&counter->value) > 0 && !SDL_HasJobs(pool)) {
+            SDL_CondWait(pool->wait_cond, pool->wait_lock);
+        }
+        SDL_AtomicAdd(&pool->waiting, -1);
+        SDL_UnlockMutex(pool->wait_lock);
+    }
+
+    /* Make sure the job that finished last is done with the counter */
+    SDL_AtomicLock(&counter->lock);
+    SDL_AtomicUnlock(&counter->lock);
+}
+
+int
+SDL_GetNumJobThreads(void)
+{
+    SDL_JobPool *pool = SDL_GetJobPool();
+    return pool ? pool->num_workers : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
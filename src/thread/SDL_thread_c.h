@@ -90,6 +90,9 @@ extern SDL_TLSData *SDL_Generic_GetTLSData(void);
  */
 extern int SDL_Generic_SetTLSData(SDL_TLSData *data);
 
+/* Stop the shared job pool's worker threads */
+extern void SDL_JobsQuit(void);
+
 #endif /* SDL_thread_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -28,13 +28,18 @@
 
 /* #define DEBUG_TIMERS */
 
+#define NS_PER_MS       1000000
+#define NS_PER_SECOND   1000000000
+
 typedef struct _SDL_Timer
 {
     int timerID;
     SDL_TimerCallback callback;
+    SDL_NSTimerCallback callback_ns;
     void *param;
-    Uint32 interval;
-    Uint32 scheduled;
+    Uint64 interval;    /* nanoseconds for callback_ns, milliseconds for callback */
+    Uint64 scheduled;   /* nanoseconds since SDL_TimerInit() */
+    Uint32 sequence;    /* keeps timers due at the same time in the order they were scheduled */
     SDL_atomic_t canceled;
     struct _SDL_Timer *next;
 } SDL_Timer;
@@ -46,13 +51,20 @@ typedef struct _SDL_TimerMap
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* Timer IDs are handed out in order, so they make a fine hash on their own */
+#define SDL_TIMERMAP_MIN_BUCKETS 64
+
+/* The timers are kept in a binary heap ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap;
+    int timermap_buckets;
+    int timermap_count;
     SDL_mutex *timermap_lock;
+    Uint64 start;
+    Uint64 frequency;
 
     /* Padding to separate cache lines between threads */
     char cache_pad[SDL_CACHELINE_SIZE];
@@ -64,8 +76,11 @@ typedef struct {
     SDL_Timer *freelist;
     SDL_atomic_t active;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint32 sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -76,25 +91,77 @@ static SDL_TimerData SDL_timer_data;
  * Timers are removed by simply setting a canceled flag
  */
 
-static void
+static Uint64
+SDL_TimerNow(SDL_TimerData *data)
+{
+    const Uint64 ticks = SDL_GetPerformanceCounter() - data->start;
+    return ((ticks / data->frequency) * NS_PER_SECOND) +
+           (((ticks % data->frequency) * NS_PER_SECOND) / data->frequency);
+}
+
+static SDL_bool
+SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
+{
+    if (a->scheduled != b->scheduled) {
+        return (a->scheduled < b->scheduled) ? SDL_TRUE : SDL_FALSE;
+    }
+    return ((Sint32)(a->sequence - b->sequence) < 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+static int
 SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    int i;
+
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return SDL_OutOfMemory();
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->sequence++;
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
+    /* Sift up from the end */
+    for (i = data->num_timers++; i > 0; ) {
+        const int parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, data->timers[parent])) {
             break;
         }
+        data->timers[i] = data->timers[parent];
+        i = parent;
     }
+    data->timers[i] = timer;
+    return 0;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static SDL_Timer *
+SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *first = data->timers[0];
+    SDL_Timer *last = data->timers[--data->num_timers];
+    int i = 0;
+
+    /* Sift the last timer down from the top */
+    for ( ; ; ) {
+        int child = (i * 2) + 1;
+        if (child >= data->num_timers) {
+            break;
+        }
+        if (child + 1 < data->num_timers && SDL_TimerBefore(data->timers[child + 1], data->timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(data->timers[child], last)) {
+            break;
+        }
+        data->timers[i] = data->timers[child];
+        i = child;
     }
-    timer->next = curr;
+    data->timers[i] = last;
+    return first;
 }
 
 static int SDLCALL
@@ -105,7 +172,7 @@ SDL_TimerThread(void *_data)
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, now, interval;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -127,70 +194,62 @@ SDL_TimerThread(void *_data)
             }
         }
         SDL_AtomicUnlock(&data->lock);
+        freelist_head = NULL;
+        freelist_tail = NULL;
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
+            if (SDL_AddTimerInternal(data, current) < 0) {
+                /* Out of memory, drop it as if it were canceled */
+                current->next = freelist_head;
+                freelist_head = current;
+                if (!freelist_tail) {
+                    freelist_tail = current;
+                }
+                SDL_AtomicSet(&current->canceled, 1);
+            }
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
 
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
-
-        tick = SDL_GetTicks();
+        tick = SDL_TimerNow(data);
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
-
-            if ((Sint32)(tick-current->scheduled) < 0) {
-                /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
-                break;
-            }
-
+        while (data->num_timers > 0 && data->timers[0]->scheduled <= tick) {
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            current = SDL_RemoveFirstTimer(data);
 
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
+            } else if (current->callback_ns) {
+                interval = current->callback_ns(current->interval, current->param);
             } else {
-                interval = current->callback(current->interval, current->param);
+                interval = current->callback((Uint32)current->interval, current->param);
             }
 
             if (interval > 0) {
                 /* Reschedule this timer */
                 current->interval = interval;
-                current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
-            } else {
-                if (!freelist_head) {
-                    freelist_head = current;
-                }
-                if (freelist_tail) {
-                    freelist_tail->next = current;
+                current->scheduled = tick + (current->callback_ns ? interval : (interval * NS_PER_MS));
+                if (SDL_AddTimerInternal(data, current) == 0) {
+                    continue;
                 }
-                freelist_tail = current;
+            }
 
-                SDL_AtomicSet(&current->canceled, 1);
+            if (!freelist_head) {
+                freelist_head = current;
             }
-        }
+            if (freelist_tail) {
+                freelist_tail->next = current;
+            }
+            freelist_tail = current;
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
-        } else {
-            delay -= interval;
+            SDL_AtomicSet(&current->canceled, 1);
         }
 
         /* Note that each time a timer is added, this will return
@@ -198,7 +257,28 @@ SDL_TimerThread(void *_data)
            That's okay, it just means we run through the loop a few
            extra times.
          */
-        SDL_SemWaitTimeout(data->sem, delay);
+        if (data->num_timers == 0) {
+            /* Initial delay if there are no timers */
+            SDL_SemWait(data->sem);
+            continue;
+        }
+
+        current = data->timers[0];
+        now = SDL_TimerNow(data);
+        if (current->scheduled <= now) {
+            SDL_SemTryWait(data->sem);
+        } else if (!current->callback_ns) {
+            /* Millisecond timers never fire early, so round the wait up */
+            SDL_SemWaitTimeout(data->sem, (Uint32)SDL_min((current->scheduled - now + NS_PER_MS - 1) / NS_PER_MS, SDL_MUTEX_MAXWAIT - 1));
+        } else if (current->scheduled - now >= NS_PER_MS) {
+            /* Sleep in whole milliseconds, then spin off the rest below */
+            SDL_SemWaitTimeout(data->sem, (Uint32)SDL_min((current->scheduled - now) / NS_PER_MS, SDL_MUTEX_MAXWAIT - 1));
+        } else {
+            /* Less than a millisecond to go, which is finer than the semaphore can wait */
+            while (SDL_SemTryWait(data->sem) != 0 && SDL_TimerNow(data) < current->scheduled) {
+                continue;
+            }
+        }
     }
     return 0;
 }
@@ -221,6 +301,9 @@ SDL_TimerInit(void)
             return -1;
         }
 
+        data->start = SDL_GetPerformanceCounter();
+        data->frequency = SDL_GetPerformanceFrequency();
+
         SDL_AtomicSet(&data->active, 1);
 
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
@@ -241,6 +324,7 @@ SDL_TimerQuit(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) {  /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -254,29 +338,69 @@ SDL_TimerQuit(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
-            SDL_free(timer);
+        for (i = 0; i < data->num_timers; ++i) {
+            SDL_free(data->timers[i]);
         }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_timers = 0;
+        data->max_timers = 0;
         while (data->freelist) {
             timer = data->freelist;
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_buckets; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_buckets = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
-SDL_TimerID
-SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+/* Add an entry to the timer map, growing it to keep the chains short -- called with the map locked */
+static int
+SDL_AddTimerMapEntry(SDL_TimerData *data, SDL_TimerMap *entry)
+{
+    if (data->timermap_count >= (data->timermap_buckets * 2)) {
+        const int buckets = data->timermap_buckets ? (data->timermap_buckets * 2) : SDL_TIMERMAP_MIN_BUCKETS;
+        SDL_TimerMap **timermap = (SDL_TimerMap **)SDL_calloc(buckets, sizeof(*timermap));
+        if (timermap) {
+            int i;
+            for (i = 0; i < data->timermap_buckets; ++i) {
+                while (data->timermap[i]) {
+                    SDL_TimerMap *moved = data->timermap[i];
+                    data->timermap[i] = moved->next;
+                    moved->next = timermap[moved->timerID & (buckets - 1)];
+                    timermap[moved->timerID & (buckets - 1)] = moved;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_buckets = buckets;
+        } else if (!data->timermap) {
+            return SDL_OutOfMemory();
+        }
+        /* else we just live with longer chains */
+    }
+
+    entry->next = data->timermap[entry->timerID & (data->timermap_buckets - 1)];
+    data->timermap[entry->timerID & (data->timermap_buckets - 1)] = entry;
+    ++data->timermap_count;
+    return 0;
+}
+
+static SDL_TimerID
+SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback, SDL_NSTimerCallback callback_ns, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
@@ -307,9 +431,10 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     }
     timer->timerID = SDL_AtomicIncRef(&data->nextID);
     timer->callback = callback;
+    timer->callback_ns = callback_ns;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_TimerNow(data) + (callback_ns ? interval : (interval * NS_PER_MS));
     SDL_AtomicSet(&timer->canceled, 0);
 
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
@@ -322,8 +447,12 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     entry->timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    if (SDL_AddTimerMapEntry(data, entry) < 0) {
+        SDL_UnlockMutex(data->timermap_lock);
+        SDL_free(entry);
+        SDL_free(timer);
+        return 0;
+    }
     SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -338,24 +467,40 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     return entry->timerID;
 }
 
+SDL_TimerID
+SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+{
+    return SDL_CreateTimer(interval, callback, NULL, param);
+}
+
+SDL_TimerID
+SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *param)
+{
+    return SDL_CreateTimer(interval, NULL, callback, param);
+}
+
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *prev, *entry = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
+    if (data->timermap) {
+        SDL_TimerMap **bucket = &data->timermap[id & (data->timermap_buckets - 1)];
+        prev = NULL;
+        for (entry = *bucket; entry; prev = entry, entry = entry->next) {
+            if (entry->timerID == id) {
+                if (prev) {
+                    prev->next = entry->next;
+                } else {
+                    *bucket = entry->next;
+                }
+                --data->timermap_count;
+                break;
             }
-            break;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
@@ -134,33 +134,41 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
     /* Get the available CPU features */
     if (features == 0xffffffff) {
         const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
-
-        features = SDL_CPU_ANY;
+        Uint32 cpu_features = SDL_CPU_ANY;
 
         /* Allow an override for testing .. */
         if (override) {
-            SDL_sscanf(override, "%u", &features);
+            SDL_sscanf(override, "%u", &cpu_features);
         } else {
             if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
+                cpu_features |= SDL_CPU_MMX;
             }
             if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
+                cpu_features |= SDL_CPU_3DNOW;
             }
             if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
+                cpu_features |= SDL_CPU_SSE;
             }
             if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
+                cpu_features |= SDL_CPU_SSE2;
+            }
+            if (SDL_HasAVX2()) {
+                cpu_features |= SDL_CPU_AVX2;
+            }
+            if (SDL_HasNEON()) {
+                cpu_features |= SDL_CPU_NEON;
             }
             if (SDL_HasAltiVec()) {
                 if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
+                    cpu_features |= SDL_CPU_ALTIVEC_PREFETCH;
                 } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
+                    cpu_features |= SDL_CPU_ALTIVEC_NOPREFETCH;
                 }
             }
         }
+
+        /* Publish the complete set at once, blits may be set up on several threads */
+        features = cpu_features;
     }
 
     for (i = 0; entries[i].func; ++i) {
@@ -51,6 +51,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
+#define SDL_CPU_NEON                0x00000080
 
 typedef struct
 {
@@ -82,6 +84,26 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* Number of previous destination mappings kept per source surface */
+#define SDL_BLITMAP_CACHE_SIZE  4
+
+/* A previously calculated mapping, kept so a source that alternates
+   between destinations doesn't rebuild its tables and blitter each time.
+   The entry owns its table and holds a reference on the destination format.
+ */
+typedef struct
+{
+    SDL_PixelFormat *dst_fmt;
+    Uint32 dst_palette_version;
+    Uint32 src_palette_version;
+    int flags;
+    Uint8 r, g, b, a;
+    int identity;
+    SDL_blit blit;
+    void *data;
+    Uint8 *table;
+} SDL_BlitMapCacheEntry;
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -95,6 +117,13 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* Most recently used first, the current mapping isn't included */
+    SDL_BlitMapCacheEntry cache[SDL_BLITMAP_CACHE_SIZE];
+    int num_cached;
+
+    /* Scratch surface for filtered scaled blits from this surface */
+    SDL_Surface *scaled;
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
@@ -106,6 +135,22 @@ extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
 
+/* Scaled blit filtering, with the values of SDL_HINT_RENDER_SCALE_QUALITY */
+#define SDL_SCALE_NEAREST   0
+#define SDL_SCALE_LINEAR    1
+#define SDL_SCALE_BEST      2
+
+/* Functions found in SDL_stretch.c */
+extern SDL_bool SDL_SoftStretchFilterable(const SDL_PixelFormat * format);
+extern int SDL_SoftStretchFiltered(SDL_Surface * src, const SDL_Rect * srcrect,
+                                   SDL_Surface * dst, const SDL_Rect * dstrect,
+                                   int quality);
+
+/* Functions found in SDL_surface.c */
+extern int SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect,
+                                      int quality);
+
 /*
  * Useful macros for blitting routines
  */
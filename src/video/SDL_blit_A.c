@@ -582,6 +582,747 @@ BlitRGBtoRGBPixelAlphaMMX3DNOW(SDL_BlitInfo * info)
 
 #endif /* __3dNOW__ */
 
+#if defined(__SSE2__) || HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS
+
+/* Per-pixel versions of the SSE2/SSE4.1/AVX2 blenders below, used for the
+   pixels left over at the end of each row. They produce the same results as
+   BlitRGBtoRGBPixelAlpha, BlitRGBtoRGBPixelAlphaMMX, BlitRGBtoRGBSurfaceAlpha
+   and BlitNtoNSurfaceAlphaKey, so the choice of kernel is never visible. */
+static SDL_INLINE Uint32
+BlendPixelAlpha8888(Uint32 s, Uint32 d, Uint32 ashift)
+{
+    Uint32 alpha = (s >> ashift) & 0xff;
+    Uint32 dalpha;
+    Uint32 s1;
+    Uint32 d1;
+    Uint32 s2;
+    Uint32 d2;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == SDL_ALPHA_OPAQUE) {
+        return s;
+    }
+
+    /* blend bytes 0/2 and 1/3 in parallel, then fix up the alpha byte */
+    s1 = s & 0xff00ff;
+    d1 = d & 0xff00ff;
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s2 = (s >> 8) & 0xff00ff;
+    d2 = (d >> 8) & 0xff00ff;
+    d2 = (d2 + ((s2 - d2) * alpha >> 8)) & 0xff00ff;
+    dalpha = alpha + (((d >> ashift) & 0xff) * (alpha ^ 0xFF) >> 8);
+    return ((d1 | (d2 << 8)) & ~(0xffu << ashift)) | (dalpha << ashift);
+}
+
+static SDL_INLINE Uint32
+BlendPixelAlphaMMX8888(Uint32 s, Uint32 d, Uint32 ashift)
+{
+    Uint32 alpha = (s >> ashift) & 0xff;
+    Uint32 pixel = 0;
+    int shift;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == SDL_ALPHA_OPAQUE) {
+        return s;
+    }
+
+    /* (s * a >> 8) + (d * (255 - a) >> 8), with 255 for a in the alpha byte */
+    for (shift = 0; shift < 32; shift += 8) {
+        Uint32 sa = (shift == (int) ashift) ? 0xff : alpha;
+        Uint32 c = ((((s >> shift) & 0xff) * sa) >> 8) + ((((d >> shift) & 0xff) * (alpha ^ 0xff)) >> 8);
+        pixel |= SDL_min(c, 0xff) << shift;
+    }
+    return pixel;
+}
+
+static SDL_INLINE Uint32
+BlendSurfaceAlpha888(Uint32 s, Uint32 d, Uint32 alpha)
+{
+    Uint32 s1 = s & 0xff00ff;
+    Uint32 d1 = d & 0xff00ff;
+
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s &= 0xff00;
+    d &= 0xff00;
+    d = (d + ((s - d) * alpha >> 8)) & 0xff00;
+    return d1 | d | 0xff000000;
+}
+
+static SDL_INLINE Uint32
+BlendSurfaceAlphaKey8888(Uint32 s, Uint32 d, Uint32 alpha,
+                         Uint32 rgbmask, Uint32 amask, Uint32 ashift)
+{
+    Uint32 pixel = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        int sc = (s >> shift) & 0xff;
+        int dc = (d >> shift) & 0xff;
+        pixel |= (Uint32) (Uint8) ((sc - dc) * (int) alpha / 255 + dc) << shift;
+    }
+    pixel &= rgbmask;
+    if (amask) {
+        Uint32 dalpha = (d >> ashift) & 0xff;
+        pixel |= (alpha + dalpha - alpha * dalpha / 255) << ashift;
+    }
+    return pixel;
+}
+
+#endif /* __SSE2__ || HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS */
+
+#ifdef __SSE2__
+
+/* x / 255 for 0 <= x <= 255*255 in each 16 bit lane, truncating like the
+   integer division in ALPHA_BLEND_RGBA */
+#define DIV255_EPI16(x) \
+    _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8)
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, 4 pixels at a time */
+static void
+BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m128i amask = _mm_set1_epi32((int) (0xffu << ashift));
+    const __m128i byte = _mm_set1_epi32(0xff);
+    const __m128i full = _mm_set1_epi16(256);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i alpha = _mm_and_si128(_mm_srl_epi32(s, shift), byte);
+            __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+            __m128i opaque = _mm_cmpeq_epi32(alpha, byte);
+
+            if (_mm_movemask_epi8(opaque) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (_mm_movemask_epi8(transparent) != 0xffff) {
+                __m128i a, alo, ahi, lo, hi, dalpha, pixel;
+
+                /* spread each pixel's alpha over its four channels */
+                a = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+                a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+                alo = _mm_unpacklo_epi8(a, zero);
+                ahi = _mm_unpackhi_epi8(a, zero);
+
+                /* (s * a + d * (256 - a)) >> 8 */
+                lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), alo),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(full, alo)));
+                hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), ahi),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(full, ahi)));
+                pixel = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+                /* a + ((dA * (255 - a)) >> 8) */
+                dalpha = _mm_and_si128(_mm_srl_epi32(d, shift), byte);
+                dalpha = _mm_mullo_epi16(dalpha, _mm_xor_si128(alpha, byte));
+                dalpha = _mm_add_epi32(alpha, _mm_srli_epi32(dalpha, 8));
+                pixel = _mm_or_si128(_mm_andnot_si128(amask, pixel), _mm_sll_epi32(dalpha, shift));
+
+                pixel = _mm_or_si128(_mm_andnot_si128(opaque, pixel), _mm_and_si128(opaque, s));
+                pixel = _mm_or_si128(_mm_andnot_si128(transparent, pixel), _mm_and_si128(transparent, d));
+                _mm_storeu_si128((__m128i *) dstp, pixel);
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlpha8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* (A)RGB888 blending with pixel alpha in any byte, 4 pixels at a time. This
+   rounds like BlitRGBtoRGBPixelAlphaMMX, which it replaces for the layouts
+   with the alpha below the top byte. */
+static void
+BlitRGBAtoRGBAPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m128i amask = _mm_set1_epi32((int) (0xffu << ashift));
+    const __m128i byte = _mm_set1_epi32(0xff);
+    const __m128i ones = _mm_set1_epi32(-1);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i alpha = _mm_and_si128(_mm_srl_epi32(s, shift), byte);
+            __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+            __m128i opaque = _mm_cmpeq_epi32(alpha, byte);
+
+            if (_mm_movemask_epi8(opaque) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (_mm_movemask_epi8(transparent) != 0xffff) {
+                __m128i a, sa, da, lo, hi, pixel;
+
+                /* a in the color bytes and 255 in the alpha byte for the
+                   source, 255 - a in every byte for the destination */
+                a = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+                a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+                sa = _mm_or_si128(a, amask);
+                da = _mm_xor_si128(a, ones);
+
+                /* (s * sa >> 8) + (d * da >> 8), saturated */
+                lo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(sa, zero)), 8),
+                                   _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(da, zero)), 8));
+                hi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(sa, zero)), 8),
+                                   _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(da, zero)), 8));
+                pixel = _mm_packus_epi16(lo, hi);
+
+                pixel = _mm_or_si128(_mm_andnot_si128(opaque, pixel), _mm_and_si128(opaque, s));
+                pixel = _mm_or_si128(_mm_andnot_si128(transparent, pixel), _mm_and_si128(transparent, d));
+                _mm_storeu_si128((__m128i *) dstp, pixel);
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlphaMMX8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, 4 pixels at a time */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 alpha = info->a;
+    const __m128i a = _mm_set1_epi16(alpha);
+    const __m128i inva = _mm_set1_epi16(256 - alpha);
+    const __m128i opaque = _mm_set1_epi32((int) 0xff000000);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i lo, hi;
+
+            lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), a),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inva));
+            hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), a),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inva));
+            d = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+            _mm_storeu_si128((__m128i *) dstp, _mm_or_si128(d, opaque));
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dstp = BlendSurfaceAlpha888(*srcp, *dstp, alpha);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* colorkeyed RGB888->(A)RGB888 blending with surface alpha, 4 pixels at a time */
+static void
+BlitRGBtoRGBSurfaceAlphaKeySSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+    Uint32 rgbmask = dstfmt->Rmask | dstfmt->Gmask | dstfmt->Bmask;
+    Uint32 amask = dstfmt->Amask;
+    Uint32 ashift = dstfmt->Ashift;
+    Uint32 alpha = info->a;
+    const __m128i ckey = _mm_set1_epi32((int) info->colorkey);
+    const __m128i rgb = _mm_set1_epi32((int) rgbmask);
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m128i a = _mm_set1_epi16(alpha);
+    const __m128i a32 = _mm_set1_epi32(alpha);
+    const __m128i byte = _mm_set1_epi32(0xff);
+    const __m128i zero = _mm_setzero_si128();
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            __m128i keyed = _mm_cmpeq_epi32(s, ckey);
+
+            if (_mm_movemask_epi8(keyed) != 0xffff) {
+                __m128i up, down, pixel;
+
+                /* d + (s - d) * a / 255, rounding toward zero */
+                up = _mm_subs_epu8(s, d);
+                down = _mm_subs_epu8(d, s);
+                up = _mm_packus_epi16(DIV255_EPI16(_mm_mullo_epi16(_mm_unpacklo_epi8(up, zero), a)),
+                                      DIV255_EPI16(_mm_mullo_epi16(_mm_unpackhi_epi8(up, zero), a)));
+                down = _mm_packus_epi16(DIV255_EPI16(_mm_mullo_epi16(_mm_unpacklo_epi8(down, zero), a)),
+                                        DIV255_EPI16(_mm_mullo_epi16(_mm_unpackhi_epi8(down, zero), a)));
+                pixel = _mm_and_si128(_mm_subs_epu8(_mm_adds_epu8(d, up), down), rgb);
+
+                if (amask) {
+                    /* a + dA - a * dA / 255 */
+                    __m128i dalpha = _mm_and_si128(_mm_srl_epi32(d, shift), byte);
+                    __m128i prod = _mm_mullo_epi16(dalpha, a32);
+                    dalpha = _mm_sub_epi32(_mm_add_epi32(a32, dalpha), DIV255_EPI16(prod));
+                    pixel = _mm_or_si128(pixel, _mm_sll_epi32(dalpha, shift));
+                }
+
+                pixel = _mm_or_si128(_mm_andnot_si128(keyed, pixel), _mm_and_si128(keyed, d));
+                _mm_storeu_si128((__m128i *) dstp, pixel);
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            if (*srcp != info->colorkey) {
+                *dstp = BlendSurfaceAlphaKey8888(*srcp, *dstp, alpha, rgbmask, amask, ashift);
+            }
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* __SSE2__ */
+
+#if HAVE_SSE41_INTRINSICS
+
+/* pshufb control spreading the alpha bytes at i and j over 16 bit lanes */
+#define SPREAD_ALPHA_CTRL(i, j) \
+    _mm_setr_epi8(i, -128, i, -128, i, -128, i, -128, j, -128, j, -128, j, -128, j, -128)
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, 4 pixels at a time */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    int abyte = ashift >> 3;
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m128i amask = _mm_set1_epi32((int) (0xffu << ashift));
+    const __m128i spreadlo = SPREAD_ALPHA_CTRL(abyte, abyte + 4);
+    const __m128i spreadhi = SPREAD_ALPHA_CTRL(abyte + 8, abyte + 12);
+    const __m128i byte = _mm_set1_epi32(0xff);
+    const __m128i full = _mm_set1_epi16(256);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+
+            if (_mm_testc_si128(s, amask)) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (!_mm_testz_si128(s, amask)) {
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                __m128i alpha = _mm_and_si128(_mm_srl_epi32(s, shift), byte);
+                __m128i alo = _mm_shuffle_epi8(s, spreadlo);
+                __m128i ahi = _mm_shuffle_epi8(s, spreadhi);
+                __m128i lo, hi, dalpha, pixel;
+
+                /* (s * a + d * (256 - a)) >> 8 */
+                lo = _mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(s), alo),
+                                   _mm_mullo_epi16(_mm_cvtepu8_epi16(d), _mm_sub_epi16(full, alo)));
+                hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), ahi),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(full, ahi)));
+                pixel = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+                /* a + ((dA * (255 - a)) >> 8) */
+                dalpha = _mm_and_si128(_mm_srl_epi32(d, shift), byte);
+                dalpha = _mm_mullo_epi16(dalpha, _mm_xor_si128(alpha, byte));
+                dalpha = _mm_add_epi32(alpha, _mm_srli_epi32(dalpha, 8));
+                pixel = _mm_blendv_epi8(pixel, _mm_sll_epi32(dalpha, shift), amask);
+
+                pixel = _mm_blendv_epi8(pixel, s, _mm_cmpeq_epi32(alpha, byte));
+                pixel = _mm_blendv_epi8(pixel, d, _mm_cmpeq_epi32(alpha, zero));
+                _mm_storeu_si128((__m128i *) dstp, pixel);
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlpha8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* (A)RGB888 blending with pixel alpha in any byte, 4 pixels at a time,
+   rounding like BlitRGBtoRGBPixelAlphaMMX */
+static void SDL_TARGETING("sse4.1")
+BlitRGBAtoRGBAPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    int abyte = ashift >> 3;
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m128i amask = _mm_set1_epi32((int) (0xffu << ashift));
+    const __m128i alphamask = _mm_unpacklo_epi8(amask, _mm_setzero_si128());
+    const __m128i spreadlo = SPREAD_ALPHA_CTRL(abyte, abyte + 4);
+    const __m128i spreadhi = SPREAD_ALPHA_CTRL(abyte + 8, abyte + 12);
+    const __m128i byte = _mm_set1_epi32(0xff);
+    const __m128i word = _mm_set1_epi16(0xff);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+
+            if (_mm_testc_si128(s, amask)) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (!_mm_testz_si128(s, amask)) {
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                __m128i alpha = _mm_and_si128(_mm_srl_epi32(s, shift), byte);
+                __m128i alo = _mm_shuffle_epi8(s, spreadlo);
+                __m128i ahi = _mm_shuffle_epi8(s, spreadhi);
+                __m128i lo, hi, pixel;
+
+                /* (s * a >> 8) + (d * (255 - a) >> 8), with 255 for a in
+                   the alpha byte of the source term, saturated */
+                lo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(s), _mm_or_si128(alo, alphamask)), 8),
+                                   _mm_srli_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(d), _mm_xor_si128(alo, word)), 8));
+                hi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_or_si128(ahi, alphamask)), 8),
+                                   _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_xor_si128(ahi, word)), 8));
+                pixel = _mm_packus_epi16(lo, hi);
+
+                pixel = _mm_blendv_epi8(pixel, s, _mm_cmpeq_epi32(alpha, byte));
+                pixel = _mm_blendv_epi8(pixel, d, _mm_cmpeq_epi32(alpha, zero));
+                _mm_storeu_si128((__m128i *) dstp, pixel);
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlphaMMX8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+
+#define DIV255_EPI16_AVX2(x) \
+    _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8)
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, 8 pixels at a time */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    char abyte = (char) (ashift >> 3);
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m256i amask = _mm256_set1_epi32((int) (0xffu << ashift));
+    const __m256i spreadlo = _mm256_setr_epi8(
+        abyte, -128, abyte, -128, abyte, -128, abyte, -128,
+        abyte + 4, -128, abyte + 4, -128, abyte + 4, -128, abyte + 4, -128,
+        abyte, -128, abyte, -128, abyte, -128, abyte, -128,
+        abyte + 4, -128, abyte + 4, -128, abyte + 4, -128, abyte + 4, -128);
+    const __m256i spreadhi = _mm256_add_epi8(spreadlo, _mm256_set1_epi16(8));
+    const __m256i byte = _mm256_set1_epi32(0xff);
+    const __m256i full = _mm256_set1_epi16(256);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+
+            if (_mm256_testc_si256(s, amask)) {
+                _mm256_storeu_si256((__m256i *) dstp, s);
+            } else if (!_mm256_testz_si256(s, amask)) {
+                __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+                __m256i alpha = _mm256_and_si256(_mm256_srl_epi32(s, shift), byte);
+                __m256i alo = _mm256_shuffle_epi8(s, spreadlo);
+                __m256i ahi = _mm256_shuffle_epi8(s, spreadhi);
+                __m256i lo, hi, dalpha, pixel;
+
+                /* (s * a + d * (256 - a)) >> 8 */
+                lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), alo),
+                                      _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_sub_epi16(full, alo)));
+                hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), ahi),
+                                      _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_sub_epi16(full, ahi)));
+                pixel = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+
+                /* a + ((dA * (255 - a)) >> 8) */
+                dalpha = _mm256_and_si256(_mm256_srl_epi32(d, shift), byte);
+                dalpha = _mm256_mullo_epi16(dalpha, _mm256_xor_si256(alpha, byte));
+                dalpha = _mm256_add_epi32(alpha, _mm256_srli_epi32(dalpha, 8));
+                pixel = _mm256_blendv_epi8(pixel, _mm256_sll_epi32(dalpha, shift), amask);
+
+                pixel = _mm256_blendv_epi8(pixel, s, _mm256_cmpeq_epi32(alpha, byte));
+                pixel = _mm256_blendv_epi8(pixel, d, _mm256_cmpeq_epi32(alpha, zero));
+                _mm256_storeu_si256((__m256i *) dstp, pixel);
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlpha8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* (A)RGB888 blending with pixel alpha in any byte, 8 pixels at a time,
+   rounding like BlitRGBtoRGBPixelAlphaMMX */
+static void SDL_TARGETING("avx2")
+BlitRGBAtoRGBAPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 ashift = info->src_fmt->Ashift;
+    char abyte = (char) (ashift >> 3);
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m256i amask = _mm256_set1_epi32((int) (0xffu << ashift));
+    const __m256i alphamask = _mm256_unpacklo_epi8(amask, _mm256_setzero_si256());
+    const __m256i spreadlo = _mm256_setr_epi8(
+        abyte, -128, abyte, -128, abyte, -128, abyte, -128,
+        abyte + 4, -128, abyte + 4, -128, abyte + 4, -128, abyte + 4, -128,
+        abyte, -128, abyte, -128, abyte, -128, abyte, -128,
+        abyte + 4, -128, abyte + 4, -128, abyte + 4, -128, abyte + 4, -128);
+    const __m256i spreadhi = _mm256_add_epi8(spreadlo, _mm256_set1_epi16(8));
+    const __m256i byte = _mm256_set1_epi32(0xff);
+    const __m256i word = _mm256_set1_epi16(0xff);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+
+            if (_mm256_testc_si256(s, amask)) {
+                _mm256_storeu_si256((__m256i *) dstp, s);
+            } else if (!_mm256_testz_si256(s, amask)) {
+                __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+                __m256i alpha = _mm256_and_si256(_mm256_srl_epi32(s, shift), byte);
+                __m256i alo = _mm256_shuffle_epi8(s, spreadlo);
+                __m256i ahi = _mm256_shuffle_epi8(s, spreadhi);
+                __m256i lo, hi, pixel;
+
+                /* (s * a >> 8) + (d * (255 - a) >> 8), with 255 for a in
+                   the alpha byte of the source term, saturated */
+                lo = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_or_si256(alo, alphamask)), 8),
+                                      _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_xor_si256(alo, word)), 8));
+                hi = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_or_si256(ahi, alphamask)), 8),
+                                      _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_xor_si256(ahi, word)), 8));
+                pixel = _mm256_packus_epi16(lo, hi);
+
+                pixel = _mm256_blendv_epi8(pixel, s, _mm256_cmpeq_epi32(alpha, byte));
+                pixel = _mm256_blendv_epi8(pixel, d, _mm256_cmpeq_epi32(alpha, zero));
+                _mm256_storeu_si256((__m256i *) dstp, pixel);
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            *dstp = BlendPixelAlphaMMX8888(*srcp, *dstp, ashift);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, 8 pixels at a time */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 alpha = info->a;
+    const __m256i a = _mm256_set1_epi16(alpha);
+    const __m256i inva = _mm256_set1_epi16(256 - alpha);
+    const __m256i opaque = _mm256_set1_epi32((int) 0xff000000);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            __m256i lo, hi;
+
+            lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), a),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), inva));
+            hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), a),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), inva));
+            d = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+            _mm256_storeu_si256((__m256i *) dstp, _mm256_or_si256(d, opaque));
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            *dstp = BlendSurfaceAlpha888(*srcp, *dstp, alpha);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* colorkeyed RGB888->(A)RGB888 blending with surface alpha, 8 pixels at a time */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlphaKeyAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+    Uint32 rgbmask = dstfmt->Rmask | dstfmt->Gmask | dstfmt->Bmask;
+    Uint32 amask = dstfmt->Amask;
+    Uint32 ashift = dstfmt->Ashift;
+    Uint32 alpha = info->a;
+    const __m256i ckey = _mm256_set1_epi32((int) info->colorkey);
+    const __m256i rgb = _mm256_set1_epi32((int) rgbmask);
+    const __m128i shift = _mm_cvtsi32_si128(ashift);
+    const __m256i a = _mm256_set1_epi16(alpha);
+    const __m256i a32 = _mm256_set1_epi32(alpha);
+    const __m256i byte = _mm256_set1_epi32(0xff);
+    const __m256i zero = _mm256_setzero_si256();
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            __m256i keyed = _mm256_cmpeq_epi32(s, ckey);
+
+            if (!_mm256_testc_si256(keyed, _mm256_cmpeq_epi32(zero, zero))) {
+                __m256i up, down, pixel;
+
+                /* d + (s - d) * a / 255, rounding toward zero */
+                up = _mm256_subs_epu8(s, d);
+                down = _mm256_subs_epu8(d, s);
+                up = _mm256_packus_epi16(DIV255_EPI16_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(up, zero), a)),
+                                         DIV255_EPI16_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(up, zero), a)));
+                down = _mm256_packus_epi16(DIV255_EPI16_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(down, zero), a)),
+                                           DIV255_EPI16_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(down, zero), a)));
+                pixel = _mm256_and_si256(_mm256_subs_epu8(_mm256_adds_epu8(d, up), down), rgb);
+
+                if (amask) {
+                    /* a + dA - a * dA / 255 */
+                    __m256i dalpha = _mm256_and_si256(_mm256_srl_epi32(d, shift), byte);
+                    __m256i prod = _mm256_mullo_epi16(dalpha, a32);
+                    dalpha = _mm256_sub_epi32(_mm256_add_epi32(a32, dalpha), DIV255_EPI16_AVX2(prod));
+                    pixel = _mm256_or_si256(pixel, _mm256_sll_epi32(dalpha, shift));
+                }
+
+                pixel = _mm256_blendv_epi8(pixel, d, keyed);
+                _mm256_storeu_si256((__m256i *) dstp, pixel);
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            if (*srcp != info->colorkey) {
+                *dstp = BlendSurfaceAlphaKey8888(*srcp, *dstp, alpha, rgbmask, amask, ashift);
+            }
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
 /* 16bpp special case for per-surface alpha=50%: blend 2 pixels in parallel */
 
 /* blend a single 16 bit pixel at 50% */
@@ -1294,11 +2035,45 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                /* These blend like BlitRGBtoRGBPixelAlpha, with >>8 instead
+                   of /255, so they only replace it for the formats it
+                   already handles. */
+                if (sf->Amask == 0xff000000
+                    && sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_HasAVX2())
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_HasSSE41())
+                        return BlitRGBtoRGBPixelAlphaSSE41;
+#endif
+#ifdef __SSE2__
+                    if (SDL_HasSSE2())
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+#endif
+                }
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+                    /* Same blend as the MMX blitters, so these can take over
+                       the layouts with the alpha below the top byte. */
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_HasAVX2())
+                        return BlitRGBAtoRGBAPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_HasSSE41())
+                        return BlitRGBAtoRGBAPixelAlphaSSE41;
+#endif
+#ifdef __SSE2__
+                    if (SDL_HasSSE2())
+                        return BlitRGBAtoRGBAPixelAlphaSSE2;
+#endif
 #ifdef __3dNOW__
                     if (SDL_Has3DNow())
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
@@ -1352,6 +2127,16 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                    if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#if HAVE_AVX2_INTRINSICS
+                        if (SDL_HasAVX2())
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#ifdef __SSE2__
+                        if (SDL_HasSSE2())
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+#endif
+                    }
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
@@ -1375,9 +2160,26 @@ SDL_CalculateBlitA(SDL_Surface * surface)
         if (sf->Amask == 0) {
             if (df->BytesPerPixel == 1) {
                 return BlitNto1SurfaceAlphaKey;
-            } else {
-                return BlitNtoNSurfaceAlphaKey;
             }
+            if (sf->Rmask == df->Rmask
+                && sf->Gmask == df->Gmask
+                && sf->Bmask == df->Bmask
+                && sf->BytesPerPixel == 4 && df->BytesPerPixel == 4
+                && sf->Rloss == 0 && sf->Gloss == 0 && sf->Bloss == 0
+                && sf->Rshift % 8 == 0
+                && sf->Gshift % 8 == 0
+                && sf->Bshift % 8 == 0
+                && (df->Amask == 0 || (df->Aloss == 0 && df->Ashift % 8 == 0))) {
+#if HAVE_AVX2_INTRINSICS
+                if (SDL_HasAVX2())
+                    return BlitRGBtoRGBSurfaceAlphaKeyAVX2;
+#endif
+#ifdef __SSE2__
+                if (SDL_HasSSE2())
+                    return BlitRGBtoRGBSurfaceAlphaKeySSE2;
+#endif
+            }
+            return BlitNtoNSurfaceAlphaKey;
         }
         break;
     }
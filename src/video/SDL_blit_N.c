@@ -2515,6 +2515,274 @@ BlitNto2101010(SDL_BlitInfo * info)
     }
 }
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+#define HAVE_SWIZZLE_BLITTERS 1
+
+/* Byte shuffles between 24 and 32-bit formats that keep every channel in a
+   whole byte, e.g. ARGB8888 -> ABGR8888 or BGR24 -> RGBA8888. The control is
+   worked out from the format masks and moves four pixels at a time, with
+   0x80 for destination bytes that have no source channel, which both pshufb
+   and vtbl turn into zero. */
+static SDL_bool
+SwizzleFormatOK(const SDL_PixelFormat * fmt)
+{
+    if (fmt->BytesPerPixel != 3 && fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    if (fmt->Rloss || fmt->Gloss || fmt->Bloss ||
+        ((fmt->Rshift | fmt->Gshift | fmt->Bshift) & 7)) {
+        return SDL_FALSE;
+    }
+    if (fmt->Amask && (fmt->Aloss || (fmt->Ashift & 7))) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* Offset of the byte holding a channel within a pixel in memory */
+static int
+SwizzleByte(const SDL_PixelFormat * fmt, Uint8 shift)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return shift / 8;
+#else
+    return fmt->BytesPerPixel - 1 - shift / 8;
+#endif
+}
+
+static void
+CalculateSwizzle(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt,
+                 Uint8 control[16])
+{
+    int srcbpp = srcfmt->BytesPerPixel;
+    int dstbpp = dstfmt->BytesPerPixel;
+    int i;
+
+    SDL_memset(control, 0x80, 16);
+    for (i = 0; i < 4; ++i) {
+        Uint8 *pixel = &control[i * dstbpp];
+        int offset = i * srcbpp;
+
+        pixel[SwizzleByte(dstfmt, dstfmt->Rshift)] = offset + SwizzleByte(srcfmt, srcfmt->Rshift);
+        pixel[SwizzleByte(dstfmt, dstfmt->Gshift)] = offset + SwizzleByte(srcfmt, srcfmt->Gshift);
+        pixel[SwizzleByte(dstfmt, dstfmt->Bshift)] = offset + SwizzleByte(srcfmt, srcfmt->Bshift);
+        if (srcfmt->Amask && dstfmt->Amask) {
+            pixel[SwizzleByte(dstfmt, dstfmt->Ashift)] = offset + SwizzleByte(srcfmt, srcfmt->Ashift);
+        }
+    }
+}
+
+/* The alpha to set in each destination pixel when the source has none,
+   matching what BlitNtoN and Blit4to4MaskAlpha do */
+static Uint32
+SwizzleAlpha(const SDL_BlitInfo * info)
+{
+    if (info->src_fmt->Amask || !info->dst_fmt->Amask) {
+        return 0;
+    }
+    return (Uint32) info->a << info->dst_fmt->Ashift;
+}
+
+/* Converts the pixels left over at the end of a row */
+static void
+SwizzleRemainder(const Uint8 * src, int srcbpp, Uint8 * dst, int dstbpp,
+                 const Uint8 control[16], int abyte, Uint8 alpha, int n)
+{
+    int i;
+
+    while (n--) {
+        for (i = 0; i < dstbpp; ++i) {
+            dst[i] = (control[i] & 0x80) ? 0 : src[control[i]];
+        }
+        if (abyte >= 0) {
+            dst[abyte] = alpha;
+        }
+        src += srcbpp;
+        dst += dstbpp;
+    }
+}
+
+#if HAVE_SSE41_INTRINSICS
+/* pshufb is SSSE3, which every CPU with SSE4.1 has */
+static void SDL_TARGETING("sse4.1")
+BlitNtoNSwizzleSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    Uint32 alpha = SwizzleAlpha(info);
+    int abyte = alpha ? SwizzleByte(info->dst_fmt, info->dst_fmt->Ashift) : -1;
+    /* 24-bit pixels are still loaded and stored 16 bytes at a time */
+    int spare = (srcbpp == 3 || dstbpp == 3) ? 2 : 0;
+    Uint8 control[16];
+    __m128i shuffle, fill;
+
+    CalculateSwizzle(info->src_fmt, info->dst_fmt, control);
+    shuffle = _mm_loadu_si128((const __m128i *) control);
+    fill = _mm_set1_epi32((int) alpha);
+
+    while (height--) {
+        int n = width;
+        while (n >= 4 + spare) {
+            __m128i pixels = _mm_loadu_si128((const __m128i *) src);
+            pixels = _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), fill);
+            _mm_storeu_si128((__m128i *) dst, pixels);
+            src += 4 * srcbpp;
+            dst += 4 * dstbpp;
+            n -= 4;
+        }
+        SwizzleRemainder(src, srcbpp, dst, dstbpp, control, abyte, info->a, n);
+        src += n * srcbpp + srcskip;
+        dst += n * dstbpp + dstskip;
+    }
+}
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+BlitNtoNSwizzleAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    Uint32 alpha = SwizzleAlpha(info);
+    int abyte = alpha ? SwizzleByte(info->dst_fmt, info->dst_fmt->Ashift) : -1;
+    int spare = (srcbpp == 3 || dstbpp == 3) ? 2 : 0;
+    Uint8 control[16];
+    __m128i control128;
+    __m256i shuffle, fill;
+
+    CalculateSwizzle(info->src_fmt, info->dst_fmt, control);
+    control128 = _mm_loadu_si128((const __m128i *) control);
+    shuffle = _mm256_inserti128_si256(_mm256_castsi128_si256(control128), control128, 1);
+    fill = _mm256_set1_epi32((int) alpha);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8 + spare) {
+            /* pshufb works within each 128-bit lane, four pixels apiece */
+            __m256i pixels;
+            if (srcbpp == 4) {
+                pixels = _mm256_loadu_si256((const __m256i *) src);
+            } else {
+                pixels = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) src)),
+                    _mm_loadu_si128((const __m128i *) (src + 12)), 1);
+            }
+            pixels = _mm256_or_si256(_mm256_shuffle_epi8(pixels, shuffle), fill);
+            if (dstbpp == 4) {
+                _mm256_storeu_si256((__m256i *) dst, pixels);
+            } else {
+                _mm_storeu_si128((__m128i *) dst, _mm256_castsi256_si128(pixels));
+                _mm_storeu_si128((__m128i *) (dst + 12), _mm256_extracti128_si256(pixels, 1));
+            }
+            src += 8 * srcbpp;
+            dst += 8 * dstbpp;
+            n -= 8;
+        }
+        SwizzleRemainder(src, srcbpp, dst, dstbpp, control, abyte, info->a, n);
+        src += n * srcbpp + srcskip;
+        dst += n * dstbpp + dstskip;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+BlitNtoNSwizzleNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    Uint32 alpha = SwizzleAlpha(info);
+    int abyte = alpha ? SwizzleByte(info->dst_fmt, info->dst_fmt->Ashift) : -1;
+    int spare = (srcbpp == 3 || dstbpp == 3) ? 2 : 0;
+    Uint8 control[16];
+    uint8x16_t fill;
+#if defined(__aarch64__) || defined(_M_ARM64)
+    uint8x16_t shuffle;
+#else
+    uint8x8_t shufflelo, shufflehi;
+#endif
+
+    CalculateSwizzle(info->src_fmt, info->dst_fmt, control);
+#if defined(__aarch64__) || defined(_M_ARM64)
+    shuffle = vld1q_u8(control);
+#else
+    shufflelo = vld1_u8(control);
+    shufflehi = vld1_u8(control + 8);
+#endif
+    fill = vreinterpretq_u8_u32(vdupq_n_u32(alpha));
+
+    while (height--) {
+        int n = width;
+        while (n >= 4 + spare) {
+            uint8x16_t pixels = vld1q_u8(src);
+#if defined(__aarch64__) || defined(_M_ARM64)
+            pixels = vqtbl1q_u8(pixels, shuffle);
+#else
+            uint8x8x2_t table;
+            table.val[0] = vget_low_u8(pixels);
+            table.val[1] = vget_high_u8(pixels);
+            pixels = vcombine_u8(vtbl2_u8(table, shufflelo), vtbl2_u8(table, shufflehi));
+#endif
+            vst1q_u8(dst, vorrq_u8(pixels, fill));
+            src += 4 * srcbpp;
+            dst += 4 * dstbpp;
+            n -= 4;
+        }
+        SwizzleRemainder(src, srcbpp, dst, dstbpp, control, abyte, info->a, n);
+        src += n * srcbpp + srcskip;
+        dst += n * dstbpp + dstskip;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+static SDL_BlitFunc
+ChooseBlitNtoNSwizzle(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+    if (!SwizzleFormatOK(srcfmt) || !SwizzleFormatOK(dstfmt)) {
+        return NULL;
+    }
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return BlitNtoNSwizzleAVX2;
+    }
+#endif
+#if HAVE_SSE41_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return BlitNtoNSwizzleSSE41;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return BlitNtoNSwizzleNEON;
+    }
+#endif
+    return NULL;
+}
+
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -2667,6 +2935,15 @@ SDL_CalculateBlitN(SDL_Surface * surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+#if HAVE_SWIZZLE_BLITTERS
+            if (blitfun == BlitNtoN || blitfun == BlitNtoNCopyAlpha ||
+                blitfun == Blit4to4MaskAlpha) {
+                SDL_BlitFunc swizzle = ChooseBlitNtoNSwizzle(srcfmt, dstfmt);
+                if (swizzle) {
+                    blitfun = swizzle;
+                }
+            }
+#endif
         }
         return (blitfun);
 
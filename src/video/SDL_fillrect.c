@@ -23,6 +23,17 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 
+#ifdef HAVE_SYSCONF
+#include <unistd.h>
+#endif
+
+/* Used when the last level cache size can't be queried */
+#define SDL_FILLRECT_DEFAULT_CACHE_SIZE (8 * 1024 * 1024)
+
+/* Rectangles are clipped and merged this many at a time by SDL_FillRects() */
+#define SDL_FILLRECTS_BATCH 64
+
+typedef void (*SDL_FillRectFunc)(Uint8 *pixels, int pitch, Uint32 color, int w, int h);
 
 #ifdef __SSE__
 /* *INDENT-OFF* */
@@ -130,6 +141,91 @@ DEFINE_SSE_FILLRECT(4, Uint32)
 /* *INDENT-ON* */
 #endif /* __SSE__ */
 
+#if HAVE_AVX2_INTRINSICS
+/* Fills larger than the last level cache would evict everything else from it
+   on the way, so they bypass it with streaming stores instead. */
+static size_t
+SDL_GetFillStreamThreshold(void)
+{
+    static size_t threshold = 0;
+
+    if (!threshold) {
+        size_t cache_size = SDL_FILLRECT_DEFAULT_CACHE_SIZE;
+#if defined(HAVE_SYSCONF) && defined(_SC_LEVEL3_CACHE_SIZE)
+        const long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (size > 0) {
+            cache_size = (size_t)size;
+        }
+#endif
+        threshold = cache_size;
+    }
+    return threshold;
+}
+
+/* Fill 'n' bytes of whole pixels, 'color' is replicated to 32 bits */
+static SDL_INLINE void
+SDL_FillPixels(Uint8 *p, Uint32 color, int n, int bpp)
+{
+    switch (bpp) {
+    case 1:
+        SDL_memset(p, (Uint8)color, n);
+        break;
+    case 2:
+        for (n /= 2; n--; p += 2) {
+            *(Uint16 *)p = (Uint16)color;
+        }
+        break;
+    default:
+        SDL_memset4(p, color, n / 4);
+        break;
+    }
+}
+
+/* *INDENT-OFF* */
+
+/* The rows must start on a whole pixel boundary, so that the head fill leaves
+   'p' 32-byte aligned with the 32-bit color pattern in phase. */
+#define DEFINE_AVX2_FILLRECT(bpp, name, store, done) \
+static void SDL_TARGETING("avx2") \
+SDL_FillRect##bpp##name(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+{ \
+    const __m256i c256 = _mm256_set1_epi32((int)color); \
+    int i, n; \
+ \
+    while (h--) { \
+        Uint8 *p = pixels; \
+        n = w * bpp; \
+ \
+        if (n > 127) { \
+            const int adjust = (int)(-(intptr_t)p & 31); \
+            SDL_FillPixels(p, color, adjust, bpp); \
+            p += adjust; \
+            n -= adjust; \
+            for (i = n / 128; i--;) { \
+                store((__m256i *)(p+0), c256); \
+                store((__m256i *)(p+32), c256); \
+                store((__m256i *)(p+64), c256); \
+                store((__m256i *)(p+96), c256); \
+                p += 128; \
+            } \
+            n &= 127; \
+        } \
+        SDL_FillPixels(p, color, n, bpp); \
+        pixels += pitch; \
+    } \
+    done; \
+}
+
+DEFINE_AVX2_FILLRECT(1, AVX2, _mm256_store_si256, (void)0)
+DEFINE_AVX2_FILLRECT(2, AVX2, _mm256_store_si256, (void)0)
+DEFINE_AVX2_FILLRECT(4, AVX2, _mm256_store_si256, (void)0)
+DEFINE_AVX2_FILLRECT(1, AVX2Stream, _mm256_stream_si256, _mm_sfence())
+DEFINE_AVX2_FILLRECT(2, AVX2Stream, _mm256_stream_si256, _mm_sfence())
+DEFINE_AVX2_FILLRECT(4, AVX2Stream, _mm256_stream_si256, _mm_sfence())
+
+/* *INDENT-ON* */
+#endif /* HAVE_AVX2_INTRINSICS */
+
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 {
@@ -230,6 +326,69 @@ SDL_FillRect4(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
     }
 }
 
+/*
+ * Pick the fill function for a surface and widen 'color' to the 32-bit
+ * pattern it expects. 'size' is the number of bytes that will be filled.
+ */
+static SDL_FillRectFunc
+SDL_ChooseFillRectFunc(SDL_Surface * dst, Uint32 * color, size_t size)
+{
+    const int bpp = dst->format->BytesPerPixel;
+#if HAVE_AVX2_INTRINSICS
+    const SDL_bool avx2 = SDL_HasAVX2() &&
+        !(((uintptr_t)dst->pixels | (uintptr_t)dst->pitch) & (bpp - 1));
+    const SDL_bool stream = (size >= SDL_GetFillStreamThreshold());
+#endif
+
+    switch (bpp) {
+    case 1:
+        *color |= (*color << 8);
+        *color |= (*color << 16);
+#if HAVE_AVX2_INTRINSICS
+        if (avx2) {
+            return stream ? SDL_FillRect1AVX2Stream : SDL_FillRect1AVX2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect1SSE;
+        }
+#endif
+        return SDL_FillRect1;
+
+    case 2:
+        *color |= (*color << 16);
+#if HAVE_AVX2_INTRINSICS
+        if (avx2) {
+            return stream ? SDL_FillRect2AVX2Stream : SDL_FillRect2AVX2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect2SSE;
+        }
+#endif
+        return SDL_FillRect2;
+
+    case 3:
+        /* 24-bit RGB is a slow path, at least for now. */
+        return SDL_FillRect3;
+
+    default:
+#if HAVE_AVX2_INTRINSICS
+        if (avx2) {
+            return stream ? SDL_FillRect4AVX2Stream : SDL_FillRect4AVX2;
+        }
+#endif
+#ifdef __SSE__
+        if (SDL_HasSSE()) {
+            return SDL_FillRect4SSE;
+        }
+#endif
+        return SDL_FillRect4;
+    }
+}
+
 /* 
  * This function performs a fast fill of the given rectangle with 'color'
  */
@@ -237,6 +396,7 @@ int
 SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
 {
     SDL_Rect clipped;
+    SDL_FillRectFunc fill;
     Uint8 *pixels;
 
     if (!dst) {
@@ -271,73 +431,129 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
     pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
                                      rect->x * dst->format->BytesPerPixel;
 
-    switch (dst->format->BytesPerPixel) {
-    case 1:
-        {
-            color |= (color << 8);
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+    fill = SDL_ChooseFillRectFunc(dst, &color,
+                                  (size_t)rect->w * rect->h * dst->format->BytesPerPixel);
+    fill(pixels, dst->pitch, color, rect->w, rect->h);
 
-    case 2:
-        {
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+    /* We're done! */
+    return 0;
+}
 
-    case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
-        {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+/*
+ * Merge rectangles whose union is itself a rectangle: one containing the
+ * other, or rows and columns of the same extent that overlap or touch.
+ * Filling is idempotent, so this only saves writing pixels twice.
+ */
+static SDL_bool
+SDL_MergeFillRect(SDL_Rect * a, const SDL_Rect * b)
+{
+    if (b->x >= a->x && b->x + b->w <= a->x + a->w &&
+        b->y >= a->y && b->y + b->h <= a->y + a->h) {
+        return SDL_TRUE;
+    }
+    if (a->x >= b->x && a->x + a->w <= b->x + b->w &&
+        a->y >= b->y && a->y + a->h <= b->y + b->h) {
+        *a = *b;
+        return SDL_TRUE;
+    }
+    if (a->y == b->y && a->h == b->h &&
+        a->x <= b->x + b->w && b->x <= a->x + a->w) {
+        const int x2 = SDL_max(a->x + a->w, b->x + b->w);
+        a->x = SDL_min(a->x, b->x);
+        a->w = x2 - a->x;
+        return SDL_TRUE;
+    }
+    if (a->x == b->x && a->w == b->w &&
+        a->y <= b->y + b->h && b->y <= a->y + a->h) {
+        const int y2 = SDL_max(a->y + a->h, b->y + b->h);
+        a->y = SDL_min(a->y, b->y);
+        a->h = y2 - a->y;
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
 
-    case 4:
-        {
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+static int
+SDL_MergeFillRects(SDL_Rect * rects, int count)
+{
+    int i, j;
+
+    for (i = 0; i < count; ++i) {
+        for (j = i + 1; j < count;) {
+            if (SDL_MergeFillRect(&rects[i], &rects[j])) {
+                /* rects[i] may have grown, so check the rest against it again */
+                rects[j] = rects[--count];
+                j = i + 1;
+            } else {
+                ++j;
             }
-#endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
         }
     }
-
-    /* We're done! */
-    return 0;
+    return count;
 }
 
+/*
+ * Fill a list of rectangles, clipping them once and choosing a single fill
+ * function for the whole list
+ */
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    int i;
-    int status = 0;
+    SDL_Rect clipped[SDL_FILLRECTS_BATCH];
+    SDL_FillRectFunc fill;
+    size_t size = 0;
+    int bpp, i, j, n;
 
     if (!rects) {
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
+    if (count <= 0) {
+        return 0;
+    }
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_FillRect(): Unsupported surface format");
+    }
+    bpp = dst->format->BytesPerPixel;
 
     for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
+        if (SDL_IntersectRect(&rects[i], &dst->clip_rect, &clipped[0])) {
+            size += (size_t)clipped[0].w * clipped[0].h * bpp;
+        }
+    }
+    if (!size) {
+        return 0;
+    }
+
+    /* Perform software fill */
+    if (!dst->pixels) {
+        return SDL_SetError("SDL_FillRect(): You must lock the surface");
     }
-    return status;
+
+    fill = SDL_ChooseFillRectFunc(dst, &color, size);
+    for (i = 0; i < count; i += SDL_FILLRECTS_BATCH) {
+        const int batch = SDL_min(count - i, SDL_FILLRECTS_BATCH);
+
+        n = 0;
+        for (j = 0; j < batch; ++j) {
+            if (SDL_IntersectRect(&rects[i + j], &dst->clip_rect, &clipped[n])) {
+                ++n;
+            }
+        }
+        n = SDL_MergeFillRects(clipped, n);
+
+        for (j = 0; j < n; ++j) {
+            Uint8 *pixels = (Uint8 *) dst->pixels + clipped[j].y * dst->pitch +
+                                                    clipped[j].x * bpp;
+            fill(pixels, dst->pitch, color, clipped[j].w, clipped[j].h);
+        }
+    }
+    return 0;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -968,12 +968,10 @@ SDL_AllocBlitMap(void)
     return (map);
 }
 
-void
-SDL_InvalidateMap(SDL_BlitMap * map)
+/* Drop the current mapping, leaving any cached ones alone */
+static void
+SDL_ReleaseMap(SDL_BlitMap * map)
 {
-    if (!map) {
-        return;
-    }
     if (map->dst) {
         /* Release our reference to the surface - see the note below */
         if (--map->dst->refcount <= 0) {
@@ -987,6 +985,115 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->info.table = NULL;
 }
 
+void
+SDL_InvalidateMap(SDL_BlitMap * map)
+{
+    int i;
+
+    if (!map) {
+        return;
+    }
+    SDL_ReleaseMap(map);
+
+    /* The cached mappings were made with the old source settings too */
+    for (i = 0; i < map->num_cached; ++i) {
+        SDL_FreeFormat(map->cache[i].dst_fmt);
+        SDL_free(map->cache[i].table);
+    }
+    map->num_cached = 0;
+}
+
+/* Move the current mapping into the cache, in case we switch back to it */
+static void
+SDL_CacheMap(SDL_BlitMap * map)
+{
+    SDL_BlitMapCacheEntry *entry;
+
+    /* RLE data is encoded for a single destination, so it can't be kept */
+    if (!map->dst || !map->data || (map->info.flags & SDL_COPY_RLE_DESIRED)) {
+        SDL_ReleaseMap(map);
+        return;
+    }
+
+    /* Evict the least recently used mapping if we're full */
+    if (map->num_cached == SDL_BLITMAP_CACHE_SIZE) {
+        entry = &map->cache[--map->num_cached];
+        SDL_FreeFormat(entry->dst_fmt);
+        SDL_free(entry->table);
+    }
+    SDL_memmove(&map->cache[1], &map->cache[0],
+                map->num_cached * sizeof(*entry));
+    ++map->num_cached;
+
+    /* The destination surface may go away, but its format won't while
+       we hold a reference, so the pointer can't be reused for another one.
+     */
+    entry = &map->cache[0];
+    entry->dst_fmt = map->dst->format;
+    SDL_AtomicLock(&formats_lock);
+    ++entry->dst_fmt->refcount;
+    SDL_AtomicUnlock(&formats_lock);
+    entry->dst_palette_version = map->dst_palette_version;
+    entry->src_palette_version = map->src_palette_version;
+    entry->flags = map->info.flags;
+    entry->r = map->info.r;
+    entry->g = map->info.g;
+    entry->b = map->info.b;
+    entry->a = map->info.a;
+    entry->identity = map->identity;
+    entry->blit = map->blit;
+    entry->data = map->data;
+    entry->table = map->info.table;
+    map->info.table = NULL;
+
+    SDL_ReleaseMap(map);
+}
+
+/* Switch back to a cached mapping for this destination, if we have one */
+static SDL_bool
+SDL_RestoreMap(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_PixelFormat *srcfmt = src->format;
+    SDL_PixelFormat *dstfmt = dst->format;
+    Uint32 src_palette_version = srcfmt->palette ? srcfmt->palette->version : 0;
+    Uint32 dst_palette_version = dstfmt->palette ? dstfmt->palette->version : 0;
+    SDL_BlitMapCacheEntry *entry;
+    int i;
+
+    for (i = 0; i < map->num_cached; ++i) {
+        entry = &map->cache[i];
+        if (entry->dst_fmt != dstfmt ||
+            entry->dst_palette_version != dst_palette_version ||
+            entry->src_palette_version != src_palette_version ||
+            entry->flags != map->info.flags ||
+            entry->r != map->info.r || entry->g != map->info.g ||
+            entry->b != map->info.b || entry->a != map->info.a) {
+            continue;
+        }
+
+        map->identity = entry->identity;
+        map->blit = entry->blit;
+        map->data = entry->data;
+        map->info.table = entry->table;
+        map->info.src_fmt = srcfmt;
+        map->info.src_pitch = src->pitch;
+        map->info.dst_fmt = dstfmt;
+        map->info.dst_pitch = dst->pitch;
+        map->dst = dst;
+        ++map->dst->refcount;
+        map->dst_palette_version = dst_palette_version;
+        map->src_palette_version = src_palette_version;
+
+        /* The destination surface holds the format now */
+        SDL_FreeFormat(entry->dst_fmt);
+        --map->num_cached;
+        SDL_memmove(entry, entry + 1, (map->num_cached - i) * sizeof(*entry));
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 int
 SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
 {
@@ -994,12 +1101,20 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Set aside any previous mapping */
     map = src->map;
     if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
         SDL_UnRLESurface(src, 1);
     }
-    SDL_InvalidateMap(map);
+    if (map->dst == dst) {
+        /* A palette changed, so the current mapping is stale */
+        SDL_ReleaseMap(map);
+    } else {
+        SDL_CacheMap(map);
+    }
+    if (SDL_RestoreMap(src, dst)) {
+        return 0;
+    }
 
     /* Figure out what kind of mapping we're doing */
     map->identity = 0;
@@ -1078,6 +1193,7 @@ SDL_FreeBlitMap(SDL_BlitMap * map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_FreeSurface(map->scaled);
         SDL_free(map);
     }
 }
@@ -197,7 +197,8 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
 }
 
 /* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
+   NOTE:  With USE_ASM_STRETCH this shares a generated copy routine, and is
+          not safe to call from multiple threads!
 */
 int
 SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
@@ -350,4 +351,389 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     return (0);
 }
 
+/* Filtered (linear and area-averaging) stretching of 32-bit pixels.
+
+   Each output row and column is a weighted sum of a few source rows and
+   columns, described by a list of taps with 14 bit fixed point weights that
+   sum to 1.0. The rows are combined first into a single row of source
+   pixels, kept with 7 extra bits of precision so only the final result is
+   rounded, which is then resampled horizontally. All four bytes of a pixel
+   are filtered the same way, so this works for any 8888 layout.
+*/
+#define STRETCH_WEIGHT_BITS 14
+#define STRETCH_WEIGHT_ONE  (1 << STRETCH_WEIGHT_BITS)
+#define STRETCH_ROW_BITS    7
+#define STRETCH_ROW_SHIFT   (STRETCH_WEIGHT_BITS - STRETCH_ROW_BITS)
+#define STRETCH_OUT_SHIFT   (STRETCH_WEIGHT_BITS + STRETCH_ROW_BITS)
+
+typedef struct
+{
+    int first;              /* first source pixel */
+    int count;              /* number of source pixels */
+    const Sint16 *weights;  /* one weight per source pixel */
+} SDL_StretchTaps;
+
+static SDL_StretchTaps *
+BuildStretchTaps(int src_len, int dst_len, int quality)
+{
+    SDL_StretchTaps *taps;
+    Sint16 *weights;
+    int i;
+
+    /* Linear taps use at most two pixels, area taps at most one more than
+       the number of whole source pixels an output pixel covers. */
+    taps = (SDL_StretchTaps *) SDL_malloc(dst_len * sizeof(*taps) +
+                                          (src_len + 2 * dst_len) * sizeof(*weights));
+    if (!taps) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    weights = (Sint16 *) (taps + dst_len);
+
+    for (i = 0; i < dst_len; ++i) {
+        SDL_StretchTaps *tap = &taps[i];
+
+        tap->weights = weights;
+        if (quality >= SDL_SCALE_BEST && src_len > dst_len) {
+            /* Average every source pixel the output pixel covers, working
+               in units of 1/dst_len of a source pixel */
+            const Sint64 start = (Sint64) i * src_len;
+            const Sint64 end = start + src_len;
+            int first = (int) (start / dst_len);
+            int last = (int) ((end - 1) / dst_len);
+            int total = 0;
+            int j;
+
+            for (j = first; j <= last; ++j) {
+                const Sint64 lo = SDL_max(start, (Sint64) j * dst_len);
+                const Sint64 hi = SDL_min(end, (Sint64) (j + 1) * dst_len);
+                *weights = (Sint16) ((hi - lo) * STRETCH_WEIGHT_ONE / src_len);
+                total += *weights++;
+            }
+            weights[-1] += STRETCH_WEIGHT_ONE - total;
+            tap->first = first;
+            tap->count = last - first + 1;
+        } else {
+            /* Interpolate between the two source pixel centers nearest to
+               the output pixel center */
+            Sint64 pos = ((Sint64) (2 * i + 1) * src_len << 16) / (2 * dst_len) - 0x8000;
+            int frac;
+
+            if (pos < 0) {
+                pos = 0;
+            }
+            tap->first = (int) (pos >> 16);
+            frac = (int) (pos & 0xffff) >> (16 - STRETCH_WEIGHT_BITS);
+            if (tap->first >= src_len - 1) {
+                tap->first = src_len - 1;
+                frac = 0;
+            }
+            if (frac) {
+                *weights++ = (Sint16) (STRETCH_WEIGHT_ONE - frac);
+                *weights++ = (Sint16) frac;
+                tap->count = 2;
+            } else {
+                *weights++ = STRETCH_WEIGHT_ONE;
+                tap->count = 1;
+            }
+        }
+    }
+    return taps;
+}
+
+/* Combine tap->count rows of 'len' bytes, 'pitch' bytes apart */
+static void
+StretchRowsVertical(const Uint8 * src, int pitch, const SDL_StretchTaps * tap,
+                    Uint16 * dst, int len)
+{
+    int i, k;
+
+    for (i = 0; i < len; ++i) {
+        const Uint8 *p = src + i;
+        int sum = 1 << (STRETCH_ROW_SHIFT - 1);
+
+        for (k = 0; k < tap->count; ++k, p += pitch) {
+            sum += *p * tap->weights[k];
+        }
+        dst[i] = (Uint16) (sum >> STRETCH_ROW_SHIFT);
+    }
+}
+
+static void
+StretchRowHorizontal(const Uint16 * src, const SDL_StretchTaps * taps,
+                     Uint32 * dst, int dst_w)
+{
+    int i, k;
+
+    for (i = 0; i < dst_w; ++i) {
+        const SDL_StretchTaps *tap = &taps[i];
+        const Uint16 *p = src + tap->first * 4;
+        Uint8 *out = (Uint8 *) (dst + i);
+        int sum0 = 1 << (STRETCH_OUT_SHIFT - 1);
+        int sum1 = sum0, sum2 = sum0, sum3 = sum0;
+
+        for (k = 0; k < tap->count; ++k, p += 4) {
+            const int w = tap->weights[k];
+            sum0 += p[0] * w;
+            sum1 += p[1] * w;
+            sum2 += p[2] * w;
+            sum3 += p[3] * w;
+        }
+        out[0] = (Uint8) (sum0 >> STRETCH_OUT_SHIFT);
+        out[1] = (Uint8) (sum1 >> STRETCH_OUT_SHIFT);
+        out[2] = (Uint8) (sum2 >> STRETCH_OUT_SHIFT);
+        out[3] = (Uint8) (sum3 >> STRETCH_OUT_SHIFT);
+    }
+}
+
+/* The weights of taps k and k+1 packed for pmaddwd */
+#define STRETCH_WEIGHT_PAIR(tap, k) \
+    (int) ((Uint16) (tap)->weights[k] | (((k) + 1 < (tap)->count) ? ((Uint32) (tap)->weights[(k) + 1] << 16) : 0))
+
+#ifdef __SSE2__
+static void
+StretchRowsVerticalSSE2(const Uint8 * src, int pitch, const SDL_StretchTaps * tap,
+                        Uint16 * dst, int len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi32(1 << (STRETCH_ROW_SHIFT - 1));
+    int i, k;
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        const Uint8 *p = src + i;
+        __m128i sum0 = half, sum1 = half, sum2 = half, sum3 = half;
+
+        /* two rows at a time, interleaved so pmaddwd applies both weights */
+        for (k = 0; k < tap->count; k += 2, p += 2 * pitch) {
+            const __m128i w = _mm_set1_epi32(STRETCH_WEIGHT_PAIR(tap, k));
+            const __m128i r0 = _mm_loadu_si128((const __m128i *) p);
+            const __m128i r1 = (k + 1 < tap->count) ? _mm_loadu_si128((const __m128i *) (p + pitch)) : zero;
+            const __m128i lo0 = _mm_unpacklo_epi8(r0, zero);
+            const __m128i lo1 = _mm_unpacklo_epi8(r1, zero);
+            const __m128i hi0 = _mm_unpackhi_epi8(r0, zero);
+            const __m128i hi1 = _mm_unpackhi_epi8(r1, zero);
+
+            sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(lo0, lo1), w));
+            sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(lo0, lo1), w));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi16(hi0, hi1), w));
+            sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi16(hi0, hi1), w));
+        }
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_packs_epi32(_mm_srai_epi32(sum0, STRETCH_ROW_SHIFT), _mm_srai_epi32(sum1, STRETCH_ROW_SHIFT)));
+        _mm_storeu_si128((__m128i *) (dst + i + 8),
+                         _mm_packs_epi32(_mm_srai_epi32(sum2, STRETCH_ROW_SHIFT), _mm_srai_epi32(sum3, STRETCH_ROW_SHIFT)));
+    }
+    StretchRowsVertical(src + i, pitch, tap, dst + i, len - i);
+}
+
+static void
+StretchRowHorizontalSSE2(const Uint16 * src, const SDL_StretchTaps * taps,
+                         Uint32 * dst, int dst_w)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi32(1 << (STRETCH_OUT_SHIFT - 1));
+    int i, k;
+
+    for (i = 0; i < dst_w; ++i) {
+        const SDL_StretchTaps *tap = &taps[i];
+        const Uint16 *p = src + tap->first * 4;
+        __m128i sum = half;
+
+        for (k = 0; k + 1 < tap->count; k += 2, p += 8) {
+            /* interleave the channels of two neighbouring pixels */
+            __m128i px = _mm_loadu_si128((const __m128i *) p);
+            px = _mm_unpacklo_epi16(px, _mm_srli_si128(px, 8));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(px, _mm_set1_epi32(STRETCH_WEIGHT_PAIR(tap, k))));
+        }
+        if (k < tap->count) {
+            __m128i px = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *) p), zero);
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(px, _mm_set1_epi32(tap->weights[k])));
+        }
+        sum = _mm_srai_epi32(sum, STRETCH_OUT_SHIFT);
+        sum = _mm_packs_epi32(sum, sum);
+        dst[i] = (Uint32) _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+    }
+}
+#endif /* __SSE2__ */
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+StretchRowsVerticalAVX2(const Uint8 * src, int pitch, const SDL_StretchTaps * tap,
+                        Uint16 * dst, int len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i half = _mm256_set1_epi32(1 << (STRETCH_ROW_SHIFT - 1));
+    int i, k;
+
+    for (i = 0; i + 32 <= len; i += 32) {
+        const Uint8 *p = src + i;
+        __m256i sum0 = half, sum1 = half, sum2 = half, sum3 = half;
+
+        for (k = 0; k < tap->count; k += 2, p += 2 * pitch) {
+            const __m256i w = _mm256_set1_epi32(STRETCH_WEIGHT_PAIR(tap, k));
+            const __m256i r0 = _mm256_loadu_si256((const __m256i *) p);
+            const __m256i r1 = (k + 1 < tap->count) ? _mm256_loadu_si256((const __m256i *) (p + pitch)) : zero;
+            const __m256i lo0 = _mm256_unpacklo_epi8(r0, zero);
+            const __m256i lo1 = _mm256_unpacklo_epi8(r1, zero);
+            const __m256i hi0 = _mm256_unpackhi_epi8(r0, zero);
+            const __m256i hi1 = _mm256_unpackhi_epi8(r1, zero);
+
+            sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(_mm256_unpacklo_epi16(lo0, lo1), w));
+            sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(_mm256_unpackhi_epi16(lo0, lo1), w));
+            sum2 = _mm256_add_epi32(sum2, _mm256_madd_epi16(_mm256_unpacklo_epi16(hi0, hi1), w));
+            sum3 = _mm256_add_epi32(sum3, _mm256_madd_epi16(_mm256_unpackhi_epi16(hi0, hi1), w));
+        }
+        /* the unpacks work within 128 bit lanes, so put the halves back in order */
+        sum0 = _mm256_packs_epi32(_mm256_srai_epi32(sum0, STRETCH_ROW_SHIFT), _mm256_srai_epi32(sum1, STRETCH_ROW_SHIFT));
+        sum2 = _mm256_packs_epi32(_mm256_srai_epi32(sum2, STRETCH_ROW_SHIFT), _mm256_srai_epi32(sum3, STRETCH_ROW_SHIFT));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute2x128_si256(sum0, sum2, 0x20));
+        _mm256_storeu_si256((__m256i *) (dst + i + 16), _mm256_permute2x128_si256(sum0, sum2, 0x31));
+    }
+    StretchRowsVertical(src + i, pitch, tap, dst + i, len - i);
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+SDL_bool
+SDL_SoftStretchFilterable(const SDL_PixelFormat * format)
+{
+    return (format->BytesPerPixel == 4 &&
+            format->Rloss == 0 && format->Gloss == 0 && format->Bloss == 0 &&
+            (format->Amask == 0 || format->Aloss == 0) &&
+            format->Rshift % 8 == 0 && format->Gshift % 8 == 0 &&
+            format->Bshift % 8 == 0 && format->Ashift % 8 == 0);
+}
+
+/* Perform a filtered stretch blit between two 32-bit surfaces of the same
+   format. This is re-entrant, all scratch memory is allocated per call.
+*/
+int
+SDL_SoftStretchFiltered(SDL_Surface * src, const SDL_Rect * srcrect,
+                        SDL_Surface * dst, const SDL_Rect * dstrect,
+                        int quality)
+{
+    void (*rows_vertical)(const Uint8 *, int, const SDL_StretchTaps *, Uint16 *, int) = StretchRowsVertical;
+    void (*row_horizontal)(const Uint16 *, const SDL_StretchTaps *, Uint32 *, int) = StretchRowHorizontal;
+    SDL_StretchTaps *taps_x;
+    SDL_StretchTaps *taps_y;
+    Uint16 *row;
+    int src_locked;
+    int dst_locked;
+    int y;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (quality == SDL_SCALE_NEAREST) {
+        return SDL_SoftStretch(src, srcrect, dst, dstrect);
+    }
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+    if (!SDL_SoftStretchFilterable(src->format)) {
+        return SDL_SetError("Filtered stretch only works with 32-bit formats");
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    taps_x = BuildStretchTaps(srcrect->w, dstrect->w, quality);
+    taps_y = BuildStretchTaps(srcrect->h, dstrect->h, quality);
+    row = (Uint16 *) SDL_malloc(srcrect->w * 4 * sizeof(*row));
+    if (!taps_x || !taps_y || !row) {
+        SDL_free(taps_x);
+        SDL_free(taps_y);
+        SDL_free(row);
+        return SDL_OutOfMemory();
+    }
+
+    /* Lock the destination if it's in hardware */
+    dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            SDL_free(taps_x);
+            SDL_free(taps_y);
+            SDL_free(row);
+            return SDL_SetError("Unable to lock destination surface");
+        }
+        dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            SDL_free(taps_x);
+            SDL_free(taps_y);
+            SDL_free(row);
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        rows_vertical = StretchRowsVerticalSSE2;
+        row_horizontal = StretchRowHorizontalSSE2;
+    }
+#endif
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        rows_vertical = StretchRowsVerticalAVX2;
+    }
+#endif
+
+    /* Perform the stretch blit */
+    for (y = 0; y < dstrect->h; ++y) {
+        const SDL_StretchTaps *tap = &taps_y[y];
+        const Uint8 *srcp = (const Uint8 *) src->pixels
+            + (srcrect->y + tap->first) * src->pitch + srcrect->x * 4;
+        Uint32 *dstp = (Uint32 *) ((Uint8 *) dst->pixels
+            + (dstrect->y + y) * dst->pitch + dstrect->x * 4);
+
+        rows_vertical(srcp, src->pitch, tap, row, srcrect->w * 4);
+        row_horizontal(row, taps_x, dstp, dstrect->w);
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    SDL_free(taps_x);
+    SDL_free(taps_y);
+    SDL_free(row);
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
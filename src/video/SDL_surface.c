@@ -21,12 +21,16 @@
 #include "../SDL_internal.h"
 
 #include "SDL_video.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 
+#define SDL_CONVERT_MAX_BANDS       16
+#define SDL_CONVERT_MIN_BAND_ROWS   16
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
 SDL_COMPILE_TIME_ASSERT(surface_size_assumptions,
@@ -720,9 +724,37 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
     return 0;
 }
 
+/* Get the scaled blit filtering requested by SDL_HINT_RENDER_SCALE_QUALITY */
+static int
+SDL_GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || SDL_strcasecmp(hint, "nearest") == 0) {
+        return SDL_SCALE_NEAREST;
+    } else if (SDL_strcasecmp(hint, "linear") == 0) {
+        return SDL_SCALE_LINEAR;
+    } else if (SDL_strcasecmp(hint, "best") == 0) {
+        return SDL_SCALE_BEST;
+    } else {
+        return SDL_atoi(hint);
+    }
+}
+
+static int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                           SDL_Surface * dst, SDL_Rect * dstrect, int quality);
+
 int
 SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateUpperBlitScaled(src, srcrect, dst, dstrect, SDL_GetScaleQuality());
+}
+
+int
+SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                           SDL_Surface * dst, SDL_Rect * dstrect, int quality)
 {
     double src_x0, src_y0, src_x1, src_y1;
     double dst_x0, dst_y0, dst_x1, dst_y1;
@@ -867,7 +899,7 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
         return 0;
     }
 
-    return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
+    return SDL_PrivateLowerBlitScaled(src, &final_src, dst, &final_dst, quality);
 }
 
 /**
@@ -877,6 +909,69 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
                 SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_GetScaleQuality());
+}
+
+/* Filter the source into a surface of its own format and the destination
+   size, then let the regular blitters convert and blend that. The scratch
+   surface is kept with the source's blit map and reused while it's big
+   enough, so repeated blits don't allocate or rebuild its mapping. */
+static int
+SDL_BlitScaledFiltered(SDL_Surface * src, SDL_Rect * srcrect,
+                       SDL_Surface * dst, SDL_Rect * dstrect, int quality)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_Surface *scaled = map->scaled;
+    SDL_BlitInfo *info;
+    Uint32 flags;
+    SDL_Rect rect;
+    int retval;
+
+    if (!scaled || scaled->format->format != src->format->format ||
+        scaled->w < dstrect->w || scaled->h < dstrect->h) {
+        int w = dstrect->w;
+        int h = dstrect->h;
+
+        if (scaled && scaled->format->format == src->format->format) {
+            w = SDL_max(w, scaled->w);
+            h = SDL_max(h, scaled->h);
+        }
+        SDL_FreeSurface(scaled);
+        scaled = map->scaled = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32,
+                                                              src->format->format);
+        if (!scaled) {
+            return -1;
+        }
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = dstrect->w;
+    rect.h = dstrect->h;
+    retval = SDL_SoftStretchFiltered(src, srcrect, scaled, &rect, quality);
+    if (retval < 0) {
+        return retval;
+    }
+
+    /* Only remap the scratch surface when the source settings changed */
+    info = &scaled->map->info;
+    flags = map->info.flags & ~(SDL_COPY_NEAREST | SDL_COPY_RLE_MASK);
+    if (info->flags != flags ||
+        info->r != map->info.r || info->g != map->info.g ||
+        info->b != map->info.b || info->a != map->info.a) {
+        info->flags = flags;
+        info->r = map->info.r;
+        info->g = map->info.g;
+        info->b = map->info.b;
+        info->a = map->info.a;
+        SDL_InvalidateMap(scaled->map);
+    }
+    return SDL_LowerBlit(scaled, &rect, dst, dstrect);
+}
+
+static int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                           SDL_Surface * dst, SDL_Rect * dstrect, int quality)
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
@@ -884,6 +979,18 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_COPY_COLORKEY
     );
 
+    /* Filtering would bleed the colorkey into its neighbours, so colorkeyed
+       surfaces are always scaled with nearest sampling */
+    if (quality != SDL_SCALE_NEAREST &&
+        !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+        SDL_SoftStretchFilterable(src->format)) {
+        if (!(src->map->info.flags & complex_copy_flags) &&
+            src->format->format == dst->format->format) {
+            return SDL_SoftStretchFiltered(src, srcrect, dst, dstrect, quality);
+        }
+        return SDL_BlitScaledFiltered(src, srcrect, dst, dstrect, quality);
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -937,6 +1044,25 @@ SDL_UnlockSurface(SDL_Surface * surface)
     }
 }
 
+/*
+ * Get the number of row bands a conversion of this size is split into,
+ * 1 if it should run on the calling thread.
+ */
+static int
+SDL_GetConversionBands(int width, int height)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD);
+    const Sint64 threshold = hint ? SDL_strtoll(hint, NULL, 10) : 0;
+    int num_bands;
+
+    if (threshold <= 0 || (Sint64)width * height < threshold) {
+        return 1;
+    }
+    num_bands = SDL_min(SDL_GetNumJobThreads() + 1, SDL_CONVERT_MAX_BANDS);
+    num_bands = SDL_min(num_bands, height / SDL_CONVERT_MIN_BAND_ROWS);
+    return SDL_max(num_bands, 1);
+}
+
 /*
  * Creates a new surface identical to the existing surface
  */
@@ -1017,7 +1143,17 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     bounds.y = 0;
     bounds.w = surface->w;
     bounds.h = surface->h;
-    SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    if (!(surface->flags & SDL_RLEACCEL) &&
+        !SDL_ISPIXELFORMAT_INDEXED(surface->format->format) &&
+        !SDL_ISPIXELFORMAT_INDEXED(convert->format->format) &&
+        SDL_GetConversionBands(surface->w, surface->h) > 1) {
+        /* Plain pixel copies of large surfaces are split across threads */
+        SDL_ConvertPixels(surface->w, surface->h,
+                          surface->format->format, surface->pixels, surface->pitch,
+                          convert->format->format, convert->pixels, convert->pitch);
+    } else {
+        SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    }
 
     /* Clean up the original surface, and update converted surface */
     convert->map->info.r = copy_color.r;
@@ -1163,9 +1299,10 @@ SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
 }
 
 /*
- * Copy a block of pixels of one format to another format
+ * Copy a block of pixels between two RGB formats on the calling thread
  */
-int SDL_ConvertPixels(int width, int height,
+static int
+SDL_ConvertPixelsRows(int width, int height,
                       Uint32 src_format, const void * src, int src_pitch,
                       Uint32 dst_format, void * dst, int dst_pitch)
 {
@@ -1175,22 +1312,6 @@ int SDL_ConvertPixels(int width, int height,
     SDL_Rect rect;
     void *nonconst_src = (void *) src;
 
-    /* Check to make sure we are blitting somewhere, so we don't crash */
-    if (!dst) {
-        return SDL_InvalidParamError("dst");
-    }
-    if (!dst_pitch) {
-        return SDL_InvalidParamError("dst_pitch");
-    }
-
-    if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
-        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    }
-
     /* Fast path for same format copy */
     if (src_format == dst_format) {
         int i;
@@ -1222,6 +1343,119 @@ int SDL_ConvertPixels(int width, int height,
     return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
 }
 
+typedef struct
+{
+    int width;
+    int height;
+    Uint32 src_format;
+    const void *src;
+    int src_pitch;
+    Uint32 dst_format;
+    void *dst;
+    int dst_pitch;
+    int result;
+} SDL_ConvertBand;
+
+static void SDLCALL
+SDL_RunConvertBand(void *data)
+{
+    SDL_ConvertBand *band = (SDL_ConvertBand *)data;
+    band->result = SDL_ConvertPixelsRows(band->width, band->height,
+                                         band->src_format, band->src, band->src_pitch,
+                                         band->dst_format, band->dst, band->dst_pitch);
+}
+
+/* Convert the rows in bands that run on the job pool. Each band blits
+   through its own stack surfaces, so no blit state is shared between threads. */
+static int
+SDL_ConvertPixelsBands(int num_bands, int width, int height,
+                       Uint32 src_format, const void * src, int src_pitch,
+                       Uint32 dst_format, void * dst, int dst_pitch)
+{
+    SDL_ConvertBand bands[SDL_CONVERT_MAX_BANDS];
+    SDL_JobCounter *counter;
+    int band_rows, i;
+
+    counter = SDL_CreateJobCounter();
+    if (!counter) {
+        return SDL_ConvertPixelsRows(width, height, src_format, src, src_pitch,
+                                     dst_format, dst, dst_pitch);
+    }
+
+    band_rows = (height + num_bands - 1) / num_bands;
+    num_bands = 0;
+    for (i = 0; i < height; i += band_rows) {
+        SDL_ConvertBand *band = &bands[num_bands++];
+        band->width = width;
+        band->height = SDL_min(band_rows, height - i);
+        band->src_format = src_format;
+        band->src = (const Uint8 *)src + (size_t)i * src_pitch;
+        band->src_pitch = src_pitch;
+        band->dst_format = dst_format;
+        band->dst = (Uint8 *)dst + (size_t)i * dst_pitch;
+        band->dst_pitch = dst_pitch;
+        band->result = 0;
+    }
+
+    /* The calling thread converts the first band while the pool runs the rest */
+    for (i = 1; i < num_bands; ++i) {
+        if (SDL_AddJob(SDL_RunConvertBand, &bands[i], counter, NULL) < 0) {
+            SDL_RunConvertBand(&bands[i]);
+        }
+    }
+    SDL_RunConvertBand(&bands[0]);
+    SDL_WaitJobCounter(counter);
+    SDL_DestroyJobCounter(counter);
+
+    if (bands[0].result < 0) {
+        return bands[0].result;
+    }
+    for (i = 1; i < num_bands; ++i) {
+        if (bands[i].result < 0) {
+            return SDL_SetError("Couldn't convert pixels");
+        }
+    }
+    return 0;
+}
+
+/*
+ * Copy a block of pixels of one format to another format
+ */
+int SDL_ConvertPixels(int width, int height,
+                      Uint32 src_format, const void * src, int src_pitch,
+                      Uint32 dst_format, void * dst, int dst_pitch)
+{
+    int num_bands;
+
+    /* Check to make sure we are blitting somewhere, so we don't crash */
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (!dst_pitch) {
+        return SDL_InvalidParamError("dst_pitch");
+    }
+
+    if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
+        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    }
+
+    /* Some blitters step through rows in whole pixels, which drifts on rows
+       that don't start 4-byte aligned; only split if each band starts the same
+       way the whole image does */
+    num_bands = SDL_GetConversionBands(width, height);
+    if (num_bands > 1 && !((src_pitch | dst_pitch) & 3)) {
+        return SDL_ConvertPixelsBands(num_bands, width, height,
+                                      src_format, src, src_pitch,
+                                      dst_format, dst, dst_pitch);
+    }
+    return SDL_ConvertPixelsRows(width, height, src_format, src, src_pitch,
+                                 dst_format, dst, dst_pitch);
+}
+
 /*
  * Free a surface created by the above function.
  */
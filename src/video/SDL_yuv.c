@@ -21,6 +21,8 @@
 #include "../SDL_internal.h"
 
 #include "SDL_endian.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
@@ -29,6 +31,11 @@
 
 #define SDL_YUV_SD_THRESHOLD    576
 
+/* Frames of at least this many pixels are converted in bands on the job pool */
+#define SDL_YUV_THREADS_THRESHOLD   (1280 * 720)
+#define SDL_YUV_MAX_BANDS           16
+#define SDL_YUV_MIN_BAND_ROWS       16
+
 
 static SDL_YUV_CONVERSION_MODE SDL_YUV_ConversionMode = SDL_YUV_CONVERSION_BT601;
 
@@ -179,16 +186,260 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
-static SDL_bool yuv_rgb_sse(
-    Uint32 src_format, Uint32 dst_format,
-    Uint32 width, Uint32 height, 
-    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
-    Uint8 *rgb, Uint32 rgb_stride, 
-    YCbCrType yuv_type)
+typedef void (*YUVToRGBFunc)(
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type);
+
+typedef Uint32 (*ARGBToYRowFunc)(
+    const Uint8 *argb, Uint8 *y, Uint32 width,
+    const float *factors, int offset);
+
+typedef Uint32 (*ARGBToUVRowFunc)(
+    const Uint8 *argb1, const Uint8 *argb2, Uint32 width_half,
+    const float *factors1, const float *factors2,
+    Uint8 *out1, Uint8 *out2, Uint32 out_step);
+
+typedef void (*SDL_YUVRowsFunc)(void *data, int y, int h);
+
+typedef struct
+{
+    SDL_YUVRowsFunc convert;
+    void *data;
+    int y;
+    int h;
+} SDL_YUVBand;
+
+static void SDLCALL
+SDL_RunYUVBand(void *data)
+{
+    const SDL_YUVBand *band = (const SDL_YUVBand *)data;
+    band->convert(band->data, band->y, band->h);
+}
+
+/* Convert all the rows of a frame, splitting large frames into bands of rows
+   that run on the job pool. Bands start on even rows, so a row of 2x2 chroma
+   samples is never split between two bands. */
+static void
+SDL_ConvertYUVRows(SDL_YUVRowsFunc convert, void *data, int width, int height)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD);
+    const Sint64 threshold = hint ? SDL_strtoll(hint, NULL, 10) : SDL_YUV_THREADS_THRESHOLD;
+    SDL_YUVBand bands[SDL_YUV_MAX_BANDS];
+    SDL_JobCounter *counter;
+    int num_bands, band_rows, i;
+
+    if (threshold <= 0 || (Sint64)width * height < threshold) {
+        convert(data, 0, height);
+        return;
+    }
+
+    num_bands = SDL_min(SDL_GetNumJobThreads() + 1, SDL_YUV_MAX_BANDS);
+    num_bands = SDL_min(num_bands, height / SDL_YUV_MIN_BAND_ROWS);
+    if (num_bands < 2) {
+        convert(data, 0, height);
+        return;
+    }
+
+    counter = SDL_CreateJobCounter();
+    if (!counter) {
+        convert(data, 0, height);
+        return;
+    }
+
+    band_rows = (((height + num_bands - 1) / num_bands) + 1) & ~1;
+    num_bands = 0;
+    for (i = 0; i < height; i += band_rows) {
+        bands[num_bands].convert = convert;
+        bands[num_bands].data = data;
+        bands[num_bands].y = i;
+        bands[num_bands].h = SDL_min(band_rows, height - i);
+        ++num_bands;
+    }
+
+    /* The calling thread converts the first band while the pool runs the rest */
+    for (i = 1; i < num_bands; ++i) {
+        if (SDL_AddJob(SDL_RunYUVBand, &bands[i], counter, NULL) < 0) {
+            SDL_RunYUVBand(&bands[i]);
+        }
+    }
+    SDL_RunYUVBand(&bands[0]);
+    SDL_WaitJobCounter(counter);
+    SDL_DestroyJobCounter(counter);
+}
+
+static YUVToRGBFunc yuv_rgb_avx2(Uint32 src_format, Uint32 dst_format)
+{
+#if HAVE_AVX2_INTRINSICS
+    if (!SDL_HasAVX2()) {
+        return NULL;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuv420_rgb565_avx2;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuv420_rgba_avx2;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuv420_bgra_avx2;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuv420_argb_avx2;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuv420_abgr_avx2;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuv422_rgb565_avx2;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuv422_rgba_avx2;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuv422_bgra_avx2;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuv422_argb_avx2;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuv422_abgr_avx2;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuvnv12_rgb565_avx2;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuvnv12_rgba_avx2;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuvnv12_bgra_avx2;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuvnv12_argb_avx2;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuvnv12_abgr_avx2;
+        default:
+            break;
+        }
+    }
+#endif
+    return NULL;
+}
+
+static YUVToRGBFunc yuv_rgb_sse(Uint32 src_format, Uint32 dst_format)
 {
 #ifdef __SSE2__
     if (!SDL_HasSSE2()) {
-        return SDL_FALSE;
+        return NULL;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuv420_rgb565_sseu;
+        case SDL_PIXELFORMAT_RGB24:
+            return yuv420_rgb24_sseu;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuv420_rgba_sseu;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuv420_bgra_sseu;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuv420_argb_sseu;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuv420_abgr_sseu;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuv422_rgb565_sseu;
+        case SDL_PIXELFORMAT_RGB24:
+            return yuv422_rgb24_sseu;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuv422_rgba_sseu;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuv422_bgra_sseu;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuv422_argb_sseu;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuv422_abgr_sseu;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            return yuvnv12_rgb565_sseu;
+        case SDL_PIXELFORMAT_RGB24:
+            return yuvnv12_rgb24_sseu;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            return yuvnv12_rgba_sseu;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            return yuvnv12_bgra_sseu;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return yuvnv12_argb_sseu;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return yuvnv12_abgr_sseu;
+        default:
+            break;
+        }
+    }
+#endif
+    return NULL;
+}
+
+static YUVToRGBFunc yuv_rgb_neon(Uint32 src_format, Uint32 dst_format)
+{
+#if YUV_RGB_HAVE_NEON
+    if (!SDL_HasNEON()) {
+        return NULL;
     }
 
     if (src_format == SDL_PIXELFORMAT_YV12 ||
@@ -196,27 +447,21 @@ static SDL_bool yuv_rgb_sse(
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuv420_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgb565_neon;
         case SDL_PIXELFORMAT_RGB24:
-            yuv420_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgb24_neon;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuv420_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgba_neon;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuv420_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_bgra_neon;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuv420_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_argb_neon;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuv420_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_abgr_neon;
         default:
             break;
         }
@@ -228,27 +473,21 @@ static SDL_bool yuv_rgb_sse(
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuv422_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgb565_neon;
         case SDL_PIXELFORMAT_RGB24:
-            yuv422_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgb24_neon;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuv422_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgba_neon;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuv422_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_bgra_neon;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuv422_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_argb_neon;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuv422_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_abgr_neon;
         default:
             break;
         }
@@ -259,68 +498,51 @@ static SDL_bool yuv_rgb_sse(
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuvnv12_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgb565_neon;
         case SDL_PIXELFORMAT_RGB24:
-            yuvnv12_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgb24_neon;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuvnv12_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgba_neon;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuvnv12_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_bgra_neon;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuvnv12_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_argb_neon;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuvnv12_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_abgr_neon;
         default:
             break;
         }
     }
 #endif
-    return SDL_FALSE;
+    return NULL;
 }
 
-static SDL_bool yuv_rgb_std(
-    Uint32 src_format, Uint32 dst_format,
-    Uint32 width, Uint32 height, 
-    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
-    Uint8 *rgb, Uint32 rgb_stride, 
-    YCbCrType yuv_type)
+static YUVToRGBFunc yuv_rgb_std(Uint32 src_format, Uint32 dst_format)
 {
     if (src_format == SDL_PIXELFORMAT_YV12 ||
         src_format == SDL_PIXELFORMAT_IYUV) {
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuv420_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgb565_std;
         case SDL_PIXELFORMAT_RGB24:
-            yuv420_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgb24_std;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuv420_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_rgba_std;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuv420_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_bgra_std;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuv420_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_argb_std;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuv420_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv420_abgr_std;
         default:
             break;
         }
@@ -332,27 +554,21 @@ static SDL_bool yuv_rgb_std(
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuv422_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgb565_std;
         case SDL_PIXELFORMAT_RGB24:
-            yuv422_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgb24_std;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuv422_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_rgba_std;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuv422_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_bgra_std;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuv422_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_argb_std;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuv422_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuv422_abgr_std;
         default:
             break;
         }
@@ -363,32 +579,56 @@ static SDL_bool yuv_rgb_std(
 
         switch (dst_format) {
         case SDL_PIXELFORMAT_RGB565:
-            yuvnv12_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgb565_std;
         case SDL_PIXELFORMAT_RGB24:
-            yuvnv12_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgb24_std;
         case SDL_PIXELFORMAT_RGBX8888:
         case SDL_PIXELFORMAT_RGBA8888:
-            yuvnv12_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_rgba_std;
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
-            yuvnv12_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_bgra_std;
         case SDL_PIXELFORMAT_RGB888:
         case SDL_PIXELFORMAT_ARGB8888:
-            yuvnv12_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_argb_std;
         case SDL_PIXELFORMAT_BGR888:
         case SDL_PIXELFORMAT_ABGR8888:
-            yuvnv12_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
+            return yuvnv12_abgr_std;
         default:
             break;
         }
     }
-    return SDL_FALSE;
+    return NULL;
+}
+
+typedef struct
+{
+    YUVToRGBFunc convert;
+    Uint32 width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    int uv_rows_shift;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+} SDL_YUVToRGBData;
+
+static void
+SDL_ConvertPixels_YUV_to_RGB_Rows(void *data, int y, int h)
+{
+    const SDL_YUVToRGBData *cvt = (const SDL_YUVToRGBData *)data;
+    const Uint32 uv_row = ((Uint32)y >> cvt->uv_rows_shift);
+
+    cvt->convert(cvt->width, h,
+                 cvt->y + y * cvt->y_stride,
+                 cvt->u + uv_row * cvt->uv_stride,
+                 cvt->v + uv_row * cvt->uv_stride,
+                 cvt->y_stride, cvt->uv_stride,
+                 cvt->rgb + y * cvt->rgb_stride, cvt->rgb_stride,
+                 cvt->yuv_type);
 }
 
 int
@@ -402,6 +642,7 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     Uint32 y_stride = 0;
     Uint32 uv_stride = 0;
     YCbCrType yuv_type = YCBCR_601;
+    YUVToRGBFunc convert;
 
     if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
         return -1;
@@ -411,11 +652,31 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
+    convert = yuv_rgb_avx2(src_format, dst_format);
+    if (!convert) {
+        convert = yuv_rgb_sse(src_format, dst_format);
     }
-
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
+    if (!convert) {
+        convert = yuv_rgb_neon(src_format, dst_format);
+    }
+    if (!convert) {
+        convert = yuv_rgb_std(src_format, dst_format);
+    }
+    if (convert) {
+        SDL_YUVToRGBData data;
+
+        data.convert = convert;
+        data.width = width;
+        data.y = y;
+        data.u = u;
+        data.v = v;
+        data.y_stride = y_stride;
+        data.uv_stride = uv_stride;
+        data.uv_rows_shift = IsPlanar2x2Format(src_format) ? 1 : 0;
+        data.rgb = (Uint8 *)dst;
+        data.rgb_stride = dst_pitch;
+        data.yuv_type = yuv_type;
+        SDL_ConvertYUVRows(SDL_ConvertPixels_YUV_to_RGB_Rows, &data, width, height);
         return 0;
     }
 
@@ -454,41 +715,24 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
-static int
-SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+typedef struct
 {
-    const int src_pitch_x_2    = src_pitch * 2;
-    const int height_half      = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half       = width / 2;
-    const int width_remainder  = (width & 0x1);
-    int i, j;
- 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
-    {
-        /* ITU-T T.871 (JPEG) */
-        {
-            0,
-            {  0.2990f,  0.5870f,  0.1140f },
-            { -0.1687f, -0.3313f,  0.5000f },
-            {  0.5000f, -0.4187f, -0.0813f },
-        },
-        /* ITU-R BT.601-7 */
-        {
-            16,
-            {  0.2568f,  0.5041f,  0.0979f },
-            { -0.1482f, -0.2910f,  0.4392f },
-            {  0.4392f, -0.3678f, -0.0714f },
-        },
-        /* ITU-R BT.709-6 */
-        {
-            16,
-            { 0.1826f,  0.6142f,  0.0620f },
-            {-0.1006f, -0.3386f,  0.4392f },
-            { 0.4392f, -0.3989f, -0.0403f },
-        },
-    };
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    const struct RGB2YUVFactors *cvt;
+    ARGBToYRowFunc y_row;
+    ARGBToUVRowFunc uv_row;
+    int width;
+    const Uint8 *src;
+    int src_pitch;
+    Uint32 dst_format;
+    Uint8 *dst;
+    int dst_pitch;
+    Uint8 *plane_y;
+    Uint8 *plane_u;
+    Uint8 *plane_v;
+    Uint8 *plane_interleaved_uv;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+} SDL_RGBToYUVData;
 
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
 #define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
@@ -538,7 +782,23 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
 
 #define READ_ONE_RGB_PIXEL  READ_1x1_PIXEL
 
-    switch (dst_format) 
+/* Convert rows [y0, y0 + h) of the frame, y0 is always even */
+static void
+SDL_ConvertPixels_ARGB8888_to_YUV_Rows(void *userdata, int y0, int h)
+{
+    const SDL_RGBToYUVData *data = (const SDL_RGBToYUVData *)userdata;
+    const struct RGB2YUVFactors *cvt = data->cvt;
+    const int width            = data->width;
+    const int src_pitch        = data->src_pitch;
+    const int src_pitch_x_2    = src_pitch * 2;
+    const int height_half      = h / 2;
+    const int height_remainder = (h & 0x1);
+    const int width_half       = width / 2;
+    const int width_remainder  = (width & 0x1);
+    const Uint8 *src           = data->src + y0 * src_pitch;
+    int i, j;
+
+    switch (data->dst_format) 
     {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
@@ -546,132 +806,125 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_NV21:
         {
             const Uint8 *curr_row, *next_row;
-            
-            Uint8 *plane_y;
-            Uint8 *plane_u;
-            Uint8 *plane_v;
-            Uint8 *plane_interleaved_uv;
-            Uint32 y_stride, uv_stride, y_skip, uv_skip;
-
-            GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                         (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                         &y_stride, &uv_stride);
-            plane_interleaved_uv = (plane_y + height * y_stride);
-            y_skip = (y_stride - width);
+            const Uint32 y_stride = data->y_stride;
+            const Uint32 uv_stride = data->uv_stride;
+            Uint8 *plane_y = data->plane_y + y0 * y_stride;
+            Uint8 *plane_u = data->plane_u + (y0 / 2) * uv_stride;
+            Uint8 *plane_v = data->plane_v + (y0 / 2) * uv_stride;
+            Uint8 *plane_interleaved_uv = data->plane_interleaved_uv + (y0 / 2) * uv_stride;
 
-            curr_row = (const Uint8*)src;
+            curr_row = src;
 
             /* Write Y plane */
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
+            for (j = 0; j < h; j++) {
+                i = data->y_row ? (int)data->y_row(curr_row, plane_y, width, cvt->y, cvt->y_offset) : 0;
+                for (; i < width; i++) {
                     const Uint32 p1 = ((const Uint32 *)curr_row)[i];
                     const Uint32 r = (p1 & 0x00ff0000) >> 16;
                     const Uint32 g = (p1 & 0x0000ff00) >> 8;
                     const Uint32 b = (p1 & 0x000000ff);
-                    *plane_y++ = MAKE_Y(r, g, b);
+                    plane_y[i] = MAKE_Y(r, g, b);
                 }
-                plane_y += y_skip;
+                plane_y += y_stride;
                 curr_row += src_pitch;
             }
 
-            curr_row = (const Uint8*)src;
-            next_row = (const Uint8*)src;
+            curr_row = src;
+            next_row = src;
             next_row += src_pitch;
 
-            if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV)
+            if (data->dst_format == SDL_PIXELFORMAT_YV12 || data->dst_format == SDL_PIXELFORMAT_IYUV)
             {
                 /* Write UV planes, not interleaved */
-                uv_skip = (uv_stride - (width + 1)/2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = data->uv_row ? (int)data->uv_row(curr_row, next_row, width_half, cvt->u, cvt->v, plane_u, plane_v, 1) : 0;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
+                        plane_u[i] = MAKE_U(r, g, b);
+                        plane_v[i] = MAKE_V(r, g, b);
                     }
                     if (width_remainder) {
                         READ_2x1_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
+                        plane_u[i] = MAKE_U(r, g, b);
+                        plane_v[i] = MAKE_V(r, g, b);
                     }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
+                    plane_u += uv_stride;
+                    plane_v += uv_stride;
                     curr_row += src_pitch_x_2;
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
                     for (i = 0; i < width_half; i++) {
                         READ_1x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
+                        plane_u[i] = MAKE_U(r, g, b);
+                        plane_v[i] = MAKE_V(r, g, b);
                     }
                     if (width_remainder) {
                         READ_1x1_PIXEL;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
+                        plane_u[i] = MAKE_U(r, g, b);
+                        plane_v[i] = MAKE_V(r, g, b);
                     }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
                 }
             }
-            else if (dst_format == SDL_PIXELFORMAT_NV12)
+            else if (data->dst_format == SDL_PIXELFORMAT_NV12)
             {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = data->uv_row ? (int)data->uv_row(curr_row, next_row, width_half, cvt->u, cvt->v, plane_interleaved_uv, plane_interleaved_uv + 1, 2) : 0;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
                     }
                     if (width_remainder) {
                         READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
                     }
-                    plane_interleaved_uv += uv_skip;
+                    plane_interleaved_uv += uv_stride;
                     curr_row += src_pitch_x_2;
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
                     for (i = 0; i < width_half; i++) {
                         READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
                     }
                     if (width_remainder) {
                         READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
                     }
                 }
             } 
             else /* dst_format == SDL_PIXELFORMAT_NV21 */
             {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = data->uv_row ? (int)data->uv_row(curr_row, next_row, width_half, cvt->v, cvt->u, plane_interleaved_uv, plane_interleaved_uv + 1, 2) : 0;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_U(r, g, b);
                     }
                     if (width_remainder) {
                         READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_U(r, g, b);
                     }
-                    plane_interleaved_uv += uv_skip;
+                    plane_interleaved_uv += uv_stride;
                     curr_row += src_pitch_x_2;
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
                     for (i = 0; i < width_half; i++) {
                         READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_U(r, g, b);
                     }
                     if (width_remainder) {
                         READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                        plane_interleaved_uv[2 * i] = MAKE_V(r, g, b);
+                        plane_interleaved_uv[2 * i + 1] = MAKE_U(r, g, b);
                     }
                 }
             }
@@ -682,20 +935,15 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
         {
-            const Uint8 *curr_row = (const Uint8*) src;
-            Uint8 *plane           = (Uint8*) dst;
+            const Uint8 *curr_row = src;
+            Uint8 *plane           = data->dst + y0 * data->dst_pitch;
             const int row_size = (4 * ((width + 1) / 2));
-            int plane_skip;
-
-            if (dst_pitch < row_size) {
-                return SDL_SetError("Destination pitch is too small, expected at least %d\n", row_size);
-            }
-            plane_skip = (dst_pitch - row_size);
+            const int plane_skip = (data->dst_pitch - row_size);
 
             /* Write YUV plane, packed */
-            if (dst_format == SDL_PIXELFORMAT_YUY2) 
+            if (data->dst_format == SDL_PIXELFORMAT_YUY2) 
             {
-                for (j = 0; j < height; j++) {
+                for (j = 0; j < h; j++) {
                     for (i = 0; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* Y U Y1 V */
@@ -716,9 +964,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                     curr_row += src_pitch;
                 }
             } 
-            else if (dst_format == SDL_PIXELFORMAT_UYVY)
+            else if (data->dst_format == SDL_PIXELFORMAT_UYVY)
             {
-                for (j = 0; j < height; j++) {
+                for (j = 0; j < h; j++) {
                     for (i = 0; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* U Y V Y1 */
@@ -739,9 +987,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                     curr_row += src_pitch;
                 }
             }
-            else if (dst_format == SDL_PIXELFORMAT_YVYU)
+            else if (data->dst_format == SDL_PIXELFORMAT_YVYU)
             {
-                for (j = 0; j < height; j++) {
+                for (j = 0; j < h; j++) {
                     for (i = 0; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* Y V Y1 U */
@@ -766,8 +1014,10 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
         break;
 
     default:
-        return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
+        break;
     }
+}
+
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
@@ -777,6 +1027,86 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
 #undef READ_1x1_PIXEL
 #undef READ_TWO_RGB_PIXELS
 #undef READ_ONE_RGB_PIXEL
+
+static int
+SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+    {
+        /* ITU-T T.871 (JPEG) */
+        {
+            0,
+            {  0.2990f,  0.5870f,  0.1140f },
+            { -0.1687f, -0.3313f,  0.5000f },
+            {  0.5000f, -0.4187f, -0.0813f },
+        },
+        /* ITU-R BT.601-7 */
+        {
+            16,
+            {  0.2568f,  0.5041f,  0.0979f },
+            { -0.1482f, -0.2910f,  0.4392f },
+            {  0.4392f, -0.3678f, -0.0714f },
+        },
+        /* ITU-R BT.709-6 */
+        {
+            16,
+            { 0.1826f,  0.6142f,  0.0620f },
+            {-0.1006f, -0.3386f,  0.4392f },
+            { 0.4392f, -0.3989f, -0.0403f },
+        },
+    };
+    SDL_RGBToYUVData data;
+
+    SDL_zero(data);
+    data.cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    data.width = width;
+    data.src = (const Uint8 *)src;
+    data.src_pitch = src_pitch;
+    data.dst_format = dst_format;
+    data.dst = (Uint8 *)dst;
+    data.dst_pitch = dst_pitch;
+
+    switch (dst_format) 
+    {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                     (const Uint8 **)&data.plane_y, (const Uint8 **)&data.plane_u, (const Uint8 **)&data.plane_v,
+                     &data.y_stride, &data.uv_stride);
+        data.plane_interleaved_uv = (data.plane_y + height * data.y_stride);
+#if HAVE_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            data.y_row = argb_y_row_avx2;
+            data.uv_row = argb_uv_row_avx2;
+        }
+#endif
+#if YUV_RGB_HAVE_NEON
+        if (SDL_HasNEON()) {
+            data.y_row = argb_y_row_neon;
+            data.uv_row = argb_uv_row_neon;
+        }
+#endif
+        break;
+
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        {
+            const int row_size = (4 * ((width + 1) / 2));
+
+            if (dst_pitch < row_size) {
+                return SDL_SetError("Destination pitch is too small, expected at least %d\n", row_size);
+            }
+        }
+        break;
+
+    default:
+        return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
+    }
+
+    SDL_ConvertYUVRows(SDL_ConvertPixels_ARGB8888_to_YUV_Rows, &data, width, height);
     return 0;
 }
 
@@ -38,6 +38,9 @@ my @dst_formats = (
     "RGB888",
     "BGR888",
     "ARGB8888",
+    "RGBA8888",
+    "ABGR8888",
+    "BGRA8888",
 );
 
 my %format_size = (
@@ -58,6 +61,81 @@ my %format_type = (
     "BGRA8888" => "Uint32",
 );
 
+# Bit positions of R, G, B and A for the SIMD blitters, -1 for no alpha
+my %format_shifts = (
+    "RGB888" => "16, 8, 0, -1",
+    "BGR888" => "0, 8, 16, -1",
+    "ARGB8888" => "16, 8, 0, 24",
+    "RGBA8888" => "24, 16, 8, 0",
+    "ABGR8888" => "0, 8, 16, 24",
+    "BGRA8888" => "8, 16, 24, 0",
+);
+
+# The SIMD variants, in order of preference, and the vector operations the
+# shared kernel is written in terms of. Every channel is kept in its own
+# 32-bit lane with values below 256, so 16-bit multiplies and minimums work.
+my @simd_variants = ( "AVX2", "SSE2", "NEON" );
+
+my %simd_guard = (
+    "AVX2" => "HAVE_AVX2_INTRINSICS",
+    "SSE2" => "defined(__SSE2__)",
+    "NEON" => "HAVE_NEON_INTRINSICS",
+);
+
+my %simd_target = (
+    "AVX2" => " SDL_TARGETING(\"avx2\")",
+    "SSE2" => "",
+    "NEON" => "",
+);
+
+my %simd_ops = (
+    "AVX2" => <<__EOF__,
+#define V_WIDTH 8
+#define V_TYPE __m256i
+#define V_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define V_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+#define V_SET1(x) _mm256_set1_epi32((int)(x))
+#define V_AND(a, b) _mm256_and_si256(a, b)
+#define V_OR(a, b) _mm256_or_si256(a, b)
+#define V_ADD(a, b) _mm256_add_epi32(a, b)
+#define V_SUB(a, b) _mm256_sub_epi32(a, b)
+#define V_MUL(a, b) _mm256_mullo_epi16(a, b)
+#define V_MIN(a, b) _mm256_min_epi16(a, b)
+#define V_SRL(v, n) _mm256_srl_epi32(v, _mm_cvtsi32_si128(n))
+#define V_SLL(v, n) _mm256_sll_epi32(v, _mm_cvtsi32_si128(n))
+__EOF__
+    "SSE2" => <<__EOF__,
+#define V_WIDTH 4
+#define V_TYPE __m128i
+#define V_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define V_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define V_SET1(x) _mm_set1_epi32((int)(x))
+#define V_AND(a, b) _mm_and_si128(a, b)
+#define V_OR(a, b) _mm_or_si128(a, b)
+#define V_ADD(a, b) _mm_add_epi32(a, b)
+#define V_SUB(a, b) _mm_sub_epi32(a, b)
+#define V_MUL(a, b) _mm_mullo_epi16(a, b)
+#define V_MIN(a, b) _mm_min_epi16(a, b)
+#define V_SRL(v, n) _mm_srl_epi32(v, _mm_cvtsi32_si128(n))
+#define V_SLL(v, n) _mm_sll_epi32(v, _mm_cvtsi32_si128(n))
+__EOF__
+    "NEON" => <<__EOF__,
+#define V_WIDTH 4
+#define V_TYPE uint32x4_t
+#define V_LOAD(p) vld1q_u32(p)
+#define V_STORE(p, v) vst1q_u32(p, v)
+#define V_SET1(x) vdupq_n_u32(x)
+#define V_AND(a, b) vandq_u32(a, b)
+#define V_OR(a, b) vorrq_u32(a, b)
+#define V_ADD(a, b) vaddq_u32(a, b)
+#define V_SUB(a, b) vsubq_u32(a, b)
+#define V_MUL(a, b) vmulq_u32(a, b)
+#define V_MIN(a, b) vminq_u32(a, b)
+#define V_SRL(v, n) vshlq_u32(v, vdupq_n_s32(-(n)))
+#define V_SLL(v, n) vshlq_u32(v, vdupq_n_s32(n))
+__EOF__
+);
+
 my %get_rgba_string_ignore_alpha = (
     "RGB888" => "_R = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _B = (Uint8)_pixel;",
     "BGR888" => "_B = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _R = (Uint8)_pixel;",
@@ -149,6 +227,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $variant = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -160,6 +239,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $variant ) {
+        print FILE "_$variant";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -437,14 +519,230 @@ sub output_copyinc
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 __EOF__
 }
 
-sub output_copyfunctable
+sub output_simdkernel
 {
+    my $variant = shift;
+    my $target = $simd_target{$variant};
+
     print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if $simd_guard{$variant}
+
+$simd_ops{$variant}
+#define V_CHANNEL(v, shift) V_AND(V_SRL(v, shift), mask)
+#define V_DIV255(x) V_SRL(V_ADD(V_ADD(x, one), V_SRL(x, 8)), 8)
+
+/* Does the same arithmetic as the scalar blitters for V_WIDTH pixels at a
+   time. The formats and features are constants in each caller, so this is
+   specialized for every combination when it's inlined. */
+SDL_FORCE_INLINE void$target
+SDL_Blit8888_$variant(SDL_BlitInfo *info,
+        int srcR, int srcG, int srcB, int srcA,
+        int dstR, int dstG, int dstB, int dstA,
+        int modulate, int blend, int scale)
+{
+    const int flags = info->flags;
+    const int copy = !modulate && !blend &&
+        srcR == dstR && srcG == dstG && srcB == dstB && srcA == dstA;
+    const int modulateColor = modulate && (flags & SDL_COPY_MODULATE_COLOR);
+    const int modulateAlpha = modulate && (flags & SDL_COPY_MODULATE_ALPHA) && (blend || dstA >= 0);
+    const int premultiply = blend && (flags & (SDL_COPY_BLEND|SDL_COPY_ADD));
+    const int mode = blend ? (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) : 0;
+    const V_TYPE mask = V_SET1(0xFF);
+    const V_TYPE one = V_SET1(1);
+    const V_TYPE modulateR = V_SET1(info->r);
+    const V_TYPE modulateG = V_SET1(info->g);
+    const V_TYPE modulateB = V_SET1(info->b);
+    const V_TYPE modulateA = V_SET1(info->a);
+    Uint32 srcpixels[V_WIDTH];
+    Uint32 dstpixels[V_WIDTH];
+    int srcy = 0, srcx = -1;
+    int posy = 0, posx = 0;
+    int incy = 0, incx = 0;
+
+    SDL_zero(srcpixels);
+    SDL_zero(dstpixels);
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        if (scale) {
+            srcx = -1;
+            posx = 0x10000L;
+            while (posy >= 0x10000L) {
+                ++srcy;
+                posy -= 0x10000L;
+            }
+        }
+        while (n > 0) {
+            const int count = (n < V_WIDTH) ? n : V_WIDTH;
+            V_TYPE srcpixel, dstpixel, pixel;
+            V_TYPE R, G, B, A, dstR_, dstG_, dstB_, dstA_, inv;
+            int i;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    if (posx >= 0x10000L) {
+                        while (posx >= 0x10000L) {
+                            ++srcx;
+                            posx -= 0x10000L;
+                        }
+                        src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+                    }
+                    srcpixels[i] = *src;
+                    posx += incx;
+                }
+                srcpixel = V_LOAD(srcpixels);
+            } else if (count == V_WIDTH) {
+                srcpixel = V_LOAD(src);
+            } else {
+                SDL_memcpy(srcpixels, src, count * sizeof(Uint32));
+                srcpixel = V_LOAD(srcpixels);
+            }
+
+            if (copy) {
+                pixel = srcpixel;
+            } else {
+                R = V_CHANNEL(srcpixel, srcR);
+                G = V_CHANNEL(srcpixel, srcG);
+                B = V_CHANNEL(srcpixel, srcB);
+                A = (srcA >= 0) ? V_CHANNEL(srcpixel, srcA) : mask;
+                if (modulateColor) {
+                    R = V_DIV255(V_MUL(R, modulateR));
+                    G = V_DIV255(V_MUL(G, modulateG));
+                    B = V_DIV255(V_MUL(B, modulateB));
+                }
+                if (modulateAlpha) {
+                    A = V_DIV255(V_MUL(A, modulateA));
+                }
+                if (blend) {
+                    if (count == V_WIDTH) {
+                        dstpixel = V_LOAD(dst);
+                    } else {
+                        SDL_memcpy(dstpixels, dst, count * sizeof(Uint32));
+                        dstpixel = V_LOAD(dstpixels);
+                    }
+                    dstR_ = V_CHANNEL(dstpixel, dstR);
+                    dstG_ = V_CHANNEL(dstpixel, dstG);
+                    dstB_ = V_CHANNEL(dstpixel, dstB);
+                    dstA_ = (dstA >= 0) ? V_CHANNEL(dstpixel, dstA) : mask;
+                    if (premultiply) {
+                        /* Multiplying by an alpha of 255 changes nothing */
+                        R = V_DIV255(V_MUL(R, A));
+                        G = V_DIV255(V_MUL(G, A));
+                        B = V_DIV255(V_MUL(B, A));
+                    }
+                    switch (mode) {
+                    case SDL_COPY_BLEND:
+                        inv = V_SUB(mask, A);
+                        dstR_ = V_ADD(R, V_DIV255(V_MUL(inv, dstR_)));
+                        dstG_ = V_ADD(G, V_DIV255(V_MUL(inv, dstG_)));
+                        dstB_ = V_ADD(B, V_DIV255(V_MUL(inv, dstB_)));
+                        dstA_ = V_ADD(A, V_DIV255(V_MUL(inv, dstA_)));
+                        break;
+                    case SDL_COPY_ADD:
+                        dstR_ = V_MIN(V_ADD(R, dstR_), mask);
+                        dstG_ = V_MIN(V_ADD(G, dstG_), mask);
+                        dstB_ = V_MIN(V_ADD(B, dstB_), mask);
+                        break;
+                    case SDL_COPY_MOD:
+                        dstR_ = V_DIV255(V_MUL(R, dstR_));
+                        dstG_ = V_DIV255(V_MUL(G, dstG_));
+                        dstB_ = V_DIV255(V_MUL(B, dstB_));
+                        break;
+                    }
+                    R = dstR_;
+                    G = dstG_;
+                    B = dstB_;
+                    A = dstA_;
+                }
+                pixel = V_OR(V_OR(V_SLL(R, dstR), V_SLL(G, dstG)), V_SLL(B, dstB));
+                if (dstA >= 0) {
+                    pixel = V_OR(pixel, V_SLL(A, dstA));
+                }
+            }
+
+            if (count == V_WIDTH) {
+                V_STORE(dst, pixel);
+            } else {
+                V_STORE(dstpixels, pixel);
+                SDL_memcpy(dst, dstpixels, count * sizeof(Uint32));
+            }
+            if (!scale) {
+                src += count;
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
 __EOF__
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        my $src = $src_formats[$i];
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            my $dst = $dst_formats[$j];
+            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                for (my $blend = 0; $blend <= 1; ++$blend) {
+                    for (my $scale = 0; $scale <= 1; ++$scale) {
+                        if ( $modulate || $blend || $scale ) {
+                            output_copyfuncname("static void$target", $src, $dst, $modulate, $blend, $scale, 1, "\n", $variant);
+                            print FILE <<__EOF__;
+{
+    SDL_Blit8888_$variant(info, $format_shifts{$src}, $format_shifts{$dst}, $modulate, $blend, $scale);
+}
+
+__EOF__
+                        }
+                    }
+                }
+            }
+        }
+    }
+    print FILE <<__EOF__;
+#undef V_WIDTH
+#undef V_TYPE
+#undef V_LOAD
+#undef V_STORE
+#undef V_SET1
+#undef V_AND
+#undef V_OR
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_MIN
+#undef V_SRL
+#undef V_SLL
+#undef V_CHANNEL
+#undef V_DIV255
+
+#endif /* $simd_guard{$variant} */
+
+__EOF__
+}
+
+sub output_copyfuncentries
+{
+    my $cpu = shift;
+    my $variant = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -483,14 +781,29 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $variant);
                         }
                     }
                 }
             }
         }
     }
+}
+
+sub output_copyfunctable
+{
+    print FILE <<__EOF__;
+SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+__EOF__
+    # The SIMD variants come first so SDL_ChooseBlitFunc() prefers them
+    # whenever the CPU supports them
+    foreach my $variant (@simd_variants) {
+        print FILE "#if $simd_guard{$variant}\n";
+        output_copyfuncentries("SDL_CPU_$variant", $variant);
+        print FILE "#endif\n";
+    }
+    output_copyfuncentries("SDL_CPU_ANY", "");
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
 };
@@ -531,5 +844,8 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+foreach my $variant (@simd_variants) {
+    output_simdkernel($variant);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -685,3 +685,347 @@ void rgb24_yuv420_sseu(uint32_t width, uint32_t height,
 
 #endif //__SSE2__
 
+
+#if HAVE_AVX2_INTRINSICS
+
+#define AVX2_FUNCTION_NAME	yuv420_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_rgba_avx2
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_bgra_avx2
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_argb_avx2
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_abgr_avx2
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgba_avx2
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_bgra_avx2
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_argb_avx2
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_abgr_avx2
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgb565_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgba_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_bgra_avx2
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_argb_avx2
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_abgr_avx2
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+// weighted sum in the same order as the c reference, truncated and offset like its (int) cast
+#define AVX2_ARGB_DOT(R, G, B, F, OFFSET) \
+	_mm256_add_epi32(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps( \
+		_mm256_mul_ps(_mm256_set1_ps(F[0]), _mm256_cvtepi32_ps(R)), \
+		_mm256_mul_ps(_mm256_set1_ps(F[1]), _mm256_cvtepi32_ps(G))), \
+		_mm256_mul_ps(_mm256_set1_ps(F[2]), _mm256_cvtepi32_ps(B))), \
+		_mm256_set1_ps(0.5f))), _mm256_set1_epi32(OFFSET))
+
+// keep the low byte of each 32 bit value, like the (uint8_t) cast of the c reference
+#define AVX2_LOW_BYTES(X) \
+	_mm256_castsi256_si128(_mm256_permutevar8x32_epi32( \
+		_mm256_shuffle_epi8(X, _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, \
+		                                        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)), \
+		_mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1)))
+
+#define AVX2_CHANNEL(P, SHIFT) \
+	_mm256_and_si256(_mm256_srli_epi32(P, SHIFT), _mm256_set1_epi32(0xFF))
+
+// average of the 2x2 blocks of 16 pixels on two rows, in pixel order
+#define AVX2_SUM_2x2(A1, B1, A2, B2, SHIFT) \
+	_mm256_srli_epi32(_mm256_permute4x64_epi64(_mm256_hadd_epi32( \
+		_mm256_add_epi32(AVX2_CHANNEL(A1, SHIFT), AVX2_CHANNEL(A2, SHIFT)), \
+		_mm256_add_epi32(AVX2_CHANNEL(B1, SHIFT), AVX2_CHANNEL(B2, SHIFT))), 0xD8), 2)
+
+uint32_t SDL_TARGETING("avx2") argb_y_row_avx2(
+	const uint8_t *argb, uint8_t *y, uint32_t width,
+	const float *factors, int offset)
+{
+	uint32_t x;
+	for(x=0; (x+8)<=width; x+=8)
+	{
+		const __m256i p = _mm256_loadu_si256((const __m256i*)(argb+4*x));
+		const __m256i y_32 = AVX2_ARGB_DOT(AVX2_CHANNEL(p, 16), AVX2_CHANNEL(p, 8), AVX2_CHANNEL(p, 0), factors, offset);
+		_mm_storel_epi64((__m128i*)(y+x), AVX2_LOW_BYTES(y_32));
+	}
+	return x;
+}
+
+uint32_t SDL_TARGETING("avx2") argb_uv_row_avx2(
+	const uint8_t *argb1, const uint8_t *argb2, uint32_t width_half,
+	const float *factors1, const float *factors2,
+	uint8_t *out1, uint8_t *out2, uint32_t out_step)
+{
+	uint32_t x;
+	for(x=0; (x+8)<=width_half; x+=8)
+	{
+		const __m256i a1 = _mm256_loadu_si256((const __m256i*)(argb1+8*x)),
+			b1 = _mm256_loadu_si256((const __m256i*)(argb1+8*x+32)),
+			a2 = _mm256_loadu_si256((const __m256i*)(argb2+8*x)),
+			b2 = _mm256_loadu_si256((const __m256i*)(argb2+8*x+32));
+		const __m256i r = AVX2_SUM_2x2(a1, b1, a2, b2, 16),
+			g = AVX2_SUM_2x2(a1, b1, a2, b2, 8),
+			b = AVX2_SUM_2x2(a1, b1, a2, b2, 0);
+		const __m128i c1 = AVX2_LOW_BYTES(AVX2_ARGB_DOT(r, g, b, factors1, 128)),
+			c2 = AVX2_LOW_BYTES(AVX2_ARGB_DOT(r, g, b, factors2, 128));
+		if (out_step == 2)
+		{
+			_mm_storeu_si128((__m128i*)(out1+2*x), _mm_unpacklo_epi8(c1, c2));
+		}
+		else
+		{
+			_mm_storel_epi64((__m128i*)(out1+x), c1);
+			_mm_storel_epi64((__m128i*)(out2+x), c2);
+		}
+	}
+	return x;
+}
+
+#undef AVX2_ARGB_DOT
+#undef AVX2_LOW_BYTES
+#undef AVX2_CHANNEL
+#undef AVX2_SUM_2x2
+
+#endif //HAVE_AVX2_INTRINSICS
+
+#if YUV_RGB_HAVE_NEON
+
+#define NEON_FUNCTION_NAME	yuv420_rgb565_neon
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgb24_neon
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgba_neon
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_bgra_neon
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_argb_neon
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_abgr_neon
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb565_neon
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb24_neon
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgba_neon
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_bgra_neon
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_argb_neon
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_abgr_neon
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb565_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb24_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgba_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_bgra_neon
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_argb_neon
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_abgr_neon
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+// weighted sum in the same order as the c reference, truncated and offset like its (int) cast
+#define NEON_ARGB_DOT(R, G, B, F, OFFSET) \
+	vaddq_s32(vcvtq_s32_f32(vaddq_f32(vaddq_f32(vaddq_f32( \
+		vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(R)), F[0]), \
+		vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(G)), F[1])), \
+		vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(B)), F[2])), \
+		vdupq_n_f32(0.5f))), vdupq_n_s32(OFFSET))
+
+// keep the low byte of each 32 bit value, like the (uint8_t) cast of the c reference
+#define NEON_LOW_BYTES(LO, HI) \
+	vmovn_u16(vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(LO)), vmovn_u32(vreinterpretq_u32_s32(HI))))
+
+uint32_t argb_y_row_neon(
+	const uint8_t *argb, uint8_t *y, uint32_t width,
+	const float *factors, int offset)
+{
+	uint32_t x;
+	for(x=0; (x+8)<=width; x+=8)
+	{
+		// argb8888 words are stored b, g, r, a on little endian
+		const uint8x8x4_t p = vld4_u8(argb+4*x);
+		const uint16x8_t r = vmovl_u8(p.val[2]), g = vmovl_u8(p.val[1]), b = vmovl_u8(p.val[0]);
+		const int32x4_t lo = NEON_ARGB_DOT(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b), factors, offset);
+		const int32x4_t hi = NEON_ARGB_DOT(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b), factors, offset);
+		vst1_u8(y+x, NEON_LOW_BYTES(lo, hi));
+	}
+	return x;
+}
+
+uint32_t argb_uv_row_neon(
+	const uint8_t *argb1, const uint8_t *argb2, uint32_t width_half,
+	const float *factors1, const float *factors2,
+	uint8_t *out1, uint8_t *out2, uint32_t out_step)
+{
+	uint32_t x;
+	for(x=0; (x+8)<=width_half; x+=8)
+	{
+		const uint8x16x4_t p1 = vld4q_u8(argb1+8*x), p2 = vld4q_u8(argb2+8*x);
+		// sum horizontal pairs, then the two rows, and average
+		const uint16x8_t r = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[2]), vpaddlq_u8(p2.val[2])), 2),
+			g = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[1]), vpaddlq_u8(p2.val[1])), 2),
+			b = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[0]), vpaddlq_u8(p2.val[0])), 2);
+		uint8x8x2_t c;
+		c.val[0] = NEON_LOW_BYTES(
+			NEON_ARGB_DOT(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b), factors1, 128),
+			NEON_ARGB_DOT(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b), factors1, 128));
+		c.val[1] = NEON_LOW_BYTES(
+			NEON_ARGB_DOT(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b), factors2, 128),
+			NEON_ARGB_DOT(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b), factors2, 128));
+		if (out_step == 2)
+		{
+			vst2_u8(out1+2*x, c);
+		}
+		else
+		{
+			vst1_u8(out1+x, c.val[0]);
+			vst1_u8(out2+x, c.val[1]);
+		}
+	}
+	return x;
+}
+
+#undef NEON_ARGB_DOT
+#undef NEON_LOW_BYTES
+
+#endif //YUV_RGB_HAVE_NEON
@@ -0,0 +1,240 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* The arithmetic is the same 16 bit fixed point as the sse version, so both
+   produce identical output; only the register width changes. */
+
+#define AVX2_CLAMP_U8(X) \
+	_mm256_min_epi16(_mm256_max_epi16(X, _mm256_setzero_si256()), _mm256_set1_epi16(255))
+
+// duplicate each chroma value for the two pixels it covers, keeping pixel order across lanes
+#define AVX2_DUP_16(X, X1, X2) \
+{ \
+	__m256i lo = _mm256_unpacklo_epi16(X, X), hi = _mm256_unpackhi_epi16(X, X); \
+	X1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	X2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+}
+
+#define AVX2_UV2RGB_16(U, V, R1, G1, B1, R2, G2, B2) \
+{ \
+	__m256i r_tmp, g_tmp, b_tmp; \
+	U = _mm256_add_epi16(U, _mm256_set1_epi16(-128)); \
+	V = _mm256_add_epi16(V, _mm256_set1_epi16(-128)); \
+	r_tmp = _mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_b_factor)); \
+	AVX2_DUP_16(r_tmp, R1, R2) \
+	AVX2_DUP_16(g_tmp, G1, G2) \
+	AVX2_DUP_16(b_tmp, B1, B2) \
+}
+
+#define AVX2_ADD_Y2RGB_16(Y, R_UV, G_UV, B_UV, R, G, B) \
+	Y = _mm256_mullo_epi16(_mm256_sub_epi16(Y, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	R = AVX2_CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(R_UV, Y), PRECISION)); \
+	G = AVX2_CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(G_UV, Y), PRECISION)); \
+	B = AVX2_CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(B_UV, Y), PRECISION)); \
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define AVX2_SAVE_16(R, G, B, rgb_ptr) \
+{ \
+	__m256i pixels = _mm256_or_si256( \
+		_mm256_or_si256( \
+			_mm256_slli_epi16(_mm256_and_si256(R, _mm256_set1_epi16(0xF8)), 8), \
+			_mm256_slli_epi16(_mm256_and_si256(G, _mm256_set1_epi16(0xFC)), 3)), \
+		_mm256_srli_epi16(B, 3)); \
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), pixels); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+// C0..C3 are the bytes of each pixel in memory order
+#define AVX2_PACK_32(C0, C1, C2, C3, rgb_ptr) \
+{ \
+	__m256i lo = _mm256_or_si256(C0, _mm256_slli_epi16(C1, 8)); \
+	__m256i hi = _mm256_or_si256(C2, _mm256_slli_epi16(C3, 8)); \
+	__m256i p1 = _mm256_unpacklo_epi16(lo, hi), p2 = _mm256_unpackhi_epi16(lo, hi); \
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), _mm256_permute2x128_si256(p1, p2, 0x20)); \
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+32), _mm256_permute2x128_si256(p1, p2, 0x31)); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define AVX2_SAVE_16(R, G, B, rgb_ptr) AVX2_PACK_32(_mm256_set1_epi16(0xFF), B, G, R, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define AVX2_SAVE_16(R, G, B, rgb_ptr) AVX2_PACK_32(_mm256_set1_epi16(0xFF), R, G, B, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define AVX2_SAVE_16(R, G, B, rgb_ptr) AVX2_PACK_32(B, G, R, _mm256_set1_epi16(0xFF), rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define AVX2_SAVE_16(R, G, B, rgb_ptr) AVX2_PACK_32(R, G, B, _mm256_set1_epi16(0xFF), rgb_ptr)
+#endif
+
+#else
+#error AVX2_SAVE_16 unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define AVX2_READ_Y(y_ptr, Y1, Y2) \
+	Y1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y_ptr))); \
+	Y2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y_ptr+16))); \
+
+#define AVX2_READ_UV(U, V) \
+	U = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	V = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define AVX2_READ_Y(y_ptr, Y1, Y2) \
+	Y1 = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(y_ptr)), _mm256_set1_epi16(0xFF)); \
+	Y2 = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(y_ptr+32)), _mm256_set1_epi16(0xFF)); \
+
+#define AVX2_READ_UV(U, V) \
+	U = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+	V = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define AVX2_READ_Y(y_ptr, Y1, Y2) \
+	Y1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y_ptr))); \
+	Y2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y_ptr+16))); \
+
+#define AVX2_READ_UV(U, V) \
+	U = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	V = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+
+#else
+#error AVX2_READ_UV unimplemented
+#endif
+
+#define AVX2_YUV2RGB_LINE(y_ptr, rgb_ptr) \
+{ \
+	__m256i y_16_1, y_16_2, r, g, b; \
+	AVX2_READ_Y(y_ptr, y_16_1, y_16_2) \
+	AVX2_ADD_Y2RGB_16(y_16_1, r_uv_16_1, g_uv_16_1, b_uv_16_1, r, g, b) \
+	AVX2_SAVE_16(r, g, b, rgb_ptr) \
+	AVX2_ADD_Y2RGB_16(y_16_2, r_uv_16_2, g_uv_16_2, b_uv_16_2, r, g, b) \
+	AVX2_SAVE_16(r, g, b, rgb_ptr+16*rgb_pixel_stride) \
+}
+
+void SDL_TARGETING("avx2") AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31); xpos+=32)
+			{
+				__m256i u_16, v_16;
+				__m256i r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2;
+
+				AVX2_READ_UV(u_16, v_16)
+				AVX2_UV2RGB_16(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2)
+
+				AVX2_YUV2RGB_LINE(y_ptr1, rgb_ptr1)
+				if (uv_y_sample_interval > 1)
+				{
+					AVX2_YUV2RGB_LINE(y_ptr2, rgb_ptr2)
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~31);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef AVX2_CLAMP_U8
+#undef AVX2_DUP_16
+#undef AVX2_UV2RGB_16
+#undef AVX2_ADD_Y2RGB_16
+#undef AVX2_PACK_32
+#undef AVX2_SAVE_16
+#undef AVX2_READ_Y
+#undef AVX2_READ_UV
+#undef AVX2_YUV2RGB_LINE
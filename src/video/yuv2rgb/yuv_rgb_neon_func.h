@@ -0,0 +1,248 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* Same 16 bit fixed point arithmetic as the sse version, 16 pixels per block.
+   The 32 bit formats are stored byte by byte, this assumes a little endian target. */
+
+#define NEON_UV2RGB_16(U, V, R_UV, G_UV, B_UV) \
+{ \
+	int16x8_t r_tmp, g_tmp, b_tmp; \
+	U = vsubq_s16(U, vdupq_n_s16(128)); \
+	V = vsubq_s16(V, vdupq_n_s16(128)); \
+	r_tmp = vmulq_n_s16(V, param->v_r_factor); \
+	g_tmp = vaddq_s16(vmulq_n_s16(U, param->u_g_factor), vmulq_n_s16(V, param->v_g_factor)); \
+	b_tmp = vmulq_n_s16(U, param->u_b_factor); \
+	/* duplicate each chroma value for the two pixels it covers */ \
+	R_UV = vzipq_s16(r_tmp, r_tmp); \
+	G_UV = vzipq_s16(g_tmp, g_tmp); \
+	B_UV = vzipq_s16(b_tmp, b_tmp); \
+}
+
+#define NEON_ADD_Y2RGB_8(Y, C_UV) \
+	vqmovun_s16(vshrq_n_s16(vaddq_s16(C_UV, Y), PRECISION))
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define NEON_SAVE_16(R, G, B, rgb_ptr) \
+{ \
+	const uint8x16_t r5 = vandq_u8(R, vdupq_n_u8(0xF8)); \
+	const uint8x16_t g6 = vandq_u8(G, vdupq_n_u8(0xFC)); \
+	uint16x8_t lo, hi; \
+	lo = vorrq_u16(vorrq_u16(vshlq_n_u16(vmovl_u8(vget_low_u8(r5)), 8), vshlq_n_u16(vmovl_u8(vget_low_u8(g6)), 3)), \
+		vshrq_n_u16(vmovl_u8(vget_low_u8(B)), 3)); \
+	hi = vorrq_u16(vorrq_u16(vshlq_n_u16(vmovl_u8(vget_high_u8(r5)), 8), vshlq_n_u16(vmovl_u8(vget_high_u8(g6)), 3)), \
+		vshrq_n_u16(vmovl_u8(vget_high_u8(B)), 3)); \
+	vst1q_u16((uint16_t*)(rgb_ptr), lo); \
+	vst1q_u16((uint16_t*)(rgb_ptr+16), hi); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define NEON_SAVE_16(R, G, B, rgb_ptr) \
+{ \
+	uint8x16x3_t pixels; \
+	pixels.val[0] = R; \
+	pixels.val[1] = G; \
+	pixels.val[2] = B; \
+	vst3q_u8(rgb_ptr, pixels); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+// C0..C3 are the bytes of each pixel in memory order
+#define NEON_PACK_32(C0, C1, C2, C3, rgb_ptr) \
+{ \
+	uint8x16x4_t pixels; \
+	pixels.val[0] = C0; \
+	pixels.val[1] = C1; \
+	pixels.val[2] = C2; \
+	pixels.val[3] = C3; \
+	vst4q_u8(rgb_ptr, pixels); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define NEON_SAVE_16(R, G, B, rgb_ptr) NEON_PACK_32(vdupq_n_u8(0xFF), B, G, R, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define NEON_SAVE_16(R, G, B, rgb_ptr) NEON_PACK_32(vdupq_n_u8(0xFF), R, G, B, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define NEON_SAVE_16(R, G, B, rgb_ptr) NEON_PACK_32(B, G, R, vdupq_n_u8(0xFF), rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define NEON_SAVE_16(R, G, B, rgb_ptr) NEON_PACK_32(R, G, B, vdupq_n_u8(0xFF), rgb_ptr)
+#endif
+
+#else
+#error NEON_SAVE_16 unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define NEON_READ_Y(y_ptr, Y1, Y2) \
+{ \
+	const uint8x16_t y_8 = vld1q_u8(y_ptr); \
+	Y1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y_8))); \
+	Y2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y_8))); \
+}
+
+#define NEON_READ_UV(U, V) \
+	U = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(u_ptr))); \
+	V = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define NEON_READ_Y(y_ptr, Y1, Y2) \
+{ \
+	const uint8x16x2_t y_8 = vld2q_u8(y_ptr); \
+	Y1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y_8.val[0]))); \
+	Y2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y_8.val[0]))); \
+}
+
+#define NEON_READ_UV(U, V) \
+	U = vreinterpretq_s16_u16(vmovl_u8(vld4_u8(u_ptr).val[0])); \
+	V = vreinterpretq_s16_u16(vmovl_u8(vld4_u8(v_ptr).val[0])); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define NEON_READ_Y(y_ptr, Y1, Y2) \
+{ \
+	const uint8x16_t y_8 = vld1q_u8(y_ptr); \
+	Y1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y_8))); \
+	Y2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y_8))); \
+}
+
+#define NEON_READ_UV(U, V) \
+	U = vreinterpretq_s16_u16(vmovl_u8(vld2_u8(u_ptr).val[0])); \
+	V = vreinterpretq_s16_u16(vmovl_u8(vld2_u8(v_ptr).val[0])); \
+
+#else
+#error NEON_READ_UV unimplemented
+#endif
+
+#define NEON_YUV2RGB_LINE(y_ptr, rgb_ptr) \
+{ \
+	int16x8_t y_16_1, y_16_2; \
+	uint8x16_t r, g, b; \
+	NEON_READ_Y(y_ptr, y_16_1, y_16_2) \
+	y_16_1 = vmulq_n_s16(vsubq_s16(y_16_1, vdupq_n_s16(param->y_shift)), param->y_factor); \
+	y_16_2 = vmulq_n_s16(vsubq_s16(y_16_2, vdupq_n_s16(param->y_shift)), param->y_factor); \
+	r = vcombine_u8(NEON_ADD_Y2RGB_8(y_16_1, r_uv.val[0]), NEON_ADD_Y2RGB_8(y_16_2, r_uv.val[1])); \
+	g = vcombine_u8(NEON_ADD_Y2RGB_8(y_16_1, g_uv.val[0]), NEON_ADD_Y2RGB_8(y_16_2, g_uv.val[1])); \
+	b = vcombine_u8(NEON_ADD_Y2RGB_8(y_16_1, b_uv.val[0]), NEON_ADD_Y2RGB_8(y_16_2, b_uv.val[1])); \
+	NEON_SAVE_16(r, g, b, rgb_ptr) \
+}
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+	if (width >= 16) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-15); xpos+=16)
+			{
+				int16x8_t u_16, v_16;
+				int16x8x2_t r_uv, g_uv, b_uv;
+
+				NEON_READ_UV(u_16, v_16)
+				NEON_UV2RGB_16(u_16, v_16, r_uv, g_uv, b_uv)
+
+				NEON_YUV2RGB_LINE(y_ptr1, rgb_ptr1)
+				if (uv_y_sample_interval > 1)
+				{
+					NEON_YUV2RGB_LINE(y_ptr2, rgb_ptr2)
+				}
+
+				y_ptr1+=16*y_pixel_stride;
+				y_ptr2+=16*y_pixel_stride;
+				u_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=16*rgb_pixel_stride;
+				rgb_ptr2+=16*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~15);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef NEON_UV2RGB_16
+#undef NEON_ADD_Y2RGB_8
+#undef NEON_PACK_32
+#undef NEON_SAVE_16
+#undef NEON_READ_Y
+#undef NEON_READ_UV
+#undef NEON_YUV2RGB_LINE
@@ -968,6 +968,1668 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/**
+ * \brief Checks that resampling a sine wave preserves it, for several rate pairs and channel counts.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_resampleLoss()
+{
+  /* Rate pairs cover small and large polyphase periods; 44100 -> 48001 has too many phases to be tabulated. */
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 22050, 96000 }, { 8000, 44100 }, { 44100, 48001 } };
+  const int channels[] = { 1, 2, 6, 8 };
+  const double frequency = 997.0;
+  const double max_error = 0.0005;
+  const double min_snr = 70.0;
+  const int frames_in = 4096;
+  int i, j, k, c, result;
+
+  for (i = 0; i < SDL_arraysize(rates); i++) {
+    for (j = 0; j < SDL_arraysize(channels); j++) {
+      const int rate_in = rates[i][0];
+      const int rate_out = rates[i][1];
+      const int chans = channels[j];
+      const int len_in = frames_in * chans * (int) sizeof(float);
+      SDL_AudioCVT cvt;
+      float *buf;
+      int frames_out, margin;
+      double signal = 0.0, noise = 0.0, worst = 0.0, snr;
+
+      SDLTest_AssertPass("Resampling %i Hz to %i Hz with %i channels", rate_in, rate_out, chans);
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, rate_in, AUDIO_F32SYS, chans, rate_out);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1; got: %i", result);
+      if (result != 1) return TEST_ABORTED;
+
+      cvt.len = len_in;
+      cvt.buf = (Uint8 *)SDL_malloc(len_in * cvt.len_mult);
+      SDLTest_AssertCheck(cvt.buf != NULL, "Check data buffer to convert is not NULL");
+      if (cvt.buf == NULL) return TEST_ABORTED;
+
+      /* Each channel gets the same tone with a different phase */
+      buf = (float *)cvt.buf;
+      for (k = 0; k < frames_in; k++) {
+        for (c = 0; c < chans; c++) {
+          buf[k * chans + c] = (float)(0.5 * SDL_sin(2.0 * M_PI * frequency * k / rate_in + c));
+        }
+      }
+
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertPass("Call to SDL_ConvertAudio()");
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+
+      frames_out = cvt.len_cvt / (chans * (int) sizeof(float));
+      SDLTest_AssertCheck(frames_out == (int)(frames_in * ((double) rate_out / rate_in)) || frames_out == (int)(frames_in * ((double) rate_out / rate_in)) - 1,
+                          "Verify output frame count; expected: %i; got: %i", (int)(frames_in * ((double) rate_out / rate_in)), frames_out);
+
+      /* The edges ramp in and out of the zero padding; skip them */
+      margin = 64 * rate_out / rate_in + 16;
+      buf = (float *)cvt.buf;
+      for (k = margin; k < frames_out - margin; k++) {
+        for (c = 0; c < chans; c++) {
+          const double expected = 0.5 * SDL_sin(2.0 * M_PI * frequency * k / rate_out + c);
+          const double error = SDL_fabs(buf[k * chans + c] - expected);
+          signal += expected * expected;
+          noise += error * error;
+          if (error > worst) {
+            worst = error;
+          }
+        }
+      }
+      snr = (noise > 0.0) ? 10.0 * SDL_log10(signal / noise) : 999.0;
+      SDLTest_AssertCheck(worst <= max_error, "Verify maximum error; expected: <= %f; got: %f", max_error, worst);
+      SDLTest_AssertCheck(snr >= min_snr, "Verify signal-to-noise ratio; expected: >= %.1f dB; got: %.1f dB", min_snr, snr);
+
+      SDL_free(cvt.buf);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Helper: the resampler's Kaiser-windowed sinc table, built in double precision. */
+static double *
+_resamplerFilterTable(int *len)
+{
+  const int per_zero_crossing = 512, zero_crossings = 5;
+  const int tablelen = (per_zero_crossing * zero_crossings) + 1;
+  const int lenm1div2 = (tablelen - 1) / 2;
+  const double beta = 0.1102 * (80.0 - 8.7);
+  double *table = (double *)SDL_malloc(tablelen * sizeof(double));
+  double bessel_beta = 0.0;
+  int i, k;
+
+  if (table == NULL) {
+    return NULL;
+  }
+
+  /* modified Bessel function of the first kind, order zero, at beta and at each window position */
+  for (i = 0; i <= tablelen; i++) {
+    const double x = (i == tablelen) ? beta : beta * SDL_sqrt(1.0 - SDL_pow((((i - (tablelen - 1)) / 2.0) / lenm1div2), 2.0));
+    double term = 1.0, sum = 1.0;
+    for (k = 1; term > 1.0e-21; k++) {
+      term *= (x / 2.0) * (x / 2.0) / ((double) k * k);
+      sum += term;
+    }
+    if (i == tablelen) {
+      bessel_beta = sum;
+    } else if (i > 0) {
+      table[tablelen - i] = sum;
+    }
+  }
+
+  table[0] = 1.0;
+  for (i = 1; i < tablelen; i++) {
+    const double x = ((double) i / per_zero_crossing) * M_PI;
+    table[i] = (table[i] / bessel_beta) * (SDL_sin(x) / x);
+  }
+
+  *len = tablelen;
+  return table;
+}
+
+/* Helper: the filter at a distance of d input frames, linearly interpolated between table entries. */
+static double
+_resamplerFilterAt(const double *table, int tablelen, double d)
+{
+  const double position = d * 512.0;
+  const int index = (int) position;
+  if (index >= tablelen) {
+    return 0.0;
+  } else if (index == tablelen - 1) {
+    return table[index];
+  }
+  return table[index] + ((position - index) * (table[index + 1] - table[index]));
+}
+
+/**
+ * \brief Checks resampled output against the resampling filter evaluated in double precision.
+ *
+ * Ten rate pairs are used, more than the filter phase cache holds, so the last ones compute their taps per frame.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_resampleFilter()
+{
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 22050, 44100 }, { 44100, 22050 }, { 8000, 11025 },
+                           { 11025, 16000 }, { 16000, 48000 }, { 24000, 44100 }, { 96000, 44100 }, { 44100, 32000 } };
+  const int channels[] = { 1, 2, 6, 8 };
+  const double max_error = 0.00001;  /* float rounding; the pre-polyphase resampler was off by up to 0.004 */
+  const int frames_in = 1000;
+  double *table;
+  int tablelen, i, j, k, c, result;
+
+  table = _resamplerFilterTable(&tablelen);
+  SDLTest_AssertCheck(table != NULL, "Check filter table allocation");
+  if (table == NULL) return TEST_ABORTED;
+
+  for (i = 0; i < SDL_arraysize(rates); i++) {
+    for (j = 0; j < SDL_arraysize(channels); j++) {
+      const int rate_in = rates[i][0];
+      const int rate_out = rates[i][1];
+      const int chans = channels[j];
+      const int len_in = frames_in * chans * (int) sizeof(float);
+      SDL_AudioCVT cvt;
+      float *input, *output;
+      int frames_out;
+      double worst = 0.0;
+
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, rate_in, AUDIO_F32SYS, chans, rate_out);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1; got: %i", result);
+      if (result != 1) break;
+
+      cvt.len = len_in;
+      cvt.buf = (Uint8 *)SDL_malloc(len_in * cvt.len_mult);
+      input = (float *)SDL_malloc(len_in);
+      SDLTest_AssertCheck(cvt.buf != NULL && input != NULL, "Check data buffer allocations");
+      if (cvt.buf == NULL || input == NULL) {
+        SDL_free(cvt.buf);
+        SDL_free(input);
+        break;
+      }
+
+      for (k = 0; k < frames_in * chans; k++) {
+        input[k] = (float) ((SDLTest_RandomUnitDouble() * 2.0) - 1.0);
+      }
+      SDL_memcpy(cvt.buf, input, len_in);
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+
+      /* The input is padded with silence on both ends */
+      output = (float *)cvt.buf;
+      frames_out = cvt.len_cvt / (chans * (int) sizeof(float));
+      for (k = 0; k < frames_out; k++) {
+        const Sint64 position = (Sint64) k * rate_in;
+        const int srcindex = (int) (position / rate_out);
+        const double frac = (double) (position % rate_out) / rate_out;
+        for (c = 0; c < chans; c++) {
+          double expected = 0.0, error;
+          int tap;
+          for (tap = 0; tap <= 5; tap++) {
+            if (srcindex - tap >= 0 && srcindex - tap < frames_in) {
+              expected += input[(srcindex - tap) * chans + c] * _resamplerFilterAt(table, tablelen, frac + tap);
+            }
+            if (srcindex + 1 + tap < frames_in) {
+              expected += input[(srcindex + 1 + tap) * chans + c] * _resamplerFilterAt(table, tablelen, (1.0 - frac) + tap);
+            }
+          }
+          error = SDL_fabs(output[k * chans + c] - expected);
+          if (error > worst) {
+            worst = error;
+          }
+        }
+      }
+      SDLTest_AssertCheck(worst <= max_error, "Verify %i Hz to %i Hz with %i channels against the filter; expected error: <= %f; got: %f",
+                          rate_in, rate_out, chans, max_error, worst);
+
+      SDL_free(cvt.buf);
+      SDL_free(input);
+    }
+  }
+
+  SDL_free(table);
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mixes two bound streams into a device and checks what the disk driver wrote.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ * \sa https://wiki.libsdl.org/SDL_UnbindAudioStream
+ */
+int audio_bindAudioStreams()
+{
+  const int frames = 4096;
+  const float value1 = 0.25f, value2 = 0.5f, gain2 = 0.5f;
+  SDL_AudioSpec desired;
+  SDL_AudioStream *stream1, *stream2, *wrong;
+  SDL_AudioDeviceID id;
+  char *driver;
+  float *buf;
+  Sint16 *written;
+  size_t written_len;
+  int i, result, available, mismatches;
+  Uint32 start;
+
+  /* Remember the driver so it can be restored afterwards */
+  driver = SDL_strdup(SDL_GetCurrentAudioDriver() ? SDL_GetCurrentAudioDriver() : "dummy");
+  SDLTest_AssertCheck(driver != NULL, "Check SDL_strdup result");
+  if (driver == NULL) return TEST_ABORTED;
+
+  /* Negative cases */
+  stream1 = SDL_NewAudioStream(AUDIO_F32SYS, 2, 48000, AUDIO_F32SYS, 2, 48000);
+  SDLTest_AssertCheck(stream1 != NULL, "Check SDL_NewAudioStream result");
+  if (stream1 == NULL) return TEST_ABORTED;
+  result = SDL_BindAudioStream(0, stream1, 1.0f);
+  SDLTest_AssertPass("Call to SDL_BindAudioStream(0, ...)");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1; got: %i", result);
+
+  /* The disk driver writes exactly what was mixed */
+  SDL_AudioQuit();
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  if (result != 0) {
+    SDL_FreeAudioStream(stream1);
+    SDL_free(driver);
+    return TEST_ABORTED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 48000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = NULL;  /* queued audio, which is silence when nothing is queued */
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice()");
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+
+  if (id > 1) {
+    result = SDL_BindAudioStream(id, NULL, 1.0f);
+    SDLTest_AssertCheck(result == -1, "Verify binding a NULL stream fails; got: %i", result);
+    wrong = SDL_NewAudioStream(AUDIO_F32SYS, 2, 48000, AUDIO_S16SYS, 2, 48000);
+    result = SDL_BindAudioStream(id, wrong, 1.0f);
+    SDLTest_AssertCheck(result == -1, "Verify binding a stream with the wrong output format fails; got: %i", result);
+    SDL_FreeAudioStream(wrong);
+
+    /* stream1 has twice as much data as stream2 */
+    stream2 = SDL_NewAudioStream(AUDIO_F32SYS, 2, 48000, AUDIO_F32SYS, 2, 48000);
+    buf = (float *) SDL_malloc(frames * 2 * sizeof (float));
+    SDLTest_AssertCheck(stream2 != NULL && buf != NULL, "Check stream and buffer allocations");
+    if (stream2 != NULL && buf != NULL) {
+      for (i = 0; i < frames * 2; i++) buf[i] = value1;
+      SDL_AudioStreamPut(stream1, buf, frames * 2 * sizeof (float));
+      for (i = 0; i < frames; i++) buf[i] = value2;
+      SDL_AudioStreamPut(stream2, buf, frames * sizeof (float));
+
+      result = SDL_BindAudioStream(id, stream1, 0.0f);
+      SDLTest_AssertCheck(result == 0, "Verify result from SDL_BindAudioStream; expected: 0; got: %i", result);
+      result = SDL_BindAudioStream(id, stream2, gain2);
+      SDLTest_AssertCheck(result == 0, "Verify result from SDL_BindAudioStream; expected: 0; got: %i", result);
+      result = SDL_BindAudioStream(id, stream1, 1.0f);
+      SDLTest_AssertCheck(result == 0, "Verify rebinding a stream to change its gain; expected: 0; got: %i", result);
+
+      /* Play until both streams are drained, then a little longer */
+      SDL_PauseAudioDevice(id, 0);
+      start = SDL_GetTicks();
+      do {
+        SDL_Delay(10);
+        SDL_LockAudioDevice(id);
+        available = SDL_AudioStreamAvailable(stream1) + SDL_AudioStreamAvailable(stream2);
+        SDL_UnlockAudioDevice(id);
+      } while (available > 0 && !SDL_TICKS_PASSED(SDL_GetTicks(), start + 5000));
+      SDLTest_AssertCheck(available == 0, "Verify the device drained the bound streams; remaining bytes: %i", available);
+      SDL_Delay(100);
+
+      SDL_UnbindAudioStream(id, stream1);
+      SDL_UnbindAudioStream(id, stream2);
+      SDLTest_AssertPass("Call to SDL_UnbindAudioStream()");
+    }
+    SDL_CloseAudioDevice(id);
+    SDL_FreeAudioStream(stream2);
+    SDL_free(buf);
+
+    /* First frames have both streams, then just stream1, then silence */
+    written = (Sint16 *) SDL_LoadFile("sdlaudio.raw", &written_len);
+    SDLTest_AssertCheck(written != NULL, "Check SDL_LoadFile result");
+    if (written != NULL) {
+      const int both = (int) ((value1 + value2 * gain2) * 32767.0f);
+      const int one = (int) (value1 * 32767.0f);
+      const int total = (int) (written_len / sizeof (Sint16));
+      int first;
+
+      /* The device plays silence until it is unpaused */
+      for (first = 0; first < total && written[first] == 0; first++) {
+      }
+      SDLTest_AssertCheck(total - first >= frames * 2, "Verify written samples; expected: >= %i; got: %i", frames * 2, total - first);
+      if (total - first >= frames * 2) {
+        mismatches = 0;
+        for (i = first; i < total; i++) {
+          const int expected = (i - first < frames) ? both : ((i - first < frames * 2) ? one : 0);
+          if (SDL_abs(written[i] - expected) > 1) {
+            mismatches++;
+          }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify mixed samples; expected %i then %i then silence; %i samples differ", both, one, mismatches);
+      }
+      SDL_free(written);
+    }
+  }
+
+  SDL_FreeAudioStream(stream1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit(driver);
+  SDLTest_AssertCheck(result == 0, "Restore audio driver '%s'; got: %i", driver, result);
+  SDL_free(driver);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a running frame counter into both channels. */
+static void SDLCALL _audio_testCounterCallback(void *userdata, Uint8 *stream, int len)
+{
+  Sint16 *samples = (Sint16 *) stream;
+  Uint32 *counter = (Uint32 *) userdata;
+  int i;
+
+  for (i = 0; i < len / 4; i++) {
+    samples[i * 2] = samples[i * 2 + 1] = (Sint16) (*counter)++;
+  }
+}
+
+/**
+ * \brief Renders audio with the disk driver in freerun mode and reads back the WAV file.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDevicePosition
+ */
+int audio_diskFreerunWav()
+{
+  const char *filename = "sdlaudio-freerun.wav";
+  const Uint64 target = 44100 * 5;  /* five seconds */
+  SDL_AudioSpec desired, loaded;
+  SDL_AudioDeviceID id;
+  Uint32 counter = 0, start, elapsed, frames, mismatches, i;
+  Uint64 position, position2;
+  Uint8 *wav = NULL;
+  Uint32 wavlen = 0;
+  char *driver;
+  int result;
+
+  driver = SDL_strdup(SDL_GetCurrentAudioDriver() ? SDL_GetCurrentAudioDriver() : "dummy");
+  SDLTest_AssertCheck(driver != NULL, "Check SDL_strdup result");
+  if (driver == NULL) return TEST_ABORTED;
+
+  position = SDL_GetAudioDevicePosition(0);
+  SDLTest_AssertCheck(position == 0, "Verify SDL_GetAudioDevicePosition(0); expected: 0; got: %u", (unsigned int) position);
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "1", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  if (result != 0) {
+    SDL_setenv("SDL_DISKAUDIOFREERUN", "0", 1);
+    SDL_free(driver);
+    return TEST_ABORTED;
+  }
+
+  /* Big endian samples get converted; the file is always little endian. */
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = _audio_testCounterCallback;
+  desired.userdata = &counter;
+  id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s')", filename);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+
+  if (id > 1) {
+    /* Nothing is written while paused */
+    SDL_Delay(50);
+    position = SDL_GetAudioDevicePosition(id);
+    SDLTest_AssertCheck(position == 0, "Verify position while paused; expected: 0; got: %u", (unsigned int) position);
+
+    start = SDL_GetTicks();
+    SDL_PauseAudioDevice(id, 0);
+    do {
+      SDL_Delay(1);
+      position = SDL_GetAudioDevicePosition(id);
+      elapsed = SDL_GetTicks() - start;
+    } while ((position < target) && (elapsed < 10000));
+    SDL_PauseAudioDevice(id, 1);
+    SDLTest_AssertCheck(position >= target, "Verify position; expected: >= %u; got: %u", (unsigned int) target, (unsigned int) position);
+    SDLTest_AssertCheck(elapsed < 2500, "Verify five seconds rendered faster than realtime; took %u ms", (unsigned int) elapsed);
+
+    /* The clock stops while paused */
+    SDL_Delay(20);
+    position = SDL_GetAudioDevicePosition(id);
+    SDL_Delay(50);
+    position2 = SDL_GetAudioDevicePosition(id);
+    SDLTest_AssertCheck(position == position2, "Verify position doesn't move while paused; got: %u then %u", (unsigned int) position, (unsigned int) position2);
+    SDLTest_AssertCheck(position == counter, "Verify position matches the frames the callback wrote; expected: %u; got: %u", counter, (unsigned int) position);
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+    SDL_zero(loaded);
+    if (SDL_LoadWAV(filename, &loaded, &wav, &wavlen) == NULL) {
+      SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV('%s') failed: %s", filename, SDL_GetError());
+    } else {
+      SDLTest_AssertPass("Call to SDL_LoadWAV('%s')", filename);
+      SDLTest_AssertCheck(loaded.format == AUDIO_S16LSB, "Verify WAV format; expected: %u; got: %u", AUDIO_S16LSB, loaded.format);
+      SDLTest_AssertCheck(loaded.channels == 2, "Verify WAV channels; expected: 2; got: %i", loaded.channels);
+      SDLTest_AssertCheck(loaded.freq == 44100, "Verify WAV rate; expected: 44100; got: %i", loaded.freq);
+
+      /* Pausing can race with one buffer of silence, but everything the callback wrote is there in order. */
+      frames = wavlen / 4;
+      SDLTest_AssertCheck(frames >= counter && frames <= counter + desired.samples,
+                          "Verify WAV length; expected: %u to %u frames; got: %u", counter, counter + desired.samples, frames);
+      mismatches = 0;
+      for (i = 0; i < SDL_min(frames, counter); i++) {
+        const Sint16 left = (Sint16) SDL_SwapLE16(((Uint16 *) wav)[i * 2]);
+        const Sint16 right = (Sint16) SDL_SwapLE16(((Uint16 *) wav)[i * 2 + 1]);
+        if ((left != (Sint16) i) || (right != (Sint16) i)) {
+          mismatches++;
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify WAV samples; %u frames differ", mismatches);
+      SDL_FreeWAV(wav);
+    }
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "0", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit(driver);
+  SDLTest_AssertCheck(result == 0, "Restore audio driver '%s'; got: %i", driver, result);
+  SDL_free(driver);
+  remove(filename);
+
+  return TEST_COMPLETED;
+}
+
+/* Takes three buffers' worth of time to produce one buffer of silence. */
+static void SDLCALL _audio_testSlowCallback(void *userdata, Uint8 *stream, int len)
+{
+  const SDL_AudioSpec *spec = (const SDL_AudioSpec *) userdata;
+  SDL_memset(stream, 0, len);
+  SDL_Delay((spec->samples * 3000) / spec->freq);
+}
+
+static Uint32
+_audio_sumHistogram(const SDL_AudioDeviceStats *stats)
+{
+  Uint32 sum = 0;
+  int i;
+  for (i = 0; i < SDL_AUDIO_STATS_BUCKETS; i++) {
+    sum += stats->callback_histogram[i];
+  }
+  return sum;
+}
+
+/**
+ * \brief Checks the counters of SDL_GetAudioDeviceStats with queued audio and a slow callback.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceStats
+ */
+int audio_getAudioDeviceStats()
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceStats stats;
+  SDL_AudioDeviceID id;
+  Uint8 *buf;
+  Uint32 buflen, start;
+  char *driver;
+  int result;
+
+  driver = SDL_strdup(SDL_GetCurrentAudioDriver() ? SDL_GetCurrentAudioDriver() : "dummy");
+  SDLTest_AssertCheck(driver != NULL, "Check SDL_strdup result");
+  if (driver == NULL) return TEST_ABORTED;
+
+  /* Negative cases */
+  result = SDL_GetAudioDeviceStats(0, &stats, SDL_FALSE);
+  SDLTest_AssertCheck(result == -1, "Verify SDL_GetAudioDeviceStats(0, ...); expected: -1; got: %i", result);
+
+  /* The disk driver paces itself like a real device */
+  SDL_AudioQuit();
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  if (result != 0) {
+    SDL_free(driver);
+    return TEST_ABORTED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 48000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = NULL;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+  if (id > 1) {
+    result = SDL_GetAudioDeviceStats(id, NULL, SDL_FALSE);
+    SDLTest_AssertCheck(result == -1, "Verify SDL_GetAudioDeviceStats(id, NULL, ...); expected: -1; got: %i", result);
+
+    /* Four buffers of queued audio, then it runs dry once */
+    buflen = obtained.size * 4;
+    buf = (Uint8 *) SDL_calloc(1, buflen);
+    SDLTest_AssertCheck(buf != NULL, "Check buffer allocation");
+    if (buf != NULL) {
+      SDL_QueueAudio(id, buf, buflen);
+      result = SDL_GetAudioDeviceStats(id, &stats, SDL_FALSE);
+      SDLTest_AssertCheck(result == 0, "Verify SDL_GetAudioDeviceStats result; expected: 0; got: %i", result);
+      SDLTest_AssertCheck(stats.queued_bytes == buflen, "Verify queued bytes; expected: %u; got: %u", buflen, stats.queued_bytes);
+      SDLTest_AssertCheck(stats.callbacks == 0 && stats.underruns == 0, "Verify nothing is counted while paused; got %u callbacks, %u underruns", stats.callbacks, stats.underruns);
+
+      SDL_PauseAudioDevice(id, 0);
+      start = SDL_GetTicks();
+      while ((SDL_GetQueuedAudioSize(id) > 0) && ((SDL_GetTicks() - start) < 5000)) {
+        SDL_Delay(10);
+      }
+      SDL_Delay(100);
+      SDL_GetAudioDeviceStats(id, &stats, SDL_TRUE);
+      SDLTest_AssertCheck(stats.callbacks >= 5, "Verify callbacks; expected: >= 5; got: %u", stats.callbacks);
+      SDLTest_AssertCheck(stats.underruns == 1, "Verify one underrun; got: %u", stats.underruns);
+      SDLTest_AssertCheck(stats.queued_bytes == 0, "Verify queued bytes; expected: 0; got: %u", stats.queued_bytes);
+      SDLTest_AssertCheck(_audio_sumHistogram(&stats) == stats.callbacks, "Verify histogram adds up to %u callbacks; got: %u", stats.callbacks, _audio_sumHistogram(&stats));
+      SDLTest_AssertCheck(stats.max_interval_ticks > 0, "Verify the interval between callbacks is measured");
+
+      /* Reset, and running dry again counts again */
+      SDL_QueueAudio(id, buf, obtained.size);
+      start = SDL_GetTicks();
+      while ((SDL_GetQueuedAudioSize(id) > 0) && ((SDL_GetTicks() - start) < 5000)) {
+        SDL_Delay(10);
+      }
+      SDL_Delay(50);
+      SDL_GetAudioDeviceStats(id, &stats, SDL_FALSE);
+      SDLTest_AssertCheck(stats.underruns == 1, "Verify one underrun after reset; got: %u", stats.underruns);
+      SDL_free(buf);
+    }
+    SDL_CloseAudioDevice(id);
+  }
+
+  /* A callback that is too slow for its buffers misses every deadline */
+  desired.callback = _audio_testSlowCallback;
+  desired.userdata = &obtained;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+  if (id > 1) {
+    SDL_PauseAudioDevice(id, 0);
+    SDL_Delay(200);
+    SDL_GetAudioDeviceStats(id, &stats, SDL_FALSE);
+    SDLTest_AssertCheck(stats.callbacks > 0, "Verify callbacks; expected: > 0; got: %u", stats.callbacks);
+    SDLTest_AssertCheck(stats.deadline_misses == stats.callbacks, "Verify every callback missed its deadline; expected: %u; got: %u", stats.callbacks, stats.deadline_misses);
+    SDLTest_AssertCheck(stats.callback_histogram[SDL_AUDIO_STATS_BUCKETS - 1] == stats.callbacks, "Verify callbacks are in the last histogram bucket; expected: %u; got: %u",
+                        stats.callbacks, stats.callback_histogram[SDL_AUDIO_STATS_BUCKETS - 1]);
+    SDLTest_AssertCheck(stats.max_callback_ticks >= (SDL_GetPerformanceFrequency() * obtained.samples * 2) / obtained.freq, "Verify the longest callback is measured");
+    SDL_CloseAudioDevice(id);
+  }
+
+  SDL_AudioQuit();
+  result = SDL_AudioInit(driver);
+  SDLTest_AssertCheck(result == 0, "Restore audio driver '%s'; got: %i", driver, result);
+  SDL_free(driver);
+
+  return TEST_COMPLETED;
+}
+
+/* Reference mixer for one sample, matching the scalar code in SDL_mixer.c. */
+static void
+_mixReferenceSample(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, int volume)
+{
+  switch (format) {
+    case AUDIO_U8: {
+      const int s = (((*src - 128) * volume) / SDL_MIX_MAXVOLUME) + 128;
+      const int d = *dst + s - 128;
+      *dst = (Uint8) ((d < 0) ? 0 : (d > 0xFE) ? 0xFE : d);
+      break;
+    }
+    case AUDIO_S8: {
+      const int d = *((Sint8 *) dst) + ((*((Sint8 *) src) * volume) / SDL_MIX_MAXVOLUME);
+      *((Sint8 *) dst) = (Sint8) ((d < -128) ? -128 : (d > 127) ? 127 : d);
+      break;
+    }
+    case AUDIO_S16SYS: {
+      Sint16 s, d;
+      int sum;
+      SDL_memcpy(&s, src, sizeof (s));
+      SDL_memcpy(&d, dst, sizeof (d));
+      sum = d + ((s * volume) / SDL_MIX_MAXVOLUME);
+      d = (Sint16) ((sum < -32768) ? -32768 : (sum > 32767) ? 32767 : sum);
+      SDL_memcpy(dst, &d, sizeof (d));
+      break;
+    }
+    case AUDIO_S32SYS: {
+      Sint32 s, d;
+      Sint64 sum;
+      SDL_memcpy(&s, src, sizeof (s));
+      SDL_memcpy(&d, dst, sizeof (d));
+      sum = d + ((((Sint64) s) * volume) / SDL_MIX_MAXVOLUME);
+      d = (Sint32) ((sum < SDL_MIN_SINT32) ? SDL_MIN_SINT32 : (sum > SDL_MAX_SINT32) ? SDL_MAX_SINT32 : sum);
+      SDL_memcpy(dst, &d, sizeof (d));
+      break;
+    }
+    case AUDIO_F32SYS: {
+      float s, d;
+      double sum;
+      SDL_memcpy(&s, src, sizeof (s));
+      SDL_memcpy(&d, dst, sizeof (d));
+      s = (s * (float) volume) * (1.0f / ((float) SDL_MIX_MAXVOLUME));
+      sum = ((double) s) + ((double) d);
+      if (sum > 3.402823466e+38F) {
+        sum = 3.402823466e+38F;
+      } else if (sum < -3.402823466e+38F) {
+        sum = -3.402823466e+38F;
+      }
+      d = (float) sum;
+      SDL_memcpy(dst, &d, sizeof (d));
+      break;
+    }
+  }
+}
+
+/**
+ * \brief Checks that SDL_MixAudioFormat matches the scalar mixing code bit for bit.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormat()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_U8, AUDIO_S8, AUDIO_S16SYS, AUDIO_S32SYS, AUDIO_F32SYS };
+  const char *formatNames[] = { "AUDIO_U8", "AUDIO_S8", "AUDIO_S16SYS", "AUDIO_S32SYS", "AUDIO_F32SYS" };
+  const int volumes[] = { 1, 3, 64, 100, 127, SDL_MIX_MAXVOLUME };
+  const Uint32 maxlen = 1027 * 4;
+  Uint8 *src, *dst, *expected;
+  int i, j;
+
+  src = (Uint8 *) SDL_malloc(maxlen);
+  dst = (Uint8 *) SDL_malloc(maxlen);
+  expected = (Uint8 *) SDL_malloc(maxlen);
+  SDLTest_AssertCheck(src && dst && expected, "Allocate buffers");
+  if (!src || !dst || !expected) {
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < SDL_arraysize(formats); i++) {
+    const int samplesize = SDL_AUDIO_BITSIZE(formats[i]) / 8;
+    for (j = 0; j < SDL_arraysize(volumes); j++) {
+      /* Odd sample counts and a one-sample offset, so the vector tails and unaligned loads get used. */
+      const Uint32 offset = (j & 1) ? samplesize : 0;
+      const Uint32 len = (((Uint32) SDLTest_RandomIntegerInRange(1, 1023)) * samplesize) + ((j & 2) ? 1 : 0);
+      Uint32 k, mismatches = 0;
+
+      for (k = 0; k < maxlen; k++) {
+        src[k] = SDLTest_RandomUint8();
+        dst[k] = SDLTest_RandomUint8();
+      }
+      /* Put extremes in the first few samples; random bytes rarely hit them. */
+      for (k = 0; k < samplesize; k++) {
+        src[offset + k] = 0xFF;
+        dst[offset + k] = 0x7F;
+        src[offset + samplesize + k] = 0x00;
+        dst[offset + samplesize + k] = 0x80;
+      }
+      SDL_memcpy(expected, dst, maxlen);
+      for (k = 0; k + samplesize <= len; k += samplesize) {
+        _mixReferenceSample(expected + offset + k, src + offset + k, formats[i], volumes[j]);
+      }
+
+      SDL_MixAudioFormat(dst + offset, src + offset, formats[i], len, volumes[j]);
+      for (k = 0; k < maxlen; k += samplesize) {
+        int m;
+        if (formats[i] == AUDIO_F32SYS) {
+          /* Which NaN survives when both inputs are NaN is up to the compiler, so any NaN will do there. */
+          float a, b;
+          SDL_memcpy(&a, dst + k, sizeof (a));
+          SDL_memcpy(&b, expected + k, sizeof (b));
+          if ((a != a) && (b != b)) {
+            continue;
+          }
+        }
+        for (m = 0; m < samplesize; m++) {
+          if (dst[k + m] != expected[k + m]) {
+            mismatches++;
+          }
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MixAudioFormat(%s, len=%u, volume=%i) output; expected: 0 differing bytes, got: %u",
+                          formatNames[i], (unsigned int) len, volumes[j], (unsigned int) mismatches);
+    }
+  }
+
+  SDL_free(src);
+  SDL_free(dst);
+  SDL_free(expected);
+
+  return TEST_COMPLETED;
+}
+
+
+/* Write a RIFF/WAVE header for the given format to wav, followed by datalen bytes of random data; returns the file size */
+static Uint32
+_audio_buildWave(Uint8 *wav, Uint16 encoding, Uint16 channels, Uint16 blockalign, Uint16 bits, Uint16 samplesperblock, Uint32 datalen)
+{
+  const Uint32 fmtlen = (encoding == 0x0011) ? 20 : 16;
+  Uint8 *p = wav;
+  Uint32 i;
+
+#define WAVE_PUT32(v) do { const Uint32 v32 = (Uint32) (v); p[0] = v32 & 0xFF; p[1] = (v32 >> 8) & 0xFF; p[2] = (v32 >> 16) & 0xFF; p[3] = v32 >> 24; p += 4; } while (0)
+#define WAVE_PUT16(v) do { const Uint32 v16 = (Uint32) (v); p[0] = v16 & 0xFF; p[1] = (v16 >> 8) & 0xFF; p += 2; } while (0)
+  SDL_memcpy(p, "RIFF", 4); p += 4;
+  WAVE_PUT32(4 + 8 + fmtlen + 8 + datalen);
+  SDL_memcpy(p, "WAVEfmt ", 8); p += 8;
+  WAVE_PUT32(fmtlen);
+  WAVE_PUT16(encoding);
+  WAVE_PUT16(channels);
+  WAVE_PUT32(22050);
+  WAVE_PUT32(22050 * blockalign);
+  WAVE_PUT16(blockalign);
+  WAVE_PUT16(bits);
+  if (encoding == 0x0011) {
+    WAVE_PUT16(2);
+    WAVE_PUT16(samplesperblock);
+  }
+  SDL_memcpy(p, "data", 4); p += 4;
+  WAVE_PUT32(datalen);
+#undef WAVE_PUT16
+#undef WAVE_PUT32
+
+  for (i = 0; i < datalen; i++) {
+    p[i] = SDLTest_RandomUint8();
+  }
+  if (encoding == 0x0011) {
+    /* Keep the IMA ADPCM step indexes in range */
+    for (i = 0; i + blockalign <= datalen; i += blockalign) {
+      Uint16 c;
+      for (c = 0; c < channels; c++) {
+        p[i + c * 4 + 2] %= 89;
+        p[i + c * 4 + 3] = 0;
+      }
+    }
+  }
+  return (Uint32) (p - wav) + datalen;
+}
+
+/**
+ * \brief Decode WAVE files incrementally and compare against SDL_LoadWAV_RW.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewWAVDecoder
+ * \sa https://wiki.libsdl.org/SDL_WAVDecoderRead
+ * \sa https://wiki.libsdl.org/SDL_WAVDecoderSeek
+ * \sa https://wiki.libsdl.org/SDL_WAVDecoderPut
+ */
+int audio_wavDecoder()
+{
+  /* 24-bit stereo PCM, and stereo IMA ADPCM with 505 frames per block and a trailing partial block */
+  const struct { const char *name; Uint16 encoding, channels, blockalign, bits, samplesperblock; Uint32 datalen, frames; } waves[] = {
+    { "PCM24", 0x0001, 2, 6, 24, 1, 6 * 3001 + 2, 3001 },
+    { "IMA_ADPCM", 0x0011, 2, 512, 4, 505, 512 * 7 + 100, 505 * 7 }
+  };
+  const Uint32 maxlen = 32768;
+  Uint8 *wav, *expected, *decoded;
+  int i;
+
+  wav = (Uint8 *) SDL_malloc(maxlen);
+  decoded = (Uint8 *) SDL_malloc(maxlen);
+  SDLTest_AssertCheck(wav && decoded, "Allocate buffers");
+  if (!wav || !decoded) {
+    SDL_free(wav);
+    SDL_free(decoded);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < SDL_arraysize(waves); i++) {
+    SDL_AudioSpec spec, loadspec;
+    SDL_WAVDecoder *decoder;
+    SDL_AudioStream *stream;
+    Uint32 wavlen, expectedlen, framesize, total, frame;
+    int result, chunk, j;
+
+    wavlen = _audio_buildWave(wav, waves[i].encoding, waves[i].channels, waves[i].blockalign,
+                              waves[i].bits, waves[i].samplesperblock, waves[i].datalen);
+    SDLTest_AssertCheck(SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &loadspec, &expected, &expectedlen) != NULL,
+                        "Call to SDL_LoadWAV_RW(%s)", waves[i].name);
+    if (expected == NULL) {
+      continue;
+    }
+
+    decoder = SDL_NewWAVDecoder(SDL_RWFromConstMem(wav, wavlen), 1, &spec);
+    SDLTest_AssertPass("Call to SDL_NewWAVDecoder(%s)", waves[i].name);
+    SDLTest_AssertCheck(decoder != NULL, "Validate decoder; expected: != NULL, got: %p", (void *) decoder);
+    if (decoder == NULL) {
+      SDL_FreeWAV(expected);
+      continue;
+    }
+    SDLTest_AssertCheck(spec.format == loadspec.format && spec.channels == loadspec.channels && spec.freq == loadspec.freq,
+                        "Validate spec matches SDL_LoadWAV_RW");
+    framesize = (SDL_AUDIO_BITSIZE(spec.format) / 8) * spec.channels;
+    SDLTest_AssertCheck(SDL_WAVDecoderLength(decoder) == waves[i].frames, "Validate length; expected: %u, got: %u",
+                        (unsigned int) waves[i].frames, (unsigned int) SDL_WAVDecoderLength(decoder));
+    SDLTest_AssertCheck(expectedlen == waves[i].frames * framesize, "Validate SDL_LoadWAV_RW length; expected: %u, got: %u",
+                        (unsigned int) (waves[i].frames * framesize), (unsigned int) expectedlen);
+
+    /* Read in odd-sized pieces, which splits sample frames and ADPCM blocks */
+    total = 0;
+    chunk = 1000;
+    do {
+      result = SDL_WAVDecoderRead(decoder, decoded + total, chunk);
+      if (result > 0) {
+        total += result;
+      }
+      chunk = (chunk * 7) % 3001 + 1;
+    } while (result > 0 && total < maxlen);
+    SDLTest_AssertCheck(result == 0, "Validate last SDL_WAVDecoderRead() result; expected: 0, got: %i", result);
+    SDLTest_AssertCheck(total == expectedlen && SDL_memcmp(decoded, expected, expectedlen) == 0,
+                        "Validate decoded data matches SDL_LoadWAV_RW; expected: %u bytes, got: %u", (unsigned int) expectedlen, (unsigned int) total);
+    SDLTest_AssertCheck(SDL_WAVDecoderTell(decoder) == waves[i].frames, "Validate position at end; expected: %u, got: %u",
+                        (unsigned int) waves[i].frames, (unsigned int) SDL_WAVDecoderTell(decoder));
+
+    /* Seek around, including into the middle of ADPCM blocks */
+    for (j = 0; j < 8; j++) {
+      frame = (j == 7) ? waves[i].frames : (Uint32) SDLTest_RandomIntegerInRange(0, waves[i].frames - 1);
+      result = SDL_WAVDecoderSeek(decoder, frame);
+      SDLTest_AssertCheck(result == 0, "Call to SDL_WAVDecoderSeek(%u); expected: 0, got: %i", (unsigned int) frame, result);
+      SDLTest_AssertCheck(SDL_WAVDecoderTell(decoder) == frame, "Validate SDL_WAVDecoderTell(); expected: %u, got: %u",
+                          (unsigned int) frame, (unsigned int) SDL_WAVDecoderTell(decoder));
+      result = SDL_WAVDecoderRead(decoder, decoded, 97 * framesize);
+      total = SDL_min(97, waves[i].frames - frame) * framesize;
+      SDLTest_AssertCheck(result == (int) total && SDL_memcmp(decoded, expected + frame * framesize, total) == 0,
+                          "Validate data after seek; expected: %u bytes, got: %i", (unsigned int) total, result);
+    }
+    result = SDL_WAVDecoderSeek(decoder, waves[i].frames + 1);
+    SDLTest_AssertCheck(result == -1, "Validate seek past the end fails; expected: -1, got: %i", result);
+
+    /* Feed an audio stream that doesn't convert anything */
+    stream = SDL_NewAudioStream(spec.format, spec.channels, spec.freq, spec.format, spec.channels, spec.freq);
+    SDLTest_AssertCheck(stream != NULL, "Call to SDL_NewAudioStream()");
+    if (stream != NULL) {
+      SDL_WAVDecoderSeek(decoder, 0);
+      total = 0;
+      while ((result = SDL_WAVDecoderPut(decoder, stream, 4097)) > 0) {
+        total += result;
+      }
+      SDLTest_AssertCheck(result == 0 && total == expectedlen, "Validate SDL_WAVDecoderPut() total; expected: %u, got: %u",
+                          (unsigned int) expectedlen, (unsigned int) total);
+      SDL_AudioStreamFlush(stream);
+      result = SDL_AudioStreamGet(stream, decoded, maxlen);
+      SDLTest_AssertCheck(result == (int) expectedlen && SDL_memcmp(decoded, expected, expectedlen) == 0,
+                          "Validate stream output; expected: %u bytes, got: %i", (unsigned int) expectedlen, result);
+      SDL_FreeAudioStream(stream);
+    }
+
+    SDL_FreeWAVDecoder(decoder);
+    SDL_FreeWAV(expected);
+  }
+
+  /* A data chunk that claims more than the file holds */
+  {
+    SDL_AudioSpec spec;
+    SDL_WAVDecoder *decoder;
+    Uint8 *buf = NULL;
+    Uint32 len = 0, wavlen;
+    int result;
+
+    wavlen = _audio_buildWave(wav, 0x0001, 1, 2, 16, 1, 1000) - 400;
+    SDLTest_AssertCheck(SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &buf, &len) == NULL,
+                        "Validate SDL_LoadWAV_RW fails on truncated data");
+    decoder = SDL_NewWAVDecoder(SDL_RWFromConstMem(wav, wavlen), 1, &spec);
+    SDLTest_AssertCheck(decoder != NULL, "Call to SDL_NewWAVDecoder(truncated)");
+    if (decoder != NULL) {
+      result = SDL_WAVDecoderRead(decoder, decoded, 2000);
+      SDLTest_AssertCheck(result == 600, "Validate truncated read; expected: 600, got: %i", result);
+      SDLTest_AssertCheck(SDL_WAVDecoderLength(decoder) == 300, "Validate length is lowered; expected: 300, got: %u",
+                          (unsigned int) SDL_WAVDecoderLength(decoder));
+      SDL_FreeWAVDecoder(decoder);
+    }
+  }
+
+  SDL_free(wav);
+  SDL_free(decoded);
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Queue audio through reserved memory, and read captured audio in place.
+ *
+ * \sa https://wiki.libsdl.org/SDL_ReserveQueuedAudio
+ * \sa https://wiki.libsdl.org/SDL_CommitQueuedAudio
+ * \sa https://wiki.libsdl.org/SDL_PeekQueuedAudio
+ * \sa https://wiki.libsdl.org/SDL_ConsumeQueuedAudio
+ */
+int audio_reserveAndPeekQueuedAudio()
+{
+  const char *outname = "sdlaudio-reserve.wav";
+  const char *inname = "sdlaudio-peek.raw";
+  /* Six channels, so sample frames straddle the queue's packets */
+  const Uint32 samples = 6 * 3000;
+  const Uint32 inlen = 20000;
+  SDL_AudioSpec desired, loaded;
+  SDL_AudioDeviceID id;
+  SDL_RWops *rw;
+  Uint8 *wav = NULL, *p;
+  Uint32 wavlen = 0, written, len, mismatches, start, i;
+  char *driver;
+  int result;
+
+  driver = SDL_strdup(SDL_GetCurrentAudioDriver() ? SDL_GetCurrentAudioDriver() : "dummy");
+  SDLTest_AssertCheck(driver != NULL, "Check SDL_strdup result");
+  if (driver == NULL) return TEST_ABORTED;
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "1", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  if (result != 0) {
+    SDL_setenv("SDL_DISKAUDIOFREERUN", "0", 1);
+    SDL_free(driver);
+    return TEST_ABORTED;
+  }
+
+  /* Big endian samples get converted, as WAV files are little endian. */
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16MSB;
+  desired.channels = 6;
+  desired.samples = 512;
+  id = SDL_OpenAudioDevice(outname, 0, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s')", outname);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+
+  if (id > 1) {
+    for (written = 0; written < samples * 2; written += len) {
+      len = SDL_min(5000, samples * 2 - written);
+      p = (Uint8 *) SDL_ReserveQueuedAudio(id, &len);
+      SDLTest_AssertCheck(p != NULL && len > 0 && len <= 5000, "Call to SDL_ReserveQueuedAudio(); got %u bytes", len);
+      if (p == NULL || len == 0) {
+        break;
+      }
+      if (written == 0) {
+        Uint32 len2 = len;
+        result = SDL_QueueAudio(id, &written, sizeof (written));
+        SDLTest_AssertCheck(result == -1, "Validate SDL_QueueAudio() fails during a reservation; expected: -1, got: %i", result);
+        SDLTest_AssertCheck(SDL_ReserveQueuedAudio(id, &len2) == NULL && len2 == 0, "Validate a second reservation fails");
+        result = SDL_CommitQueuedAudio(id, len + 1);
+        SDLTest_AssertCheck(result == -1, "Validate committing more than reserved fails; expected: -1, got: %i", result);
+        result = SDL_CommitQueuedAudio(id, 0);
+        SDLTest_AssertCheck(result == 0, "Validate cancelling the reservation; expected: 0, got: %i", result);
+        SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Validate nothing was queued");
+        p = (Uint8 *) SDL_ReserveQueuedAudio(id, &len);
+        SDLTest_AssertCheck(p != NULL, "Call to SDL_ReserveQueuedAudio() after cancelling");
+        if (p == NULL) {
+          break;
+        }
+      }
+      /* Sample n is n, big endian */
+      for (i = 0; i < len; i++) {
+        const Uint32 n = (written + i) / 2;
+        p[i] = ((written + i) & 1) ? (Uint8) (n & 0xFF) : (Uint8) ((n >> 8) & 0xFF);
+      }
+      result = SDL_CommitQueuedAudio(id, len);
+      SDLTest_AssertCheck(result == 0, "Call to SDL_CommitQueuedAudio(%u); expected: 0, got: %i", len, result);
+    }
+    SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == samples * 2, "Validate queued size; expected: %u, got: %u",
+                        samples * 2, SDL_GetQueuedAudioSize(id));
+
+    start = SDL_GetTicks();
+    SDL_PauseAudioDevice(id, 0);
+    while ((SDL_GetQueuedAudioSize(id) > 0) && ((SDL_GetTicks() - start) < 5000)) {
+      SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(id, 1);
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+    if (SDL_LoadWAV(outname, &loaded, &wav, &wavlen) == NULL) {
+      SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV('%s') failed: %s", outname, SDL_GetError());
+    } else {
+      SDLTest_AssertCheck(loaded.format == AUDIO_S16LSB && loaded.channels == 6, "Verify WAV format");
+      SDLTest_AssertCheck(wavlen >= samples * 2, "Verify WAV length; expected: >= %u; got: %u", samples * 2, wavlen);
+      mismatches = 0;
+      for (i = 0; i < SDL_min(samples, wavlen / 2); i++) {
+        if (SDL_SwapLE16(((Uint16 *) wav)[i]) != (Uint16) i) {
+          mismatches++;
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify WAV samples; %u samples differ", mismatches);
+      SDL_FreeWAV(wav);
+    }
+  }
+
+  /* Capture from a file, and read the queue in place */
+  rw = SDL_RWFromFile(inname, "wb");
+  SDLTest_AssertCheck(rw != NULL, "Create '%s'", inname);
+  if (rw != NULL) {
+    for (i = 0; i < inlen; i++) {
+      const Uint8 byte = (Uint8) (i * 7);
+      SDL_RWwrite(rw, &byte, 1, 1);
+    }
+    SDL_RWclose(rw);
+  }
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 1;
+  desired.samples = 512;
+  id = SDL_OpenAudioDevice(inname, 1, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', capture)", inname);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+
+  if (id > 1) {
+    len = 1;
+    SDLTest_AssertCheck(SDL_ReserveQueuedAudio(id, &len) == NULL, "Validate SDL_ReserveQueuedAudio() fails on capture devices");
+    SDLTest_AssertCheck(SDL_PeekQueuedAudio(id, &len) == NULL && len == 0, "Validate nothing to peek yet");
+
+    start = SDL_GetTicks();
+    SDL_PauseAudioDevice(id, 0);
+    while ((SDL_GetQueuedAudioSize(id) < inlen) && ((SDL_GetTicks() - start) < 5000)) {
+      SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(id, 1);
+    SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) >= inlen, "Validate captured size; expected: >= %u, got: %u",
+                        inlen, SDL_GetQueuedAudioSize(id));
+
+    written = 0;
+    mismatches = 0;
+    while ((written < inlen) && ((p = (Uint8 *) SDL_PeekQueuedAudio(id, &len)) != NULL)) {
+      len = SDL_min(len, 1000);
+      for (i = 0; i < len && written + i < inlen; i++) {
+        if (p[i] != (Uint8) ((written + i) * 7)) {
+          mismatches++;
+        }
+      }
+      result = (int) SDL_ConsumeQueuedAudio(id, len);
+      SDLTest_AssertCheck(result == (int) len, "Call to SDL_ConsumeQueuedAudio(%u); got: %i", len, result);
+      written += len;
+    }
+    SDLTest_AssertCheck(written >= inlen, "Validate peeked length; expected: >= %u, got: %u", inlen, written);
+    SDLTest_AssertCheck(mismatches == 0, "Verify captured data; %u bytes differ", mismatches);
+    SDL_CloseAudioDevice(id);
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "0", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit(driver);
+  SDLTest_AssertCheck(result == 0, "Restore audio driver '%s'; got: %i", driver, result);
+  SDL_free(driver);
+  remove(outname);
+  remove(inname);
+
+  return TEST_COMPLETED;
+}
+
+#define _AUDIO_LOCKFREE_FRAMES 48000
+
+typedef struct
+{
+  SDL_AudioStream *stream;
+  SDL_atomic_t done;
+} _audioLockFreeData;
+
+/* Producer for audio_lockFreeAudioStream: puts a stereo ramp in uneven chunks. */
+int SDLCALL _audio_lockFreeProducer(void *arg)
+{
+  _audioLockFreeData *data = (_audioLockFreeData *) arg;
+  Sint16 chunk[2 * 700];
+  int frame = 0, failures = 0;
+
+  while (frame < _AUDIO_LOCKFREE_FRAMES) {
+    const int frames = SDL_min(1 + (frame % 697), _AUDIO_LOCKFREE_FRAMES - frame);
+    int i;
+    for (i = 0; i < frames; i++, frame++) {
+      chunk[i * 2] = (Sint16) (frame & 0x7FFF);
+      chunk[i * 2 + 1] = (Sint16) -(frame & 0x7FFF);
+    }
+    if (SDL_AudioStreamPut(data->stream, chunk, frames * 2 * sizeof (Sint16)) < 0) {
+      failures++;
+    }
+  }
+
+  /* keep moving held back audio over until the consumer has it all. */
+  while (!SDL_AtomicGet(&data->done)) {
+    SDL_AudioStreamPut(data->stream, chunk, 0);
+    SDL_Delay(1);
+  }
+
+  return failures;
+}
+
+/**
+ * \brief Puts to and gets from a lock-free audio stream, on one and on two threads.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetLockFree
+ */
+int audio_lockFreeAudioStream()
+{
+  const int inframes = 2000;
+  SDL_AudioStream *stream, *reference;
+  _audioLockFreeData data;
+  SDL_Thread *thread;
+  Sint16 *in;
+  Uint8 *out, *expected;
+  float *f;
+  int i, result, got, total, mismatches, failures, explen;
+  Uint32 start;
+
+  in = (Sint16 *) SDL_malloc(inframes * 2 * sizeof (Sint16));
+  out = (Uint8 *) SDL_malloc(65536);
+  expected = (Uint8 *) SDL_malloc(65536);
+  SDLTest_AssertCheck(in != NULL && out != NULL && expected != NULL, "Validate buffer allocations");
+  if (in == NULL || out == NULL || expected == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < inframes * 2; i++) {
+    in[i] = (Sint16) ((i * 37) - 20000);
+  }
+
+  /* Argument checks */
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 44100);
+  SDLTest_AssertCheck(stream != NULL, "Call to SDL_NewAudioStream()");
+  if (stream == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+  result = SDL_AudioStreamSetLockFree(NULL, 1024);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetLockFree(NULL, 1024); expected: -1, got: %i", result);
+  result = SDL_AudioStreamSetLockFree(stream, 0);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetLockFree(stream, 0); expected: -1, got: %i", result);
+
+  /* Audio converted before the switch is kept. */
+  result = SDL_AudioStreamPut(stream, in, 100 * 2 * sizeof (Sint16));
+  SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamPut(100 frames); got: %i", result);
+  result = SDL_AudioStreamSetLockFree(stream, 1000);
+  SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetLockFree(stream, 1000); expected: 0, got: %i", result);
+  result = SDL_AudioStreamSetLockFree(stream, 1000);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetLockFree() again; expected: -1, got: %i", result);
+  result = SDL_AudioStreamAvailable(stream);
+  SDLTest_AssertCheck(result == 800, "Check available bytes; expected: 800, got: %i", result);
+
+  /* More than fits is held back until the next put. */
+  result = SDL_AudioStreamPut(stream, in + 200, 400 * 2 * sizeof (Sint16));
+  SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamPut(400 frames); got: %i", result);
+  result = SDL_AudioStreamAvailable(stream);
+  SDLTest_AssertCheck(result == 1024, "Check available bytes of a full stream; expected: 1024, got: %i", result);
+  total = 0;
+  while (total < 500 * 8) {
+    got = SDL_AudioStreamGet(stream, out + total, 24 * 8);
+    if (got == 0) {
+      result = SDL_AudioStreamPut(stream, in, 0);
+      SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamPut(0 bytes); got: %i", result);
+      if (SDL_AudioStreamAvailable(stream) == 0) {
+        break;
+      }
+    }
+    total += got;
+  }
+  SDLTest_AssertCheck(total == 500 * 8, "Validate total bytes; expected: %i, got: %i", 500 * 8, total);
+  f = (float *) out;
+  mismatches = 0;
+  for (i = 0; i < total / (int) sizeof (float); i++) {
+    if (f[i] != in[i] / 32768.0f) {
+      mismatches++;
+    }
+  }
+  SDLTest_AssertCheck(mismatches == 0, "Verify converted samples; %i differ", mismatches);
+  SDL_AudioStreamClear(stream);
+  result = SDL_AudioStreamAvailable(stream);
+  SDLTest_AssertCheck(result == 0, "Check available bytes after SDL_AudioStreamClear(); expected: 0, got: %i", result);
+  SDL_FreeAudioStream(stream);
+
+  /* A resampling stream gives the same output with and without lock-free mode. */
+  reference = SDL_NewAudioStream(AUDIO_S16SYS, 2, 22050, AUDIO_S16SYS, 2, 48000);
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 22050, AUDIO_S16SYS, 2, 48000);
+  SDLTest_AssertCheck(reference != NULL && stream != NULL, "Create two resampling streams");
+  if (reference != NULL && stream != NULL) {
+    result = SDL_AudioStreamSetLockFree(stream, 4096);
+    SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetLockFree(stream, 4096); got: %i", result);
+    for (i = 0; i < inframes; i += 250) {
+      SDL_AudioStreamPut(reference, in + i * 2, 250 * 2 * sizeof (Sint16));
+      SDL_AudioStreamPut(stream, in + i * 2, 250 * 2 * sizeof (Sint16));
+    }
+    SDL_AudioStreamFlush(reference);
+    SDL_AudioStreamFlush(stream);
+    explen = SDL_AudioStreamGet(reference, expected, 65536);
+    total = 0;
+    while (total < 65536) {
+      got = SDL_AudioStreamGet(stream, out + total, 65536 - total);
+      if (got == 0) {
+        SDL_AudioStreamPut(stream, in, 0);
+        if (SDL_AudioStreamAvailable(stream) == 0) {
+          break;
+        }
+      }
+      total += got;
+    }
+    SDLTest_AssertCheck(explen > 0 && total == explen, "Validate resampled length; expected: %i, got: %i", explen, total);
+    SDLTest_AssertCheck(SDL_memcmp(out, expected, SDL_min(total, explen)) == 0, "Verify resampled data matches");
+  }
+  SDL_FreeAudioStream(reference);
+  SDL_FreeAudioStream(stream);
+
+  /* One thread puts, this one gets, neither locks. */
+  data.stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 44100);
+  SDLTest_AssertCheck(data.stream != NULL, "Call to SDL_NewAudioStream()");
+  if (data.stream != NULL) {
+    result = SDL_AudioStreamSetLockFree(data.stream, 4096);
+    SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetLockFree(stream, 4096); got: %i", result);
+    SDL_AtomicSet(&data.done, 0);
+    thread = SDL_CreateThread(_audio_lockFreeProducer, "AudioProducer", &data);
+    SDLTest_AssertCheck(thread != NULL, "Call to SDL_CreateThread()");
+    if (thread != NULL) {
+      total = 0;
+      mismatches = 0;
+      start = SDL_GetTicks();
+      while ((total < _AUDIO_LOCKFREE_FRAMES) && !SDL_TICKS_PASSED(SDL_GetTicks(), start + 10000)) {
+        const int want = 1 + (total % 301);
+        got = SDL_AudioStreamGet(data.stream, out, want * 2 * sizeof (float)) / (2 * sizeof (float));
+        f = (float *) out;
+        for (i = 0; i < got; i++, total++) {
+          if ((f[i * 2] != (total & 0x7FFF) / 32768.0f) || (f[i * 2 + 1] != -(total & 0x7FFF) / 32768.0f)) {
+            mismatches++;
+          }
+        }
+      }
+      SDL_AtomicSet(&data.done, 1);
+      SDL_WaitThread(thread, &failures);
+      SDLTest_AssertCheck(failures == 0, "Check producer puts; %i failed", failures);
+      SDLTest_AssertCheck(total == _AUDIO_LOCKFREE_FRAMES, "Validate frames received; expected: %i, got: %i", _AUDIO_LOCKFREE_FRAMES, total);
+      SDLTest_AssertCheck(mismatches == 0, "Verify frames received in order; %i differ", mismatches);
+    }
+    SDL_FreeAudioStream(data.stream);
+  }
+
+  SDL_free(in);
+  SDL_free(out);
+  SDL_free(expected);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check that multi-step channel conversions match the same conversion done one step at a time.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ */
+int audio_remixChannels()
+{
+  /* Each row converts row[0] -> row[n], through every layout in between. */
+  static const int paths[][4] = {
+    { 8, 6, 2, 1 }, { 1, 2, 6, 8 }, { 8, 6, 4, 0 }, { 4, 6, 8, 0 }, { 2, 6, 8, 0 }, { 6, 2, 1, 0 }, { 4, 2, 1, 0 },
+    { 8, 6, 2, 0 }, { 1, 2, 6, 0 }
+  };
+  /* not a multiple of the remixers' block or vector group sizes */
+  const int frames = 301;
+  SDL_AudioCVT cvt;
+  float *fused, *staged;
+  Sint16 *s16;
+  int i, j, n, result, len, worst;
+  float diff, maxdiff;
+
+  fused = (float *) SDL_malloc(frames * 8 * sizeof (float));
+  staged = (float *) SDL_malloc(frames * 8 * sizeof (float));
+  s16 = (Sint16 *) SDL_malloc(frames * 8 * sizeof (Sint16));
+  SDLTest_AssertCheck(fused != NULL && staged != NULL && s16 != NULL, "Validate buffer allocations");
+  if (fused == NULL || staged == NULL || s16 == NULL) {
+    SDL_free(fused);
+    SDL_free(staged);
+    SDL_free(s16);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < SDL_arraysize(paths); i++) {
+    const int src = paths[i][0];
+    int dst = src;
+
+    for (j = 0; j < frames * src; j++) {
+      fused[j] = staged[j] = (float) ((j * 7919) % 2001 - 1000) / 1250.0f;
+    }
+
+    len = frames * src * sizeof (float);
+    for (n = 1; (n < 4) && paths[i][n]; n++) {
+      dst = paths[i][n];
+      result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, paths[i][n - 1], 48000, AUDIO_F32SYS, dst, 48000);
+      SDLTest_AssertCheck(result == 1, "Call to SDL_BuildAudioCVT(%d -> %d channels), expected 1, got %i", paths[i][n - 1], dst, result);
+      cvt.buf = (Uint8 *) staged;
+      cvt.len = len;
+      result = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(result == 0, "Call to SDL_ConvertAudio(), expected 0, got %i", result);
+      len = cvt.len_cvt;
+    }
+
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, src, 48000, AUDIO_F32SYS, dst, 48000);
+    SDLTest_AssertCheck(result == 1, "Call to SDL_BuildAudioCVT(%d -> %d channels), expected 1, got %i", src, dst, result);
+    cvt.buf = (Uint8 *) fused;
+    cvt.len = frames * src * sizeof (float);
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertCheck(result == 0, "Call to SDL_ConvertAudio(), expected 0, got %i", result);
+    SDLTest_AssertCheck(cvt.len_cvt == len, "Verify converted length; expected %i, got %i", len, cvt.len_cvt);
+
+    maxdiff = 0.0f;
+    for (j = 0; j < frames * dst; j++) {
+      diff = SDL_fabs(fused[j] - staged[j]);
+      maxdiff = SDL_max(maxdiff, diff);
+    }
+    SDLTest_AssertCheck(maxdiff < 0.00001f, "Verify %d -> %d channels matches the staged conversion; max difference %f", src, dst, maxdiff);
+  }
+
+  /* The single-step float downmixes, checked against their formulas rather than each other. */
+  for (i = 0; i < 3; i++) {
+    static const int downmixes[3][2] = { { 8, 6 }, { 6, 4 }, { 6, 2 } };
+    const int src = downmixes[i][0];
+    const int dst = downmixes[i][1];
+    float expected;
+
+    for (j = 0; j < frames * src; j++) {
+      fused[j] = staged[j] = (float) ((j * 7919) % 2001 - 1000) / 1250.0f;
+    }
+
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, src, 48000, AUDIO_F32SYS, dst, 48000);
+    SDLTest_AssertCheck(result == 1, "Call to SDL_BuildAudioCVT(%d -> %d channels), expected 1, got %i", src, dst, result);
+    cvt.buf = (Uint8 *) fused;
+    cvt.len = frames * src * sizeof (float);
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertCheck(result == 0, "Call to SDL_ConvertAudio(), expected 0, got %i", result);
+    SDLTest_AssertCheck(cvt.len_cvt == frames * dst * (int) sizeof (float), "Verify converted length; expected %i, got %i", frames * dst * (int) sizeof (float), cvt.len_cvt);
+
+    maxdiff = 0.0f;
+    for (j = 0; j < frames * dst; j++) {
+      const float *in = staged + (j / dst) * src;
+      const int c = j % dst;
+      if (src == 8) {  /* surround sides split over front and back */
+        expected = (in[c] + ((c == 0 || c == 4) ? in[6] * 0.5f : (c == 1 || c == 5) ? in[7] * 0.5f : 0.0f)) / 1.5f;
+      } else if (dst == 4) {  /* front center split over front left and right */
+        expected = (c < 2) ? (in[c] + in[2] * 0.5f) / 1.5f : in[c + 2] / 1.5f;
+      } else {
+        expected = (in[c] + in[2] * 0.5f + in[c + 4]) / 2.5f;
+      }
+      diff = SDL_fabs(fused[j] - expected);
+      maxdiff = SDL_max(maxdiff, diff);
+    }
+    SDLTest_AssertCheck(maxdiff < 0.00001f, "Verify %d -> %d channels matches the downmix formula; max difference %f", src, dst, maxdiff);
+  }
+
+  /* Integer 7.1 -> stereo goes through a single pass; front center ends up at 0.5 / 1.5 / 5. */
+  result = SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 8, 48000, AUDIO_S16SYS, 2, 48000);
+  SDLTest_AssertCheck(result == 1, "Call to SDL_BuildAudioCVT(S16 7.1 -> stereo), expected 1, got %i", result);
+  SDLTest_AssertCheck(cvt.filters[0] != NULL && cvt.filters[1] == NULL, "Verify the conversion uses a single filter");
+  SDL_memset(s16, 0, frames * 8 * sizeof (Sint16));
+  for (j = 0; j < frames; j++) {
+    s16[j * 8 + 2] = 16384;
+  }
+  cvt.buf = (Uint8 *) s16;
+  cvt.len = frames * 8 * sizeof (Sint16);
+  result = SDL_ConvertAudio(&cvt);
+  SDLTest_AssertCheck(result == 0, "Call to SDL_ConvertAudio(), expected 0, got %i", result);
+  SDLTest_AssertCheck(cvt.len_cvt == frames * 2 * (int) sizeof (Sint16), "Verify converted length; expected %i, got %i", frames * 2 * (int) sizeof (Sint16), cvt.len_cvt);
+  worst = 0;
+  for (j = 0; j < frames * 2; j++) {
+    worst = SDL_max(worst, SDL_abs(s16[j] - 2185));
+  }
+  SDLTest_AssertCheck(worst <= 1, "Verify front center lands at 1/15 on both sides; worst error %i", worst);
+
+  SDL_free(fused);
+  SDL_free(staged);
+  SDL_free(s16);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Change the rate ratio of an audio stream while putting data into it.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetRateRatio
+ */
+int audio_rateRatioAudioStream()
+{
+  const int rate = 48000;
+  const int chunk = 480;
+  const int total = 48000;
+  SDL_AudioStream *stream;
+  float *in, *out;
+  Sint16 *s16;
+  int i, result, got, frames, expected;
+  float diff, maxdiff, maxstep;
+
+  in = (float *) SDL_malloc(total * sizeof (float));
+  out = (float *) SDL_malloc(total * 2 * sizeof (float));
+  s16 = (Sint16 *) SDL_malloc(total * sizeof (Sint16));
+  SDLTest_AssertCheck(in != NULL && out != NULL && s16 != NULL, "Validate buffer allocations");
+  if (in == NULL || out == NULL || s16 == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    SDL_free(s16);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < total; i++) {
+    in[i] = 0.5f * (float) SDL_sin(2.0 * M_PI * 440.0 * i / rate);
+    s16[i] = (Sint16) (in[i] * 32767.0f);
+  }
+
+  /* Argument checks */
+  result = SDL_AudioStreamSetRateRatio(NULL, 1.0);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetRateRatio(NULL, 1.0); expected: -1, got: %i", result);
+  stream = SDL_NewAudioStream(AUDIO_F32SYS, 1, rate, AUDIO_F32SYS, 1, rate);
+  SDLTest_AssertCheck(stream != NULL, "Call to SDL_NewAudioStream()");
+  if (stream == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    SDL_free(s16);
+    return TEST_ABORTED;
+  }
+  result = SDL_AudioStreamSetRateRatio(stream, 0.0);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetRateRatio(stream, 0.0); expected: -1, got: %i", result);
+  result = SDL_AudioStreamSetRateRatio(stream, 5.0);
+  SDLTest_AssertCheck(result == -1, "Call to SDL_AudioStreamSetRateRatio(stream, 5.0); expected: -1, got: %i", result);
+
+  /* At 1.0, an equal-rate stream that resamples still hands back its input. */
+  result = SDL_AudioStreamSetRateRatio(stream, 1.0);
+  SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetRateRatio(stream, 1.0); expected: 0, got: %i", result);
+  for (i = 0; i < total; i += chunk) {
+    SDL_AudioStreamPut(stream, in + i, chunk * sizeof (float));
+  }
+  SDL_AudioStreamFlush(stream);
+  got = SDL_AudioStreamGet(stream, out, total * 2 * sizeof (float));
+  frames = got / (int) sizeof (float);
+  SDLTest_AssertCheck(SDL_abs(frames - total) <= 1, "Verify output length; expected: %i, got: %i frames", total, frames);
+  maxdiff = 0.0f;
+  for (i = 0; i < SDL_min(frames, total); i++) {
+    diff = SDL_fabs(out[i] - in[i]);
+    maxdiff = SDL_max(maxdiff, diff);
+  }
+  SDLTest_AssertCheck(maxdiff < 0.0001f, "Verify output matches input; max difference %f", maxdiff);
+
+  /* Speed up halfway through: less output, and no jump where it changes. */
+  SDL_AudioStreamClear(stream);
+  SDL_AudioStreamSetRateRatio(stream, 1.0);
+  for (i = 0; i < total; i += chunk) {
+    if (i == total / 2) {
+      result = SDL_AudioStreamSetRateRatio(stream, 1.01);
+      SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetRateRatio(stream, 1.01); expected: 0, got: %i", result);
+    }
+    SDL_AudioStreamPut(stream, in + i, chunk * sizeof (float));
+  }
+  SDL_AudioStreamFlush(stream);
+  got = SDL_AudioStreamGet(stream, out, total * 2 * sizeof (float));
+  frames = got / (int) sizeof (float);
+  /* input the stream was still holding back when the ratio changed gets sped up too. */
+  expected = (total / 2) + (int) ((total / 2) / 1.01);
+  SDLTest_AssertCheck(SDL_abs(frames - expected) <= 12, "Verify output length; expected: %i, got: %i frames", expected, frames);
+  maxstep = 0.0f;
+  for (i = 1; i < frames - chunk; i++) {  /* the sine is cut off at the end. */
+    diff = SDL_fabs(out[i] - out[i - 1]);
+    maxstep = SDL_max(maxstep, diff);
+  }
+  /* a 440Hz sine at 0.5 never moves more than 0.5 * 2 * pi * 440 / 48000 between frames, about 0.029. */
+  SDLTest_AssertCheck(maxstep < 0.032f, "Verify output has no discontinuities; largest step %f", maxstep);
+  SDL_FreeAudioStream(stream);
+
+  /* A stream that already resamples follows the ratio too. */
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 1, 44100, AUDIO_F32SYS, 1, rate);
+  SDLTest_AssertCheck(stream != NULL, "Call to SDL_NewAudioStream()");
+  if (stream != NULL) {
+    result = SDL_AudioStreamSetRateRatio(stream, 0.99);
+    SDLTest_AssertCheck(result == 0, "Call to SDL_AudioStreamSetRateRatio(stream, 0.99); expected: 0, got: %i", result);
+    for (i = 0; i < total; i += chunk) {
+      SDL_AudioStreamPut(stream, s16 + i, chunk * sizeof (Sint16));
+    }
+    SDL_AudioStreamFlush(stream);
+    got = SDL_AudioStreamGet(stream, out, total * 2 * sizeof (float));
+    frames = got / (int) sizeof (float);
+    expected = (int) ((total * (double) rate / 44100.0) / 0.99);
+    SDLTest_AssertCheck(SDL_abs(frames - expected) <= 8, "Verify output length; expected: %i, got: %i frames", expected, frames);
+    SDL_FreeAudioStream(stream);
+  }
+
+  SDL_free(in);
+  SDL_free(out);
+  SDL_free(s16);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Captures with the disk driver into a stream from SDL_NewCaptureAudioStream().
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewCaptureAudioStream
+ */
+int audio_captureAudioStream()
+{
+  const char *filename = "sdlaudio-capture.raw";
+  const int frames = 44100;
+  const int ringlen = 1024 * 1024;
+  SDL_AudioSpec desired;
+  SDL_AudioDeviceStats stats;
+  SDL_AudioDeviceID id;
+  SDL_AudioStream *stream;
+  SDL_RWops *rw;
+  Sint16 *in;
+  float *out;
+  char *driver;
+  int i, result, got, mismatches;
+  Uint32 start;
+
+  in = (Sint16 *) SDL_malloc(frames * 2 * sizeof (Sint16));
+  out = (float *) SDL_malloc(ringlen);
+  SDLTest_AssertCheck(in != NULL && out != NULL, "Validate buffer allocations");
+  if (in == NULL || out == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    return TEST_ABORTED;
+  }
+
+  /* one second of a stereo ramp, little endian like the disk driver reads it. */
+  for (i = 0; i < frames * 2; i++) {
+    in[i] = (Sint16) SDL_SwapLE16((Uint16) (Sint16) ((i * 13) - 30000));
+  }
+  rw = SDL_RWFromFile(filename, "wb");
+  SDLTest_AssertCheck(rw != NULL, "Call to SDL_RWFromFile('%s', 'wb')", filename);
+  if (rw == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    return TEST_ABORTED;
+  }
+  SDL_RWwrite(rw, in, sizeof (Sint16), frames * 2);
+  SDL_RWclose(rw);
+  for (i = 0; i < frames * 2; i++) {
+    in[i] = (Sint16) SDL_SwapLE16((Uint16) in[i]);
+  }
+
+  driver = SDL_strdup(SDL_GetCurrentAudioDriver() ? SDL_GetCurrentAudioDriver() : "dummy");
+  SDLTest_AssertCheck(driver != NULL, "Check SDL_strdup result");
+  if (driver == NULL) {
+    SDL_free(in);
+    SDL_free(out);
+    return TEST_ABORTED;
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "1", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 2;
+  desired.samples = 512;
+  id = (result == 0) ? SDL_OpenAudioDevice(filename, 1, &desired, NULL, 0) : 0;
+  SDLTest_AssertCheck(id > 1, "Validate capture device ID; expected: >1, got: %i", id);
+
+  if (id > 1) {
+    stream = SDL_NewCaptureAudioStream(id, AUDIO_F32SYS, 2, 44100, 0);
+    SDLTest_AssertCheck(stream == NULL, "Call to SDL_NewCaptureAudioStream() with len 0; expected: NULL");
+    stream = SDL_NewCaptureAudioStream(id, AUDIO_F32SYS, 2, 44100, ringlen);
+    SDLTest_AssertCheck(stream != NULL, "Call to SDL_NewCaptureAudioStream()");
+
+    if (stream != NULL) {
+      /* freerun reads the whole file at once, then keeps capturing silence until the stream is full. */
+      SDL_GetAudioDeviceStats(id, &stats, SDL_TRUE);
+      SDL_PauseAudioDevice(id, 0);
+      start = SDL_GetTicks();
+      do {
+        SDL_Delay(10);
+        SDL_GetAudioDeviceStats(id, &stats, SDL_FALSE);
+      } while ((stats.overruns == 0) && ((SDL_GetTicks() - start) < 10000));
+      SDL_PauseAudioDevice(id, 1);
+
+      SDLTest_AssertCheck(stats.overruns > 0, "Verify overflow is reported; got %u overruns", (unsigned int) stats.overruns);
+      SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Verify nothing was queued for SDL_DequeueAudio()");
+      got = SDL_AudioStreamAvailable(stream);
+      SDLTest_AssertCheck(got <= ringlen, "Verify the stream holds at most %i bytes; got %i", ringlen, got);
+
+      got = SDL_AudioStreamGet(stream, out, ringlen);
+      SDLTest_AssertCheck(got >= frames * 2 * (int) sizeof (float), "Verify captured length; expected: >= %i, got: %i", frames * 2 * (int) sizeof (float), got);
+      mismatches = 0;
+      for (i = 0; i < SDL_min(got / (int) sizeof (float), frames * 2); i++) {
+        if (SDL_fabs(out[i] - (in[i] / 32768.0f)) > 0.00001f) {
+          mismatches++;
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify captured samples; %i differ", mismatches);
+
+      SDL_UnbindAudioStream(id, stream);
+      SDL_FreeAudioStream(stream);
+    }
+    SDL_CloseAudioDevice(id);
+  }
+
+  /* only capture devices take these streams */
+  id = SDL_OpenAudioDevice("sdlaudio-capture-out.raw", 0, &desired, NULL, 0);
+  if (id > 1) {
+    stream = SDL_NewCaptureAudioStream(id, AUDIO_F32SYS, 2, 44100, ringlen);
+    SDLTest_AssertCheck(stream == NULL, "Call to SDL_NewCaptureAudioStream() on a playback device; expected: NULL");
+    SDL_CloseAudioDevice(id);
+  }
+
+  SDL_setenv("SDL_DISKAUDIOFREERUN", "0", 1);
+  SDL_AudioQuit();
+  result = SDL_AudioInit(driver);
+  SDLTest_AssertCheck(result == 0, "Restore audio driver '%s'; got: %i", driver, result);
+  SDL_free(driver);
+  SDL_free(in);
+  SDL_free(out);
+  remove(filename);
+  remove("sdlaudio-capture-out.raw");
+
+  return TEST_COMPLETED;
+}
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +2684,48 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleLoss, "audio_resampleLoss", "Check resampling quality for several rates and channel counts.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_bindAudioStreams, "audio_bindAudioStreams", "Mix several bound streams into a device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Check SDL_MixAudioFormat output bit for bit.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_diskFreerunWav, "audio_diskFreerunWav", "Render to a WAV file faster than realtime with the disk driver.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_getAudioDeviceStats, "audio_getAudioDeviceStats", "Check audio device statistics with queued audio and a slow callback.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest21 =
+        { (SDLTest_TestCaseFp)audio_wavDecoder, "audio_wavDecoder", "Decode WAVE files incrementally, seek and feed an audio stream.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest22 =
+        { (SDLTest_TestCaseFp)audio_reserveAndPeekQueuedAudio, "audio_reserveAndPeekQueuedAudio", "Queue audio without copies, and read captured audio in place.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest23 =
+        { (SDLTest_TestCaseFp)audio_lockFreeAudioStream, "audio_lockFreeAudioStream", "Put and get audio stream data from two threads without locking.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest24 =
+        { (SDLTest_TestCaseFp)audio_remixChannels, "audio_remixChannels", "Check multi-step channel conversions against staged ones.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest25 =
+        { (SDLTest_TestCaseFp)audio_rateRatioAudioStream, "audio_rateRatioAudioStream", "Change the rate ratio of an audio stream while putting data into it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest26 =
+        { (SDLTest_TestCaseFp)audio_captureAudioStream, "audio_captureAudioStream", "Capture with the disk driver straight into an audio stream.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest27 =
+        { (SDLTest_TestCaseFp)audio_resampleFilter, "audio_resampleFilter", "Check resampled output against the resampling filter in double precision.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17,
+    &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24, &audioTest25, &audioTest26, &audioTest27, NULL
 };
 
 /* Audio test suite (global) */
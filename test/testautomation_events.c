@@ -175,6 +175,88 @@ events_addDelEventWatchWithUserdata(void *arg)
 }
 
 
+/* Number of threads and events per thread for the threaded push test */
+#define _EVENTS_PUSH_THREADS 4
+#define _EVENTS_PER_THREAD 1000
+
+/* Thread that pushes numbered user events, tagged with its index in code */
+int SDLCALL _events_pushThread(void *data)
+{
+   SDL_Event event;
+   int i;
+
+   for (i = 0; i < _EVENTS_PER_THREAD; i++) {
+      SDL_zero(event);
+      event.type = SDL_USEREVENT;
+      event.user.code = (Sint32)(intptr_t)data;
+      event.user.data1 = (void *)(intptr_t)i;
+      if (SDL_PushEvent(&event) != 1) {
+         return -1;
+      }
+   }
+   return 0;
+}
+
+/**
+ * @brief Pushes events from several threads and checks they come back in order, and the queue statistics.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PeepEvents
+ */
+int
+events_pushFromThreads(void *arg)
+{
+   SDL_Thread *threads[_EVENTS_PUSH_THREADS];
+   int next[_EVENTS_PUSH_THREADS];
+   SDL_EventQueueStats stats;
+   SDL_Event event;
+   int i, result, total = 0, ordered = 1;
+
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDLTest_AssertPass("Call to SDL_FlushEvents()");
+   SDL_ResetEventQueueStats();
+   SDLTest_AssertPass("Call to SDL_ResetEventQueueStats()");
+
+   for (i = 0; i < _EVENTS_PUSH_THREADS; i++) {
+      next[i] = 0;
+      threads[i] = SDL_CreateThread(_events_pushThread, "EventPusher", (void *)(intptr_t)i);
+      SDLTest_AssertCheck(threads[i] != NULL, "Check thread %d was created", i);
+   }
+   for (i = 0; i < _EVENTS_PUSH_THREADS; i++) {
+      if (threads[i]) {
+         SDL_WaitThread(threads[i], &result);
+         SDLTest_AssertCheck(result == 0, "Check thread %d pushed all its events, got: %d", i, result);
+      }
+   }
+
+   SDL_GetEventQueueStats(&stats);
+   SDLTest_AssertPass("Call to SDL_GetEventQueueStats()");
+   SDLTest_AssertCheck(stats.num_events >= _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, "Check queued events, expected: >=%d, got: %d", _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, stats.num_events);
+   SDLTest_AssertCheck(stats.max_events_seen >= stats.num_events, "Check high-water mark, expected: >=%d, got: %d", stats.num_events, stats.max_events_seen);
+   SDLTest_AssertCheck(stats.locked_pushes > 0, "Check some events overflowed into the locked queue, got: %u", (unsigned int)stats.locked_pushes);
+
+   /* A filtered peek has to see events from both halves of the queue */
+   result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+   SDLTest_AssertCheck(result == _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, "Check peeked user events, expected: %d, got: %d", _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, result);
+
+   while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1) {
+      if (event.type == SDL_USEREVENT && event.user.code >= 0 && event.user.code < _EVENTS_PUSH_THREADS) {
+         if ((int)(intptr_t)event.user.data1 != next[event.user.code]++) {
+            ordered = 0;
+         }
+         total++;
+      }
+   }
+   SDLTest_AssertCheck(total == _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, "Check received user events, expected: %d, got: %d", _EVENTS_PUSH_THREADS * _EVENTS_PER_THREAD, total);
+   SDLTest_AssertCheck(ordered, "Check each thread's events arrived in the order they were pushed");
+
+   SDL_GetEventQueueStats(&stats);
+   SDLTest_AssertCheck(stats.num_events == 0, "Check queue is empty, expected: 0, got: %d", stats.num_events);
+
+   return TEST_COMPLETED;
+}
+
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -187,9 +269,12 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_pushFromThreads, "events_pushFromThreads", "Pushes events from several threads and checks order and queue statistics", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, NULL
 };
 
 /* Events test suite (global) */
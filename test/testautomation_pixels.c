@@ -500,6 +500,338 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Check that YUV conversions split across threads match the serial conversion
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_ConvertPixels
+ */
+int
+pixels_convertYUVThreads(void *arg)
+{
+  const Uint32 yuvFormats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  const Uint32 rgbFormats[] = {
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24
+  };
+  const int width = 321;
+  const int height = 243;
+  const int yuvPitch = 4 * ((width + 1) / 2);
+  const int rgbPitch = 4 * width;
+  const size_t yuvSize = (size_t)yuvPitch * (height + 1) * 2;
+  const size_t rgbSize = (size_t)rgbPitch * height;
+  Uint8 *yuv, *rgb, *serial, *threaded;
+  char *oldThreshold;
+  size_t i, j, k;
+  int result;
+
+  yuv = (Uint8 *)SDL_malloc(yuvSize);
+  rgb = (Uint8 *)SDL_malloc(rgbSize);
+  serial = (Uint8 *)SDL_malloc(SDL_max(yuvSize, rgbSize));
+  threaded = (Uint8 *)SDL_malloc(SDL_max(yuvSize, rgbSize));
+  SDLTest_AssertCheck(yuv != NULL && rgb != NULL && serial != NULL && threaded != NULL, "Validate that the buffers could be allocated");
+  if (yuv == NULL || rgb == NULL || serial == NULL || threaded == NULL) {
+    SDL_free(yuv);
+    SDL_free(rgb);
+    SDL_free(serial);
+    SDL_free(threaded);
+    return TEST_ABORTED;
+  }
+
+  oldThreshold = SDL_GetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD) ? SDL_strdup(SDL_GetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD)) : NULL;
+
+  /* Keep the samples away from the extremes the fixed point converters clamp */
+  for (k = 0; k < yuvSize; k++) {
+    yuv[k] = (Uint8)SDLTest_RandomIntegerInRange(64, 191);
+  }
+
+  for (i = 0; i < SDL_arraysize(yuvFormats); i++) {
+    for (j = 0; j < SDL_arraysize(rgbFormats); j++) {
+      /* YUV to RGB */
+      SDL_memset(serial, 0, rgbSize);
+      SDL_memset(threaded, 0, rgbSize);
+      SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD, "0");
+      result = SDL_ConvertPixels(width, height, yuvFormats[i], yuv, yuvPitch, rgbFormats[j], serial, rgbPitch);
+      SDLTest_AssertCheck(result == 0, "Validate serial conversion result, expected: 0, got: %i", result);
+      SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD, "1");
+      result = SDL_ConvertPixels(width, height, yuvFormats[i], yuv, yuvPitch, rgbFormats[j], threaded, rgbPitch);
+      SDLTest_AssertCheck(result == 0, "Validate threaded conversion result, expected: 0, got: %i", result);
+      SDLTest_AssertCheck(SDL_memcmp(serial, threaded, rgbSize) == 0, "Validate %s to %s output matches the serial conversion",
+        SDL_GetPixelFormatName(yuvFormats[i]), SDL_GetPixelFormatName(rgbFormats[j]));
+    }
+
+    /* RGB to YUV, from the ARGB8888 image we just made */
+    SDL_ConvertPixels(width, height, yuvFormats[i], yuv, yuvPitch, SDL_PIXELFORMAT_ARGB8888, rgb, rgbPitch);
+    SDL_memset(serial, 0, yuvSize);
+    SDL_memset(threaded, 0, yuvSize);
+    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD, "0");
+    result = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, rgb, rgbPitch, yuvFormats[i], serial, yuvPitch);
+    SDLTest_AssertCheck(result == 0, "Validate serial conversion result, expected: 0, got: %i", result);
+    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD, "1");
+    result = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, rgb, rgbPitch, yuvFormats[i], threaded, yuvPitch);
+    SDLTest_AssertCheck(result == 0, "Validate threaded conversion result, expected: 0, got: %i", result);
+    SDLTest_AssertCheck(SDL_memcmp(serial, threaded, yuvSize) == 0, "Validate ARGB8888 to %s output matches the serial conversion",
+      SDL_GetPixelFormatName(yuvFormats[i]));
+  }
+
+  if (oldThreshold != NULL) {
+    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS_THRESHOLD, oldThreshold);
+    SDL_free(oldThreshold);
+  }
+  SDL_free(yuv);
+  SDL_free(rgb);
+  SDL_free(serial);
+  SDL_free(threaded);
+
+  return TEST_COMPLETED;
+}
+
+/* The YUV to RGB factors of the fixed point converters in src/video/yuv2rgb
+   and the RGB to YUV factors of SDL_yuv.c, indexed by SDL_YUV_CONVERSION_MODE */
+#define _YUV_FIXED(value) (Sint16)((value * 64) + 0.5)
+
+static const struct { int yShift; Sint16 y, vr, ug, vg, ub; } _yuvToRGBFactors[] = {
+  { 0, _YUV_FIXED(1.0), _YUV_FIXED(1.402), -_YUV_FIXED(0.3441), -_YUV_FIXED(0.7141), _YUV_FIXED(1.772) },
+  { 16, _YUV_FIXED(1.1644), _YUV_FIXED(1.596), -_YUV_FIXED(0.3918), -_YUV_FIXED(0.813), _YUV_FIXED(2.0172) },
+  { 16, _YUV_FIXED(1.1644), _YUV_FIXED(1.7927), -_YUV_FIXED(0.2132), -_YUV_FIXED(0.5329), _YUV_FIXED(2.1124) }
+};
+
+static const struct { int yOffset; float y[3], u[3], v[3]; } _rgbToYUVFactors[] = {
+  { 0, { 0.2990f, 0.5870f, 0.1140f }, { -0.1687f, -0.3313f, 0.5000f }, { 0.5000f, -0.4187f, -0.0813f } },
+  { 16, { 0.2568f, 0.5041f, 0.0979f }, { -0.1482f, -0.2910f, 0.4392f }, { 0.4392f, -0.3678f, -0.0714f } },
+  { 16, { 0.1826f, 0.6142f, 0.0620f }, { -0.1006f, -0.3386f, 0.4392f }, { 0.4392f, -0.3989f, -0.0403f } }
+};
+
+#define _YUV_DOT(f, offset, r, g, b) (Uint8)((int)(f[0] * (r) + f[1] * (g) + f[2] * (b) + 0.5f) + (offset))
+
+/* Fixed point to 8 bits, like the lookup table of the scalar converters */
+static Uint8
+_yuvClamp(int value)
+{
+  value = ((value + 128 * 64) >> 6) - 128;
+  return (Uint8)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+/* Lays out a plane of Y samples and planes of U and V samples, one per two
+   pixels of a row, the way SDL_ConvertPixels() reads them. Planar formats
+   have a pitch of w, packed ones 4 * ((w + 1) / 2). */
+static void
+_packYUV(Uint32 format, int w, int h, const Uint8 *ys, const Uint8 *us, const Uint8 *vs, Uint8 *yuv)
+{
+  const int cw = (w + 1) / 2;
+  const int ch = (h + 1) / 2;
+  int x, y;
+
+  switch (format) {
+  case SDL_PIXELFORMAT_YV12:
+  case SDL_PIXELFORMAT_IYUV:
+    SDL_memcpy(yuv, ys, w * h);
+    SDL_memcpy(yuv + w * h, format == SDL_PIXELFORMAT_YV12 ? vs : us, cw * ch);
+    SDL_memcpy(yuv + w * h + cw * ch, format == SDL_PIXELFORMAT_YV12 ? us : vs, cw * ch);
+    break;
+  case SDL_PIXELFORMAT_NV12:
+  case SDL_PIXELFORMAT_NV21:
+    SDL_memcpy(yuv, ys, w * h);
+    for (x = 0; x < cw * ch; x++) {
+      yuv[w * h + 2 * x] = format == SDL_PIXELFORMAT_NV12 ? us[x] : vs[x];
+      yuv[w * h + 2 * x + 1] = format == SDL_PIXELFORMAT_NV12 ? vs[x] : us[x];
+    }
+    break;
+  default:
+    for (y = 0; y < h; y++) {
+      for (x = 0; x < cw; x++) {
+        const Uint8 y0 = ys[y * w + 2 * x];
+        const Uint8 y1 = (2 * x + 1 < w) ? ys[y * w + 2 * x + 1] : y0;
+        const Uint8 u = us[y * cw + x], v = vs[y * cw + x];
+        Uint8 *p = yuv + y * 4 * cw + 4 * x;
+        if (format == SDL_PIXELFORMAT_YUY2) {
+          p[0] = y0; p[1] = u; p[2] = y1; p[3] = v;
+        } else if (format == SDL_PIXELFORMAT_UYVY) {
+          p[0] = u; p[1] = y0; p[2] = v; p[3] = y1;
+        } else {
+          p[0] = y0; p[1] = v; p[2] = y1; p[3] = u;
+        }
+      }
+    }
+    break;
+  }
+}
+
+/**
+ * @brief Check that the SIMD YUV conversion kernels match the scalar conversion
+ *
+ * Converts frames with odd sizes, so that the vectorized part of each row and
+ * the scalar tail are both used, and compares every byte against a reference
+ * that follows the scalar code of SDL_yuv.c and src/video/yuv2rgb.
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_ConvertPixels
+ */
+int
+pixels_convertYUVKernels(void *arg)
+{
+  const Uint32 yuvFormats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  const Uint32 rgbFormats[] = {
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB565
+  };
+  const SDL_YUV_CONVERSION_MODE modes[] = {
+    SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+  };
+  const SDL_YUV_CONVERSION_MODE oldMode = SDL_GetYUVConversionMode();
+  const int width = 97;
+  const int height = 37;
+  const int cw = (width + 1) / 2;
+  const size_t yuvSize = (size_t)4 * cw * height;
+  const size_t rgbSize = (size_t)4 * width * height;
+  Uint8 *ys, *us, *vs, *argb, *yuv, *actual, *expected;
+  size_t i, j, m;
+  int x, y, result;
+
+  ys = (Uint8 *)SDL_malloc(width * height);
+  us = (Uint8 *)SDL_malloc(cw * height);
+  vs = (Uint8 *)SDL_malloc(cw * height);
+  argb = (Uint8 *)SDL_malloc(rgbSize);
+  yuv = (Uint8 *)SDL_malloc(yuvSize);
+  actual = (Uint8 *)SDL_malloc(SDL_max(yuvSize, rgbSize));
+  expected = (Uint8 *)SDL_malloc(SDL_max(yuvSize, rgbSize));
+  SDLTest_AssertCheck(ys != NULL && us != NULL && vs != NULL && argb != NULL && yuv != NULL && actual != NULL && expected != NULL,
+    "Validate that the buffers could be allocated");
+  if (ys == NULL || us == NULL || vs == NULL || argb == NULL || yuv == NULL || actual == NULL || expected == NULL) {
+    SDL_free(ys);
+    SDL_free(us);
+    SDL_free(vs);
+    SDL_free(argb);
+    SDL_free(yuv);
+    SDL_free(actual);
+    SDL_free(expected);
+    return TEST_ABORTED;
+  }
+
+  /* Keep the samples within the range the lookup table clamp of the scalar
+     converters handles, which also keeps the 16 bit SIMD math from overflowing */
+  for (i = 0; i < (size_t)(width * height); i++) {
+    ys[i] = (Uint8)SDLTest_RandomIntegerInRange(64, 191);
+  }
+  for (i = 0; i < (size_t)(cw * height); i++) {
+    us[i] = (Uint8)SDLTest_RandomIntegerInRange(64, 191);
+    vs[i] = (Uint8)SDLTest_RandomIntegerInRange(64, 191);
+  }
+  for (i = 0; i < rgbSize; i++) {
+    argb[i] = SDLTest_RandomUint8();
+  }
+
+  for (m = 0; m < SDL_arraysize(modes); m++) {
+    SDL_SetYUVConversionMode(modes[m]);
+
+    for (i = 0; i < SDL_arraysize(yuvFormats); i++) {
+      const SDL_bool planar = (yuvFormats[i] == SDL_PIXELFORMAT_YV12 || yuvFormats[i] == SDL_PIXELFORMAT_IYUV ||
+                               yuvFormats[i] == SDL_PIXELFORMAT_NV12 || yuvFormats[i] == SDL_PIXELFORMAT_NV21);
+      const int yuvPitch = planar ? width : 4 * cw;
+
+      _packYUV(yuvFormats[i], width, height, ys, us, vs, yuv);
+
+      /* YUV to RGB */
+      for (j = 0; j < SDL_arraysize(rgbFormats); j++) {
+        SDL_PixelFormat *format = SDL_AllocFormat(rgbFormats[j]);
+        const int bpp = SDL_BYTESPERPIXEL(rgbFormats[j]);
+        SDLTest_AssertCheck(format != NULL, "Validate result from SDL_AllocFormat(%s)", SDL_GetPixelFormatName(rgbFormats[j]));
+        if (format == NULL) {
+          continue;
+        }
+
+        for (y = 0; y < height; y++) {
+          for (x = 0; x < width; x++) {
+            const int c = (planar ? y / 2 : y) * cw + x / 2;
+            const int yTmp = (ys[y * width + x] - _yuvToRGBFactors[m].yShift) * _yuvToRGBFactors[m].y;
+            const int uTmp = us[c] - 128, vTmp = vs[c] - 128;
+            const Uint32 pixel = SDL_MapRGB(format,
+              _yuvClamp(yTmp + vTmp * _yuvToRGBFactors[m].vr),
+              _yuvClamp(yTmp + uTmp * _yuvToRGBFactors[m].ug + vTmp * _yuvToRGBFactors[m].vg),
+              _yuvClamp(yTmp + uTmp * _yuvToRGBFactors[m].ub));
+            if (bpp == 4) {
+              ((Uint32 *)expected)[y * width + x] = pixel;
+            } else {
+              ((Uint16 *)expected)[y * width + x] = (Uint16)pixel;
+            }
+          }
+        }
+        SDL_FreeFormat(format);
+
+        SDL_memset(actual, 0, width * height * bpp);
+        result = SDL_ConvertPixels(width, height, yuvFormats[i], yuv, yuvPitch, rgbFormats[j], actual, width * bpp);
+        SDLTest_AssertCheck(result == 0, "Validate conversion result, expected: 0, got: %i", result);
+        SDLTest_AssertCheck(SDL_memcmp(actual, expected, width * height * bpp) == 0, "Validate %s to %s output matches the scalar conversion, mode %i",
+          SDL_GetPixelFormatName(yuvFormats[i]), SDL_GetPixelFormatName(rgbFormats[j]), (int)modes[m]);
+      }
+
+      /* RGB to YUV, which has SIMD rows for the planar formats */
+      if (planar) {
+        const float *fy = _rgbToYUVFactors[m].y, *fu = _rgbToYUVFactors[m].u, *fv = _rgbToYUVFactors[m].v;
+        const int ch = (height + 1) / 2;
+        Uint8 *py, *pu, *pv;
+
+        py = (Uint8 *)SDL_malloc(width * height + 2 * cw * ch);
+        SDLTest_AssertCheck(py != NULL, "Validate that the reference planes could be allocated");
+        if (py == NULL) {
+          continue;
+        }
+        pu = py + width * height;
+        pv = pu + cw * ch;
+
+        for (y = 0; y < height; y++) {
+          for (x = 0; x < width; x++) {
+            const Uint32 p = ((const Uint32 *)argb)[y * width + x];
+            py[y * width + x] = _YUV_DOT(fy, _rgbToYUVFactors[m].yOffset, (p >> 16) & 0xFF, (p >> 8) & 0xFF, p & 0xFF);
+          }
+        }
+        /* Each chroma sample averages a 2x2 block, which the right and bottom edges repeat */
+        for (y = 0; y < ch; y++) {
+          for (x = 0; x < cw; x++) {
+            const int x1 = SDL_min(2 * x + 1, width - 1), y1 = SDL_min(2 * y + 1, height - 1);
+            const Uint32 *row0 = (const Uint32 *)argb + 2 * y * width, *row1 = (const Uint32 *)argb + y1 * width;
+            Uint32 r = 0, g = 0, b = 0;
+            int k;
+            for (k = 0; k < 4; k++) {
+              const Uint32 p = (k < 2 ? row0 : row1)[(k & 1) ? x1 : 2 * x];
+              r += (p >> 16) & 0xFF;
+              g += (p >> 8) & 0xFF;
+              b += p & 0xFF;
+            }
+            r >>= 2;
+            g >>= 2;
+            b >>= 2;
+            pu[y * cw + x] = _YUV_DOT(fu, 128, r, g, b);
+            pv[y * cw + x] = _YUV_DOT(fv, 128, r, g, b);
+          }
+        }
+        _packYUV(yuvFormats[i], width, height, py, pu, pv, expected);
+        SDL_free(py);
+
+        SDL_memset(actual, 0, yuvSize);
+        result = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, argb, 4 * width, yuvFormats[i], actual, yuvPitch);
+        SDLTest_AssertCheck(result == 0, "Validate conversion result, expected: 0, got: %i", result);
+        SDLTest_AssertCheck(SDL_memcmp(actual, expected, width * height + 2 * cw * ch) == 0, "Validate ARGB8888 to %s output matches the scalar conversion, mode %i",
+          SDL_GetPixelFormatName(yuvFormats[i]), (int)modes[m]);
+      }
+    }
+  }
+
+  SDL_SetYUVConversionMode(oldMode);
+  SDL_free(ys);
+  SDL_free(us);
+  SDL_free(vs);
+  SDL_free(argb);
+  SDL_free(yuv);
+  SDL_free(actual);
+  SDL_free(expected);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -515,9 +847,15 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVThreads, "pixels_convertYUVThreads", "Compare threaded and serial YUV conversions with SDL_ConvertPixels", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVKernels, "pixels_convertYUVKernels", "Compare the SIMD YUV conversion kernels with the scalar conversion", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, NULL
 };
 
 /* Pixels test suite (global) */
@@ -766,6 +766,226 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Draws the scene used to compare the serial and tiled software renderers. Helper function.
+ */
+static void
+_drawTiledScene(SDL_Renderer *sw)
+{
+   SDL_Surface *face;
+   SDL_Texture *tface;
+   SDL_Rect rect, clip;
+   SDL_Point points[64];
+   int i;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) {
+      return;
+   }
+   tface = SDL_CreateTextureFromSurface(sw, face);
+   SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+   SDL_FreeSurface(face);
+   if (tface == NULL) {
+      return;
+   }
+
+   SDL_SetRenderDrawColor(sw, 13, 37, 200, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(sw);
+
+   /* Opaque and blended fills crossing tile boundaries */
+   for (i = 0; i < 16; i++) {
+      rect.x = i * 37 - 20;
+      rect.y = i * 29 - 10;
+      rect.w = 150 + i * 3;
+      rect.h = 90 + i * 5;
+      SDL_SetRenderDrawBlendMode(sw, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+      SDL_SetRenderDrawColor(sw, (Uint8)(i * 16), (Uint8)(255 - i * 8), (Uint8)(i * 5), (Uint8)(64 + i * 10));
+      SDL_RenderFillRect(sw, &rect);
+   }
+
+   /* Copies with modulation and blending, some partially offscreen */
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 24; i++) {
+      rect.x = (i * 53) % 600 - 30;
+      rect.y = (i * 71) % 440 - 20;
+      rect.w = 42;
+      rect.h = 42;
+      SDL_SetTextureColorMod(tface, (Uint8)(255 - i * 5), (Uint8)(i * 10), 200);
+      SDL_SetTextureAlphaMod(tface, (Uint8)(100 + i * 6));
+      SDL_RenderCopy(sw, tface, NULL, &rect);
+   }
+
+   /* Scaled copies and lines run serially in between tiled commands */
+   rect.x = 100;
+   rect.y = 120;
+   rect.w = 300;
+   rect.h = 200;
+   SDL_RenderCopy(sw, tface, NULL, &rect);
+   SDL_SetRenderDrawColor(sw, 255, 255, 0, 128);
+   SDL_RenderDrawLine(sw, 0, 0, 639, 479);
+
+   /* Points and fills under a clip rect */
+   clip.x = 50;
+   clip.y = 60;
+   clip.w = 333;
+   clip.h = 222;
+   SDL_RenderSetClipRect(sw, &clip);
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      points[i].x = (i * 97) % 640;
+      points[i].y = (i * 61) % 480;
+   }
+   SDL_SetRenderDrawBlendMode(sw, SDL_BLENDMODE_ADD);
+   SDL_RenderDrawPoints(sw, points, SDL_arraysize(points));
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = 640;
+   rect.h = 480;
+   SDL_SetRenderDrawColor(sw, 30, 60, 90, 100);
+   SDL_RenderFillRect(sw, &rect);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_ADD);
+   rect.x = 360;
+   rect.y = 260;
+   rect.w = 42;
+   rect.h = 42;
+   SDL_RenderCopy(sw, tface, NULL, &rect);
+   SDL_RenderSetClipRect(sw, NULL);
+
+   SDL_RenderPresent(sw);
+   SDL_DestroyTexture(tface);
+}
+
+/**
+ * @brief Tests that the tiled software renderer matches the serial one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+int
+render_testSoftwareTiled(void *arg)
+{
+   SDL_Surface *serial, *tiled;
+   SDL_Renderer *sw;
+   char *oldTiled;
+   int ret;
+
+   serial = SDL_CreateRGBSurface(0, 640, 480, 32, RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   tiled = SDL_CreateRGBSurface(0, 640, 480, 32, RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(serial != NULL && tiled != NULL, "Verify SDL_CreateRGBSurface() results");
+   if (serial == NULL || tiled == NULL) {
+      SDL_FreeSurface(serial);
+      SDL_FreeSurface(tiled);
+      return TEST_ABORTED;
+   }
+
+   /* Draw the tiled scene first, so that an unset hint ends up at "0", its default */
+   oldTiled = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_TILED) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_TILED)) : NULL;
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILED, "1");
+   sw = SDL_CreateSoftwareRenderer(tiled);
+   SDLTest_AssertCheck(sw != NULL, "Verify SDL_CreateSoftwareRenderer() result with SDL_HINT_RENDER_SOFTWARE_TILED");
+   if (sw != NULL) {
+      _drawTiledScene(sw);
+      SDL_DestroyRenderer(sw);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILED, "0");
+   sw = SDL_CreateSoftwareRenderer(serial);
+   SDLTest_AssertCheck(sw != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+   if (sw != NULL) {
+      _drawTiledScene(sw);
+      SDL_DestroyRenderer(sw);
+   }
+   if (oldTiled != NULL) {
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILED, oldTiled);
+      SDL_free(oldTiled);
+   }
+
+   ret = SDLTest_CompareSurfaces(tiled, serial, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+   SDL_FreeSurface(serial);
+   SDL_FreeSurface(tiled);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the render command queue statistics.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetStats
+ */
+int
+render_testRenderStats(void *arg)
+{
+   SDL_Surface *surface;
+   SDL_Renderer *sw;
+   SDL_Texture *texture;
+   SDL_RenderStats stats;
+   SDL_Rect rect = { 4, 4, 8, 8 };
+   Uint32 sum;
+   int ret;
+
+   surface = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateRGBSurface() result");
+   if (surface == NULL) {
+      return TEST_ABORTED;
+   }
+   sw = SDL_CreateSoftwareRenderer(surface);
+   SDLTest_AssertCheck(sw != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+   if (sw == NULL) {
+      SDL_FreeSurface(surface);
+      return TEST_ABORTED;
+   }
+   texture = SDL_CreateTexture(sw, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+   SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+
+   /* Start from a fresh frame */
+   SDL_RenderPresent(sw);
+   ret = SDL_RenderGetStats(sw, &stats, SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_RenderGetStats()");
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.frame == 1, "Validate frame number, expected: 1, got: %u", (unsigned int) stats.frame);
+   SDLTest_AssertCheck(stats.commands == 0 && stats.flushes == 0, "Validate a new frame has no commands, got: %u", (unsigned int) stats.commands);
+
+   /* Queue some drawing and present it */
+   SDL_SetRenderDrawColor(sw, 255, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(sw);
+   SDL_RenderFillRect(sw, &rect);
+   SDL_RenderFillRect(sw, NULL);
+   SDL_RenderCopy(sw, texture, NULL, &rect);
+   SDL_RenderPresent(sw);
+
+   ret = SDL_RenderGetStats(sw, &stats, SDL_TRUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats for the last frame, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.frame == 1, "Validate frame number, expected: 1, got: %u", (unsigned int) stats.frame);
+   SDLTest_AssertCheck(stats.clear_commands == 1, "Validate clear commands, expected: 1, got: %u", (unsigned int) stats.clear_commands);
+   SDLTest_AssertCheck(stats.fillrect_commands == 2, "Validate fill rect commands, expected: 2, got: %u", (unsigned int) stats.fillrect_commands);
+   SDLTest_AssertCheck(stats.copy_commands == (texture ? 1 : 0), "Validate copy commands, got: %u", (unsigned int) stats.copy_commands);
+   SDLTest_AssertCheck(stats.point_commands == 0 && stats.line_commands == 0 && stats.copyex_commands == 0, "Validate there were no other draw commands");
+   sum = stats.viewport_commands + stats.cliprect_commands + stats.drawcolor_commands +
+         stats.clear_commands + stats.point_commands + stats.line_commands +
+         stats.fillrect_commands + stats.copy_commands + stats.copyex_commands + stats.noop_commands;
+   SDLTest_AssertCheck(stats.commands == sum, "Validate total commands, expected: %u, got: %u", (unsigned int) sum, (unsigned int) stats.commands);
+   SDLTest_AssertCheck(stats.flushes > 0, "Validate the queue was flushed, got: %u", (unsigned int) stats.flushes);
+   SDLTest_AssertCheck(stats.vertex_bytes > 0, "Validate vertex data was used, got: %u", (unsigned int) stats.vertex_bytes);
+
+   ret = SDL_RenderGetStats(sw, &stats, SDL_FALSE);
+   SDLTest_AssertCheck(ret == 0 && stats.frame == 2 && stats.commands == 0, "Validate the next frame starts empty, got frame %u with %u commands", (unsigned int) stats.frame, (unsigned int) stats.commands);
+
+   /* Negative case */
+   ret = SDL_RenderGetStats(sw, NULL, SDL_TRUE);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetStats with NULL stats, expected: -1, got: %i", ret);
+
+   if (texture != NULL) {
+      SDL_DestroyTexture(texture);
+   }
+   SDL_DestroyRenderer(sw);
+   SDL_FreeSurface(surface);
+
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1085,9 +1305,12 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testRenderStats, "render_testRenderStats", "Tests the render command queue statistics", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, NULL
 };
 
 /* Render test suite (global) */
@@ -1097,3 +1320,20 @@ SDLTest_TestSuiteReference renderTestSuite = {
     renderTests,
     CleanupDestroyRenderer
 };
+
+/* Software renderer test cases, which render to surfaces and need no window */
+static const SDLTest_TestCaseReference renderSoftwareTest1 =
+        { (SDLTest_TestCaseFp)render_testSoftwareTiled, "render_testSoftwareTiled", "Tests the tiled software renderer against the serial one", TEST_ENABLED };
+
+/* Sequence of RenderSoftware test cases */
+static const SDLTest_TestCaseReference *renderSoftwareTests[] =  {
+    &renderSoftwareTest1, NULL
+};
+
+/* RenderSoftware test suite (global) */
+SDLTest_TestSuiteReference renderSoftwareTestSuite = {
+    "RenderSoftware",
+    NULL,
+    renderSoftwareTests,
+    NULL
+};
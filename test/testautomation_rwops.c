@@ -699,6 +699,110 @@ rwops_testFileWriteReadEndian(void)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests reading from a mapped file and borrowing its data.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWFromFileMapped
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWborrow
+ */
+int
+rwops_testFileMapped(void)
+{
+   SDL_RWops *rw;
+   const char *borrowed;
+   char *loaded;
+   size_t available;
+   Sint64 i;
+   int result;
+
+   /* Negative cases */
+   rw = SDL_RWFromFileMapped(NULL);
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped(NULL) succeeded");
+   SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromFileMapped(NULL) returns NULL");
+   rw = SDL_RWFromFileMapped("something-that-does-not-exist");
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped() with a missing file succeeded");
+   SDLTest_AssertCheck(rw == NULL, "Verify opening a missing file with SDL_RWFromFileMapped returns NULL");
+   borrowed = (const char *) SDL_RWborrow(NULL, &available);
+   SDLTest_AssertPass("Call to SDL_RWborrow(NULL) succeeded");
+   SDLTest_AssertCheck(borrowed == NULL && available == 0, "Verify SDL_RWborrow(NULL) returns NULL and no data");
+
+   /* Open handle */
+   rw = SDL_RWFromFileMapped(RWopsReadTestFilename);
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped() succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFileMapped does not return NULL");
+
+   /* Bail out if NULL */
+   if (rw == NULL) return TEST_ABORTED;
+
+   /* Check type */
+   SDLTest_AssertCheck(rw->type == SDL_RWOPS_MAPPED, "Verify RWops type is SDL_RWOPS_MAPPED; expected: %d, got: %d", SDL_RWOPS_MAPPED, rw->type);
+
+   /* Run generic tests */
+   _testGenericRWopsValidations( rw, 0 );
+
+   /* Borrow from the start and from the middle */
+   i = SDL_RWseek(rw, 0, RW_SEEK_SET);
+   SDLTest_AssertCheck(i == 0, "Verify seek to 0 with SDL_RWseek (RW_SEEK_SET), expected 0, got %"SDL_PRIs64, i);
+   borrowed = (const char *) SDL_RWborrow(rw, &available);
+   SDLTest_AssertPass("Call to SDL_RWborrow() succeeded");
+   SDLTest_AssertCheck(
+       borrowed != NULL && available == sizeof(RWopsHelloWorldTestString)-1,
+       "Verify SDL_RWborrow returns the whole file, expected %i bytes, got %i",
+       (int) (sizeof(RWopsHelloWorldTestString)-1), (int) available);
+   if (borrowed != NULL) {
+       SDLTest_AssertCheck(
+           SDL_memcmp(borrowed, RWopsHelloWorldTestString, available) == 0,
+           "Verify borrowed bytes match expected string");
+   }
+   i = SDL_RWtell(rw);
+   SDLTest_AssertCheck(i == 0, "Verify SDL_RWborrow does not move the position, expected 0, got %"SDL_PRIs64, i);
+
+   SDL_RWseek(rw, 6, RW_SEEK_SET);
+   borrowed = (const char *) SDL_RWborrow(rw, &available);
+   SDLTest_AssertCheck(
+       borrowed != NULL && available == sizeof(RWopsHelloWorldTestString)-7,
+       "Verify SDL_RWborrow returns the rest of the file, expected %i bytes, got %i",
+       (int) (sizeof(RWopsHelloWorldTestString)-7), (int) available);
+   if (borrowed != NULL) {
+       SDLTest_AssertCheck(
+           SDL_memcmp(borrowed, &RWopsHelloWorldTestString[6], available) == 0,
+           "Verify borrowed bytes match the end of the expected string");
+   }
+
+   /* Load the rest of the file through the borrowed data */
+   loaded = (char *) SDL_LoadFile_RW(rw, &available, 0);
+   SDLTest_AssertPass("Call to SDL_LoadFile_RW() succeeded");
+   SDLTest_AssertCheck(loaded != NULL, "Verify SDL_LoadFile_RW does not return NULL");
+   if (loaded != NULL) {
+       SDLTest_AssertCheck(
+           available == sizeof(RWopsHelloWorldTestString)-7 &&
+           SDL_strcmp(loaded, &RWopsHelloWorldTestString[6]) == 0,
+           "Verify loaded data, expected '%s', got '%s'", &RWopsHelloWorldTestString[6], loaded);
+       SDL_free(loaded);
+   }
+   i = SDL_RWtell(rw);
+   SDLTest_AssertCheck(
+       i == (Sint64)(sizeof(RWopsHelloWorldTestString)-1),
+       "Verify SDL_LoadFile_RW leaves the position at the end, expected %i, got %"SDL_PRIs64,
+       (int) (sizeof(RWopsHelloWorldTestString)-1), i);
+
+   /* Close handle */
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Streams that aren't in memory can't be borrowed from */
+   rw = SDL_RWFromFile(RWopsReadTestFilename, "r");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (rw == NULL) return TEST_ABORTED;
+   borrowed = (const char *) SDL_RWborrow(rw, &available);
+   SDLTest_AssertPass("Call to SDL_RWborrow() on a file stream succeeded");
+   SDLTest_AssertCheck(borrowed == NULL && available == 0, "Verify SDL_RWborrow on a file stream returns NULL and no data");
+   SDL_RWclose(rw);
+
+   return TEST_COMPLETED;
+}
 
 /* ================= Test References ================== */
 
@@ -733,10 +837,13 @@ static const SDLTest_TestCaseReference rwopsTest9 =
 static const SDLTest_TestCaseReference rwopsTest10 =
         { (SDLTest_TestCaseFp)rwops_testCompareRWFromMemWithRWFromFile, "rwops_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile RWops for read and seek", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference rwopsTest11 =
+        { (SDLTest_TestCaseFp)rwops_testFileMapped, "rwops_testFileMapped", "Test reading from a mapped file and borrowing its data", TEST_ENABLED };
+
 /* Sequence of RWops test cases */
 static const SDLTest_TestCaseReference *rwopsTests[] =  {
     &rwopsTest1, &rwopsTest2, &rwopsTest3, &rwopsTest4, &rwopsTest5, &rwopsTest6,
-    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, NULL
+    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, &rwopsTest11, NULL
 };
 
 /* RWops test suite (global) */
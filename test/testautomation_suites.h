@@ -19,11 +19,13 @@ extern SDLTest_TestSuiteReference pixelsTestSuite;
 extern SDLTest_TestSuiteReference platformTestSuite;
 extern SDLTest_TestSuiteReference rectTestSuite;
 extern SDLTest_TestSuiteReference renderTestSuite;
+extern SDLTest_TestSuiteReference renderSoftwareTestSuite;
 extern SDLTest_TestSuiteReference rwopsTestSuite;
 extern SDLTest_TestSuiteReference sdltestTestSuite;
 extern SDLTest_TestSuiteReference stdlibTestSuite;
 extern SDLTest_TestSuiteReference surfaceTestSuite;
 extern SDLTest_TestSuiteReference syswmTestSuite;
+extern SDLTest_TestSuiteReference threadTestSuite;
 extern SDLTest_TestSuiteReference timerTestSuite;
 extern SDLTest_TestSuiteReference videoTestSuite;
 extern SDLTest_TestSuiteReference hintsTestSuite;
@@ -40,11 +42,13 @@ SDLTest_TestSuiteReference *testSuites[] =  {
     &platformTestSuite,
     &rectTestSuite,
     &renderTestSuite,
+    &renderSoftwareTestSuite,
     &rwopsTestSuite,
     &sdltestTestSuite,
     &stdlibTestSuite,
     &surfaceTestSuite,
     &syswmTestSuite,
+    &threadTestSuite,
     &timerTestSuite,
     &videoTestSuite,
     &hintsTestSuite,
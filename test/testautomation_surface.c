@@ -211,6 +211,132 @@ _AssertFileExist(const char *filename)
 }
 
 
+/**
+ * Helper that fills a 32-bit surface with random pixels whose alpha byte
+ * (at the given shift) is fully transparent, fully opaque or random.
+ */
+void _fillRandom8888(SDL_Surface *surface, int ashift)
+{
+    int x, y;
+
+    for (y = 0; y < surface->h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; x++) {
+            Uint32 pixel = SDLTest_RandomUint32();
+            Uint32 alpha;
+            switch (y < 2 ? y : SDLTest_RandomIntegerInRange(0, 3)) {
+                case 0: alpha = 0x00; break;
+                case 1: alpha = 0xff; break;
+                default: alpha = (pixel >> ashift) & 0xff; break;
+            }
+            row[x] = (pixel & ~(0xffu << ashift)) | (alpha << ashift);
+        }
+    }
+}
+
+/**
+ * Helper that blends one pixel the way the portable per-pixel alpha blitter
+ * for the format does: BlitRGBtoRGBPixelAlpha (>>8) for formats with the
+ * alpha in the top byte, the MMX blitter (>>8, separately rounded terms)
+ * for the other byte layouts when it is available, and the exact /255 of
+ * BlitNtoNPixelAlpha otherwise.
+ */
+Uint32 _blendPixelAlpha8888(Uint32 s, Uint32 d, const SDL_PixelFormat *fmt)
+{
+    const int ashift = fmt->Ashift;
+    const Uint32 alpha = (s >> ashift) & 0xff;
+    SDL_bool mmx = SDL_FALSE;
+    Uint32 pixel = 0;
+    int shift;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == 0xff) {
+        return s;
+    }
+#ifdef __MMX__
+    mmx = SDL_HasMMX();
+#endif
+    for (shift = 0; shift < 32; shift += 8) {
+        Uint32 sc = (s >> shift) & 0xff;
+        Uint32 dc = (d >> shift) & 0xff;
+        if (fmt->Amask == 0xff000000) {
+            if (shift == ashift) {
+                pixel |= (alpha + ((dc * (255 - alpha)) >> 8)) << shift;
+            } else {
+                pixel |= ((sc * alpha + dc * (256 - alpha)) >> 8) << shift;
+            }
+        } else if (mmx) {
+            Uint32 sa = (shift == ashift) ? 255 : alpha;
+            pixel |= SDL_min(((sc * sa) >> 8) + ((dc * (255 - alpha)) >> 8), 255) << shift;
+        } else if (shift == ashift) {
+            pixel |= (Uint32)(Uint8)(alpha + dc - (alpha * dc) / 255) << shift;
+        } else {
+            pixel |= (Uint32)(Uint8)(((int)(sc - dc) * (int)alpha) / 255 + dc) << shift;
+        }
+    }
+    return pixel;
+}
+
+/**
+ * Helper that compares the pixels of two 32-bit surfaces, returning the number of differences.
+ */
+int _compare8888(SDL_Surface *surface, SDL_Surface *reference)
+{
+    int x, y, differences = 0;
+
+    for (y = 0; y < surface->h; y++) {
+        const Uint32 *row = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+        const Uint32 *expected = (const Uint32 *)((const Uint8 *)reference->pixels + y * reference->pitch);
+        for (x = 0; x < surface->w; x++) {
+            if (row[x] != expected[x]) {
+                differences++;
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * Helper that computes the filter weights the scaled blits should apply to
+ * each source pixel along one axis, as a dst_len x src_len matrix.
+ */
+double *_scaleWeights(int src_len, int dst_len, SDL_bool area)
+{
+    double *weights = (double *)SDL_calloc(src_len * dst_len, sizeof(double));
+    int i, j;
+
+    if (weights == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < dst_len; i++) {
+        double *w = weights + i * src_len;
+        if (area && src_len > dst_len) {
+            double start = (double)i * src_len / dst_len;
+            double end = (double)(i + 1) * src_len / dst_len;
+            for (j = (int)start; j < src_len && j < end; j++) {
+                double lo = SDL_max(start, (double)j);
+                double hi = SDL_min(end, (double)(j + 1));
+                w[j] = (hi - lo) * dst_len / src_len;
+            }
+        } else {
+            double pos = (i + 0.5) * src_len / dst_len - 0.5;
+            int x0;
+            if (pos < 0.0) {
+                pos = 0.0;
+            }
+            x0 = (int)pos;
+            if (x0 >= src_len - 1) {
+                w[src_len - 1] = 1.0;
+            } else {
+                w[x0] = 1.0 - (pos - x0);
+                w[x0 + 1] = pos - x0;
+            }
+        }
+    }
+    return weights;
+}
+
 /* Test case functions */
 
 /**
@@ -588,6 +714,949 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests per-pixel alpha, surface alpha and colorkey+alpha blits
+ * between 32-bit formats against the portable blending arithmetic, with
+ * widths that cover both whole vector blocks and leftover pixels.
+ */
+int
+surface_testBlitAlpha8888(void *arg)
+{
+    static const struct { Uint32 src; Uint32 dst; } pixelAlphaFormats[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBA8888 },
+        { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGRA8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888 }
+    };
+    static const struct { Uint32 src; Uint32 dst; } surfaceAlphaFormats[] = {
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ABGR8888 }
+    };
+    static const int widths[] = { 1, 3, 4, 7, 8, 13, 16, 37 };
+    static const Uint8 alphas[] = { 0, 1, 128, 200, 254 };
+    const int h = 6;
+    int f, w, a, x, y, ret;
+
+    /* Per-pixel alpha */
+    for (f = 0; f < SDL_arraysize(pixelAlphaFormats); f++) {
+        for (w = 0; w < SDL_arraysize(widths); w++) {
+            SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, pixelAlphaFormats[f].src);
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, pixelAlphaFormats[f].dst);
+            SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, pixelAlphaFormats[f].dst);
+            int ashift;
+            SDLTest_AssertCheck(src && dst && expected, "Verify surfaces are not NULL");
+            if (!src || !dst || !expected) {
+                return TEST_ABORTED;
+            }
+            ashift = src->format->Ashift;
+            _fillRandom8888(src, ashift);
+            _fillRandom8888(dst, ashift);
+            SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(dst, NULL, expected, NULL);
+
+            for (y = 0; y < h; y++) {
+                const Uint32 *s = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+                Uint32 *d = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+                for (x = 0; x < widths[w]; x++) {
+                    d[x] = _blendPixelAlpha8888(s[x], d[x], src->format);
+                }
+            }
+
+            ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+            ret = _compare8888(dst, expected);
+            SDLTest_AssertCheck(ret == 0, "Validate %s -> %s pixel alpha blit, width %d, expected: 0 differences, got: %i",
+                                SDL_GetPixelFormatName(pixelAlphaFormats[f].src), SDL_GetPixelFormatName(pixelAlphaFormats[f].dst), widths[w], ret);
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(expected);
+        }
+    }
+
+    /* Per-surface alpha, with and without a colorkey */
+    for (f = 0; f < SDL_arraysize(surfaceAlphaFormats); f++) {
+        for (w = 0; w < SDL_arraysize(widths); w++) {
+            for (a = 0; a < SDL_arraysize(alphas); a++) {
+                SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, surfaceAlphaFormats[f].src);
+                SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, surfaceAlphaFormats[f].dst);
+                SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, surfaceAlphaFormats[f].dst);
+                Uint32 alpha = alphas[a];
+                Uint32 rgbmask, amask, ashift, ckey;
+                int keyed;
+                SDLTest_AssertCheck(src && dst && expected, "Verify surfaces are not NULL");
+                if (!src || !dst || !expected) {
+                    return TEST_ABORTED;
+                }
+                rgbmask = dst->format->Rmask | dst->format->Gmask | dst->format->Bmask;
+                amask = dst->format->Amask;
+                ashift = dst->format->Ashift;
+                ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+                ret = SDL_SetSurfaceAlphaMod(src, (Uint8)alpha);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetSurfaceAlphaMod, expected: 0, got: %i", ret);
+
+                for (keyed = 0; keyed < 2; keyed++) {
+                    _fillRandom8888(src, 24);
+                    _fillRandom8888(dst, 24);
+                    for (y = 0; y < h; y++) {
+                        Uint32 *s = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+                        for (x = 0; x < widths[w]; x++) {
+                            s[x] &= rgbmask;
+                        }
+                    }
+                    ckey = ((const Uint32 *)src->pixels)[0];
+                    if (keyed) {
+                        for (y = 0; y < h; y++) {
+                            Uint32 *s = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+                            for (x = y % 3; x < widths[w]; x += 3) {
+                                s[x] = ckey;
+                            }
+                        }
+                    }
+                    SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+                    SDL_BlitSurface(dst, NULL, expected, NULL);
+
+                    for (y = 0; y < h; y++) {
+                        const Uint32 *s = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+                        Uint32 *d = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+                        for (x = 0; x < widths[w]; x++) {
+                            Uint32 pixel = 0;
+                            int shift;
+                            if (keyed && (s[x] == ckey || alpha == 0)) {
+                                continue;
+                            }
+                            for (shift = 0; shift < 32; shift += 8) {
+                                int sc = (s[x] >> shift) & 0xff;
+                                int dc = (d[x] >> shift) & 0xff;
+                                if (!((rgbmask >> shift) & 0xff)) {
+                                    continue;
+                                } else if (keyed) {
+                                    pixel |= (Uint32)(dc + (sc - dc) * (int)alpha / 255) << shift;
+                                } else {
+                                    pixel |= (Uint32)((sc * alpha + dc * (256 - alpha)) >> 8) << shift;
+                                }
+                            }
+                            if (!keyed) {
+                                pixel |= 0xff000000;
+                            } else if (amask) {
+                                Uint32 dalpha = (d[x] >> ashift) & 0xff;
+                                pixel |= (alpha + dalpha - alpha * dalpha / 255) << ashift;
+                            }
+                            d[x] = pixel;
+                        }
+                    }
+
+                    ret = SDL_SetColorKey(src, keyed ? SDL_TRUE : SDL_FALSE, ckey);
+                    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetColorKey, expected: 0, got: %i", ret);
+                    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+                    ret = _compare8888(dst, expected);
+                    SDLTest_AssertCheck(ret == 0, "Validate %s -> %s surface alpha %d%s blit, width %d, expected: 0 differences, got: %i",
+                                        SDL_GetPixelFormatName(surfaceAlphaFormats[f].src), SDL_GetPixelFormatName(surfaceAlphaFormats[f].dst),
+                                        (int)alpha, keyed ? " colorkey" : "", widths[w], ret);
+                }
+
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(expected);
+            }
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests RGBA8888 and BGRA8888 per-pixel alpha blits, whose alpha is
+ * in the low byte, against the scalar blending of the blitter they would
+ * otherwise use. The surfaces are wide enough for whole vector blocks of
+ * transparent, opaque and mixed pixels, and the blit goes into the middle of
+ * the destination so each row is offset from it.
+ */
+int
+surface_testBlitAlphaRGBA8888(void *arg)
+{
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888 };
+    const int w = 67, h = 23;
+    SDL_Rect dstrect;
+    int f, x, y, ret;
+
+    dstrect.x = 5;
+    dstrect.y = 3;
+    dstrect.w = w;
+    dstrect.h = h;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[f]);
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w + 9, h + 5, 32, formats[f]);
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, w + 9, h + 5, 32, formats[f]);
+        SDLTest_AssertCheck(src && dst && expected, "Verify surfaces are not NULL");
+        if (!src || !dst || !expected) {
+            return TEST_ABORTED;
+        }
+        _fillRandom8888(src, src->format->Ashift);
+        _fillRandom8888(dst, dst->format->Ashift);
+        SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(dst, NULL, expected, NULL);
+
+        for (y = 0; y < h; y++) {
+            const Uint32 *s = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+            Uint32 *d = (Uint32 *)((Uint8 *)expected->pixels + (y + dstrect.y) * expected->pitch) + dstrect.x;
+            for (x = 0; x < w; x++) {
+                d[x] = _blendPixelAlpha8888(s[x], d[x], src->format);
+            }
+        }
+
+        ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+        ret = SDL_BlitSurface(src, NULL, dst, &dstrect);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        ret = _compare8888(dst, expected);
+        SDLTest_AssertCheck(ret == 0, "Validate %s pixel alpha blit, expected: 0 differences, got: %i",
+                            SDL_GetPixelFormatName(formats[f]), ret);
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(expected);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests linear and area-averaging scaled blits against reference
+ * filtering computed in floating point.
+ */
+int
+surface_testBlitScaledFiltered(void *arg)
+{
+    static const struct { int sw, sh, dw, dh; } sizes[] = {
+        { 37, 23, 100, 61 }, { 100, 61, 37, 23 }, { 50, 10, 19, 40 }, { 64, 64, 16, 16 }, { 3, 2, 45, 5 }
+    };
+    static const char *qualities[] = { "linear", "best" };
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888 };
+    char *oldQuality = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY)) : NULL;
+    int q, f, n, x, y, c, i, ret;
+
+    for (q = 0; q < SDL_arraysize(qualities); q++) {
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, qualities[q]);
+        for (f = 0; f < SDL_arraysize(formats); f++) {
+            for (n = 0; n < SDL_arraysize(sizes); n++) {
+                SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, sizes[n].sw, sizes[n].sh, 32, formats[f]);
+                SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, sizes[n].dw, sizes[n].dh, 32, formats[f]);
+                double *wx = _scaleWeights(sizes[n].sw, sizes[n].dw, q == 1);
+                double *wy = _scaleWeights(sizes[n].sh, sizes[n].dh, q == 1);
+                double maxError = 0.0;
+                SDLTest_AssertCheck(src && dst && wx && wy, "Verify surfaces and weights are not NULL");
+                if (!src || !dst || !wx || !wy) {
+                    return TEST_ABORTED;
+                }
+                _fillRandom8888(src, 24);
+                SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                ret = SDL_BlitScaled(src, NULL, dst, NULL);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+
+                for (y = 0; y < dst->h; y++) {
+                    const Uint8 *row = (const Uint8 *)dst->pixels + y * dst->pitch;
+                    for (x = 0; x < dst->w; x++) {
+                        for (c = 0; c < 4; c++) {
+                            double expected = 0.0;
+                            double error;
+                            for (i = 0; i < src->h * src->w; i++) {
+                                double w = wy[y * src->h + i / src->w] * wx[x * src->w + i % src->w];
+                                if (w != 0.0) {
+                                    expected += w * ((const Uint8 *)src->pixels)[(i / src->w) * src->pitch + (i % src->w) * 4 + c];
+                                }
+                            }
+                            error = SDL_fabs(row[x * 4 + c] - expected);
+                            if (error > maxError) {
+                                maxError = error;
+                            }
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(maxError < 0.6, "Validate %s %s scaling %dx%d -> %dx%d, expected error < 0.6, got: %f",
+                                    qualities[q], SDL_GetPixelFormatName(formats[f]),
+                                    sizes[n].sw, sizes[n].sh, sizes[n].dw, sizes[n].dh, maxError);
+
+                SDL_free(wx);
+                SDL_free(wy);
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+            }
+        }
+    }
+
+    /* Blended and converting blits filter first, then blend the result */
+    {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, 45, 31, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Surface *scaled = SDL_CreateRGBSurfaceWithFormat(0, 70, 20, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, 70, 20, 32, SDL_PIXELFORMAT_RGB888);
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, 70, 20, 32, SDL_PIXELFORMAT_RGB888);
+        SDLTest_AssertCheck(src && scaled && dst && expected, "Verify surfaces are not NULL");
+        if (!src || !scaled || !dst || !expected) {
+            return TEST_ABORTED;
+        }
+        _fillRandom8888(src, 24);
+        _fillRandom8888(dst, 24);
+        SDL_BlitSurface(dst, NULL, expected, NULL);
+
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        ret = SDL_BlitScaled(src, NULL, scaled, NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+        SDL_SetSurfaceBlendMode(scaled, SDL_BLENDMODE_BLEND);
+        ret = SDL_BlitSurface(scaled, NULL, expected, NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        ret = SDL_BlitScaled(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+        ret = _compare8888(dst, expected);
+        SDLTest_AssertCheck(ret == 0, "Validate blended filtered blit, expected: 0 differences, got: %i", ret);
+
+        /* Blit again, smaller and with an alpha mod, so the scratch surface
+           from the first blit is reused with new settings */
+        {
+            SDL_Rect rect = { 5, 3, 30, 15 };
+            SDL_Rect scaledRect = { 0, 0, 30, 15 };
+
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+            ret = SDL_BlitScaled(src, NULL, scaled, &scaledRect);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+            SDL_SetSurfaceAlphaMod(scaled, 128);
+            ret = SDL_BlitSurface(scaled, &scaledRect, expected, &rect);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+            SDL_SetSurfaceAlphaMod(src, 128);
+            ret = SDL_BlitScaled(src, NULL, dst, &rect);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitScaled, expected: 0, got: %i", ret);
+            ret = _compare8888(dst, expected);
+            SDLTest_AssertCheck(ret == 0, "Validate repeated filtered blit, expected: 0 differences, got: %i", ret);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(scaled);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(expected);
+    }
+
+    if (oldQuality != NULL) {
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, oldQuality);
+        SDL_free(oldQuality);
+    } else {
+        /* There's no way to unset a single hint, so clear them the way
+           SDL_Quit() does and later tests see the quality unset again */
+        SDL_ClearHints();
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that a source alternating between destinations blits the
+ * same as one freshly mapped to each, across palette and alpha mod changes.
+ */
+int
+surface_testBlitMapCache(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888
+    };
+    const int w = 33, h = 7;
+    SDL_Surface *src, *ref, *dst[SDL_arraysize(formats)];
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    int i, f, x, y, pass, ret, expectedRet, differences;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 8, SDL_PIXELFORMAT_INDEX8);
+    ref = SDL_CreateRGBSurfaceWithFormat(0, w, h, 8, SDL_PIXELFORMAT_INDEX8);
+    palette = SDL_AllocPalette(256);
+    SDLTest_AssertCheck(src && ref && palette, "Verify surfaces and palette are not NULL");
+    if (!src || !ref || !palette) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < 256; i++) {
+        colors[i].r = (Uint8)i;
+        colors[i].g = (Uint8)(255 - i);
+        colors[i].b = (Uint8)(i * 7);
+        colors[i].a = 255;
+    }
+    SDL_SetPaletteColors(src->format->palette, colors, 0, 256);
+    SDL_SetPaletteColors(ref->format->palette, colors, 0, 256);
+    for (i = 0; i < 256; i++) {
+        colors[i].r = (Uint8)(255 - i);
+        colors[i].g = (Uint8)(i * 3);
+    }
+    SDL_SetPaletteColors(palette, colors, 0, 256);
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            ((Uint8 *)src->pixels)[y * src->pitch + x] = (Uint8)(x * 3 + y * 37);
+            ((Uint8 *)ref->pixels)[y * ref->pitch + x] = (Uint8)(x * 3 + y * 37);
+        }
+    }
+
+    /* The reference never keeps old mappings, since RLE is per destination */
+    SDL_SetSurfaceRLE(ref, 1);
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        dst[f] = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        SDLTest_AssertCheck(dst[f] != NULL, "Verify destination surface is not NULL");
+        if (dst[f] == NULL) {
+            return TEST_ABORTED;
+        }
+        if (dst[f]->format->palette) {
+            SDL_SetSurfacePalette(dst[f], palette);
+        }
+    }
+
+    for (pass = 0; pass < 5; pass++) {
+        if (pass == 1) {
+            /* Palette changes bump the version without invalidating */
+            SDL_SetPaletteColors(src->format->palette, &colors[0], 3, 1);
+            SDL_SetPaletteColors(ref->format->palette, &colors[0], 3, 1);
+        } else if (pass == 2) {
+            SDL_SetColorKey(src, SDL_TRUE, 5);
+            SDL_SetColorKey(ref, SDL_TRUE, 5);
+        } else if (pass == 3) {
+            SDL_SetSurfaceAlphaMod(src, 200);
+            SDL_SetSurfaceAlphaMod(ref, 200);
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+            SDL_SetSurfaceBlendMode(ref, SDL_BLENDMODE_BLEND);
+        } else if (pass == 4) {
+            /* Same flags as before, so the mapping isn't invalidated */
+            SDL_SetSurfaceAlphaMod(src, 100);
+            SDL_SetSurfaceAlphaMod(ref, 100);
+        }
+
+        /* Cycle through more destinations than are cached, then back again */
+        for (i = 0; i < 3 * SDL_arraysize(formats); i++) {
+            SDL_Surface *expected;
+
+            f = (i < SDL_arraysize(formats)) ? i : (i % 2) * 3 + (i / 2) % 3;
+            expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+            SDLTest_AssertCheck(expected != NULL, "Verify expected surface is not NULL");
+            if (expected == NULL) {
+                return TEST_ABORTED;
+            }
+            if (expected->format->palette) {
+                SDL_SetSurfacePalette(expected, palette);
+            }
+
+            SDL_FillRect(dst[f], NULL, 0);
+            ret = SDL_BlitSurface(src, NULL, dst[f], NULL);
+            expectedRet = SDL_BlitSurface(ref, NULL, expected, NULL);
+            SDLTest_AssertCheck(ret == expectedRet, "Validate result from SDL_BlitSurface to %s, expected: %i, got: %i",
+                                SDL_GetPixelFormatName(formats[f]), expectedRet, ret);
+            if (ret == 0 && expectedRet == 0) {
+                differences = 0;
+                for (y = 0; y < h; y++) {
+                    if (SDL_memcmp((Uint8 *)dst[f]->pixels + y * dst[f]->pitch,
+                                   (Uint8 *)expected->pixels + y * expected->pitch,
+                                   w * expected->format->BytesPerPixel) != 0) {
+                        differences++;
+                    }
+                }
+                SDLTest_AssertCheck(differences == 0, "Validate pass %d blit to %s, expected: 0 differing rows, got: %i",
+                                    pass, SDL_GetPixelFormatName(formats[f]), differences);
+            }
+            SDL_FreeSurface(expected);
+        }
+    }
+
+    /* Destinations going away must not disturb mappings that remain */
+    SDL_FreeSurface(dst[0]);
+    dst[0] = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[0]);
+    ret = SDL_BlitSurface(src, NULL, dst[0], NULL);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface after freeing a destination, expected: 0, got: %i", ret);
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        SDL_FreeSurface(dst[f]);
+    }
+    SDL_FreePalette(palette);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(ref);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests conversions between 24 and 32-bit byte-aligned formats
+ * against per-pixel SDL_GetRGBA/SDL_MapRGBA, with padded pitches and widths
+ * that cover both whole vector blocks and leftover pixels.
+ */
+int
+surface_testConvertSwizzle(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24
+    };
+    static const int widths[] = { 1, 5, 9, 10, 17, 33 };
+    const int h = 3;
+    int s, d, w, x, y, i, ret;
+
+    for (s = 0; s < SDL_arraysize(formats); s++) {
+        for (d = 0; d < SDL_arraysize(formats); d++) {
+            SDL_PixelFormat *srcfmt, *dstfmt;
+            if (d == s) {
+                continue;  /* a straight copy, unused bits and all */
+            }
+            srcfmt = SDL_AllocFormat(formats[s]);
+            dstfmt = SDL_AllocFormat(formats[d]);
+            SDLTest_AssertCheck(srcfmt && dstfmt, "Verify formats are not NULL");
+            if (!srcfmt || !dstfmt) {
+                return TEST_ABORTED;
+            }
+            for (w = 0; w < SDL_arraysize(widths); w++) {
+                int srcpitch = widths[w] * srcfmt->BytesPerPixel + 5;
+                int dstpitch = widths[w] * dstfmt->BytesPerPixel + 3;
+                Uint8 *src = (Uint8 *)SDL_malloc(srcpitch * h);
+                Uint8 *dst = (Uint8 *)SDL_malloc(dstpitch * h);
+                int differences = 0;
+                SDLTest_AssertCheck(src && dst, "Verify buffers are not NULL");
+                if (!src || !dst) {
+                    return TEST_ABORTED;
+                }
+                for (i = 0; i < srcpitch * h; i++) {
+                    src[i] = (Uint8)SDLTest_RandomUint8();
+                }
+                SDL_memset(dst, 0xAA, dstpitch * h);
+
+                ret = SDL_ConvertPixels(widths[w], h, formats[s], src, srcpitch, formats[d], dst, dstpitch);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < widths[w]; x++) {
+                        const Uint8 *sp = src + y * srcpitch + x * srcfmt->BytesPerPixel;
+                        const Uint8 *dp = dst + y * dstpitch + x * dstfmt->BytesPerPixel;
+                        Uint32 pixel = 0, expected, actual = 0;
+                        Uint8 r, g, b, a;
+                        for (i = 0; i < srcfmt->BytesPerPixel; i++) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                            pixel |= (Uint32)sp[i] << (i * 8);
+#else
+                            pixel = (pixel << 8) | sp[i];
+#endif
+                        }
+                        for (i = 0; i < dstfmt->BytesPerPixel; i++) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                            actual |= (Uint32)dp[i] << (i * 8);
+#else
+                            actual = (actual << 8) | dp[i];
+#endif
+                        }
+                        SDL_GetRGBA(pixel, srcfmt, &r, &g, &b, &a);
+                        expected = SDL_MapRGBA(dstfmt, r, g, b, a);
+                        if (actual != expected) {
+                            differences++;
+                        }
+                    }
+                    /* The padding at the end of each row is left alone */
+                    for (i = widths[w] * dstfmt->BytesPerPixel; i < dstpitch; i++) {
+                        if (dst[y * dstpitch + i] != 0xAA) {
+                            differences++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(differences == 0, "Validate %s -> %s conversion, width %d, expected: 0 differences, got: %i",
+                                    SDL_GetPixelFormatName(formats[s]), SDL_GetPixelFormatName(formats[d]), widths[w], differences);
+
+                SDL_free(src);
+                SDL_free(dst);
+            }
+            SDL_FreeFormat(srcfmt);
+            SDL_FreeFormat(dstfmt);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Helper that computes what the generated blitters produce for one pixel,
+ * using the same integer arithmetic as SDL_blit_auto.c.
+ */
+Uint32 _blitGeneratedPixel(Uint32 s, SDL_PixelFormat *srcfmt, Uint32 d, SDL_PixelFormat *dstfmt,
+                           SDL_BlendMode mode, Uint8 mr, Uint8 mg, Uint8 mb, Uint8 ma)
+{
+    Uint8 r8, g8, b8, a8;
+    Uint32 sR, sG, sB, sA, dR, dG, dB, dA;
+
+    SDL_GetRGBA(s, srcfmt, &r8, &g8, &b8, &a8);
+    sR = r8; sG = g8; sB = b8; sA = a8;
+    SDL_GetRGBA(d, dstfmt, &r8, &g8, &b8, &a8);
+    dR = r8; dG = g8; dB = b8; dA = a8;
+
+    if (mr != 255 || mg != 255 || mb != 255) {
+        sR = sR * mr / 255;
+        sG = sG * mg / 255;
+        sB = sB * mb / 255;
+    }
+    if (ma != 255) {
+        sA = sA * ma / 255;
+    }
+    if (mode == SDL_BLENDMODE_BLEND || mode == SDL_BLENDMODE_ADD) {
+        sR = sR * sA / 255;
+        sG = sG * sA / 255;
+        sB = sB * sA / 255;
+    }
+    switch (mode) {
+    case SDL_BLENDMODE_BLEND:
+        dR = sR + (255 - sA) * dR / 255;
+        dG = sG + (255 - sA) * dG / 255;
+        dB = sB + (255 - sA) * dB / 255;
+        dA = sA + (255 - sA) * dA / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        dR = SDL_min(sR + dR, 255);
+        dG = SDL_min(sG + dG, 255);
+        dB = SDL_min(sB + dB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        dR = sR * dR / 255;
+        dG = sG * dG / 255;
+        dB = sB * dB / 255;
+        break;
+    default:
+        dR = sR; dG = sG; dB = sB; dA = sA;
+        break;
+    }
+    return SDL_MapRGBA(dstfmt, (Uint8)dR, (Uint8)dG, (Uint8)dB, (Uint8)dA);
+}
+
+/**
+ * @brief Tests the generated 32-bit blitters between every pair of 8888
+ * formats, with color and alpha modulation, additive, modulated and
+ * scaled blending, against the reference arithmetic.
+ */
+int
+surface_testBlitGenerated(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const struct {
+        SDL_BlendMode mode;
+        Uint8 r, g, b, a;
+        int scale;
+    } cases[] = {
+        { SDL_BLENDMODE_NONE, 200, 100, 50, 255, 0 },
+        { SDL_BLENDMODE_NONE, 255, 255, 255, 100, 0 },
+        { SDL_BLENDMODE_ADD, 255, 255, 255, 255, 0 },
+        { SDL_BLENDMODE_ADD, 120, 255, 30, 180, 0 },
+        { SDL_BLENDMODE_MOD, 255, 255, 255, 255, 0 },
+        { SDL_BLENDMODE_BLEND, 90, 250, 160, 255, 0 },
+        { SDL_BLENDMODE_NONE, 255, 255, 255, 255, 1 },
+        { SDL_BLENDMODE_BLEND, 255, 255, 255, 255, 1 },
+        { SDL_BLENDMODE_MOD, 10, 20, 30, 40, 1 }
+    };
+    static const int widths[] = { 1, 7, 9, 17, 35 };
+    const int h = 3;
+    char *oldQuality = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY)) : NULL;
+    int s, d, c, w, x, y, ret;
+
+    /* An unset quality already means nearest, so only override a set one */
+    if (oldQuality != NULL) {
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    }
+    for (s = 0; s < SDL_arraysize(formats); s++) {
+        for (d = 0; d < SDL_arraysize(formats); d++) {
+            for (c = 0; c < SDL_arraysize(cases); c++) {
+                if (d == s && cases[c].scale && cases[c].mode == SDL_BLENDMODE_NONE) {
+                    continue;  /* a plain stretch, which doesn't use these blitters */
+                }
+                for (w = 0; w < SDL_arraysize(widths); w++) {
+                    int scale = cases[c].scale ? 2 : 1;
+                    SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, widths[w], h, 32, formats[s]);
+                    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, widths[w] * scale, h * scale, 32, formats[d]);
+                    SDL_Surface *orig = SDL_CreateRGBSurfaceWithFormat(0, widths[w] * scale, h * scale, 32, formats[d]);
+                    int differences = 0;
+                    SDLTest_AssertCheck(src && dst && orig, "Verify surfaces are not NULL");
+                    if (!src || !dst || !orig) {
+                        return TEST_ABORTED;
+                    }
+                    _fillRandom8888(src, 24);
+                    _fillRandom8888(dst, 0);
+                    SDL_memcpy(orig->pixels, dst->pixels, dst->h * dst->pitch);
+
+                    SDL_SetSurfaceBlendMode(src, cases[c].mode);
+                    SDL_SetSurfaceColorMod(src, cases[c].r, cases[c].g, cases[c].b);
+                    SDL_SetSurfaceAlphaMod(src, cases[c].a);
+                    if (cases[c].scale) {
+                        ret = SDL_BlitScaled(src, NULL, dst, NULL);
+                    } else {
+                        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                    }
+                    SDLTest_AssertCheck(ret == 0, "Validate result from blit, expected: 0, got: %i", ret);
+
+                    for (y = 0; y < dst->h; y++) {
+                        const Uint32 *srow = (const Uint32 *)((const Uint8 *)src->pixels + (y / scale) * src->pitch);
+                        const Uint32 *orow = (const Uint32 *)((const Uint8 *)orig->pixels + y * orig->pitch);
+                        const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                        for (x = 0; x < dst->w; x++) {
+                            /* Alpha modulation only matters when there's somewhere to put it */
+                            Uint8 ma = (cases[c].mode != SDL_BLENDMODE_NONE || dst->format->Amask) ? cases[c].a : 255;
+                            Uint32 expected = _blitGeneratedPixel(srow[x / scale], src->format, orow[x], dst->format,
+                                                                  cases[c].mode, cases[c].r, cases[c].g, cases[c].b, ma);
+                            if (drow[x] != expected) {
+                                differences++;
+                            }
+                        }
+                    }
+                    SDLTest_AssertCheck(differences == 0, "Validate %s -> %s blit, case %d, width %d, expected: 0 differences, got: %i",
+                                        SDL_GetPixelFormatName(formats[s]), SDL_GetPixelFormatName(formats[d]), c, widths[w], differences);
+
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    SDL_FreeSurface(orig);
+                }
+            }
+        }
+    }
+    if (oldQuality != NULL) {
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, oldQuality);
+        SDL_free(oldQuality);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that threaded conversions give the same output as serial ones.
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ * @sa http://wiki.libsdl.org/SDL_ConvertSurface
+ */
+int
+surface_testConvertThreaded(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGRA8888 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB1555 }
+    };
+    const int w = 97, h = 203;
+    char *oldThreshold = SDL_GetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD) ? SDL_strdup(SDL_GetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD)) : NULL;
+    int f, i, ret;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        const int srcpitch = (w * SDL_BYTESPERPIXEL(formats[f][0]) + 7) & ~3;
+        const int dstpitch = (w * SDL_BYTESPERPIXEL(formats[f][1]) + 5) & ~3;
+        Uint8 *src = (Uint8 *)SDL_malloc(srcpitch * h);
+        Uint8 *serial = (Uint8 *)SDL_malloc(dstpitch * h);
+        Uint8 *threaded = (Uint8 *)SDL_malloc(dstpitch * h);
+        SDL_Surface *source, *converted[2];
+        SDL_PixelFormat *dstfmt;
+
+        SDLTest_AssertCheck(src && serial && threaded, "Verify buffers are not NULL");
+        if (!src || !serial || !threaded) {
+            return TEST_ABORTED;
+        }
+        for (i = 0; i < srcpitch * h; i++) {
+            src[i] = (Uint8)SDLTest_RandomUint8();
+        }
+        SDL_memset(serial, 0xAA, dstpitch * h);
+        SDL_memset(threaded, 0xAA, dstpitch * h);
+
+        /* Convert threaded first, so that an unset threshold ends up at "0", its default */
+        SDL_SetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD, "1");
+        ret = SDL_ConvertPixels(w, h, formats[f][0], src, srcpitch, formats[f][1], threaded, dstpitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from threaded SDL_ConvertPixels, expected: 0, got: %i", ret);
+        SDL_SetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD, "0");
+        ret = SDL_ConvertPixels(w, h, formats[f][0], src, srcpitch, formats[f][1], serial, dstpitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from serial SDL_ConvertPixels, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(SDL_memcmp(serial, threaded, dstpitch * h) == 0,
+                            "Validate threaded SDL_ConvertPixels %s -> %s matches serial conversion",
+                            SDL_GetPixelFormatName(formats[f][0]), SDL_GetPixelFormatName(formats[f][1]));
+
+        source = SDL_CreateRGBSurfaceWithFormatFrom(src, w, h, 0, srcpitch, formats[f][0]);
+        dstfmt = SDL_AllocFormat(formats[f][1]);
+        SDLTest_AssertCheck(source && dstfmt, "Verify source surface and format are not NULL");
+        if (!source || !dstfmt) {
+            return TEST_ABORTED;
+        }
+        SDL_SetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD, "1");
+        converted[1] = SDL_ConvertSurface(source, dstfmt, 0);
+        SDL_SetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD, "0");
+        converted[0] = SDL_ConvertSurface(source, dstfmt, 0);
+        SDLTest_AssertCheck(converted[0] && converted[1], "Verify converted surfaces are not NULL");
+        if (converted[0] && converted[1]) {
+            int differences = 0;
+            for (i = 0; i < h; i++) {
+                if (SDL_memcmp((Uint8 *)converted[0]->pixels + i * converted[0]->pitch,
+                               (Uint8 *)converted[1]->pixels + i * converted[1]->pitch,
+                               w * SDL_BYTESPERPIXEL(formats[f][1])) != 0) {
+                    differences++;
+                }
+            }
+            SDLTest_AssertCheck(differences == 0, "Validate threaded SDL_ConvertSurface matches serial conversion, expected: 0 different rows, got: %i", differences);
+        }
+        SDL_FreeSurface(converted[0]);
+        SDL_FreeSurface(converted[1]);
+        SDL_FreeSurface(source);
+        SDL_FreeFormat(dstfmt);
+
+        SDL_free(src);
+        SDL_free(serial);
+        SDL_free(threaded);
+    }
+    if (oldThreshold != NULL) {
+        SDL_SetHint(SDL_HINT_CONVERSION_THREADS_THRESHOLD, oldThreshold);
+        SDL_free(oldThreshold);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Helper that fills the clipped part of a rectangle one pixel at a time.
+ */
+void _fillRectReference(SDL_Surface *surface, const SDL_Rect *rect, Uint32 color)
+{
+    const int bpp = surface->format->BytesPerPixel;
+    SDL_Rect clipped;
+    int x, y, i;
+
+    if (!SDL_IntersectRect(rect, &surface->clip_rect, &clipped)) {
+        return;
+    }
+    for (y = clipped.y; y < clipped.y + clipped.h; y++) {
+        Uint8 *p = (Uint8 *)surface->pixels + y * surface->pitch + clipped.x * bpp;
+        for (x = 0; x < clipped.w; x++, p += bpp) {
+            switch (bpp) {
+            case 1:
+                *p = (Uint8)color;
+                break;
+            case 2:
+                *(Uint16 *)p = (Uint16)color;
+                break;
+            case 3:
+                for (i = 0; i < 3; i++) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                    p[i] = (Uint8)(color >> (i * 8));
+#else
+                    p[i] = (Uint8)(color >> ((2 - i) * 8));
+#endif
+                }
+                break;
+            default:
+                *(Uint32 *)p = color;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests SDL_FillRect and SDL_FillRects with overlapping, adjacent and
+ * clipped rectangles against per-pixel fills.
+ *
+ * @sa http://wiki.libsdl.org/SDL_FillRect
+ * @sa http://wiki.libsdl.org/SDL_FillRects
+ */
+int
+surface_testFillRects(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB332, SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888
+    };
+    const int w = 301, h = 67;
+    SDL_Rect rects[150];
+    SDL_Rect clip;
+    int f, i, ret;
+
+    clip.x = 3;
+    clip.y = 2;
+    clip.w = 290;
+    clip.h = 60;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        SDL_Surface *actual = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        Uint32 color = SDL_MapRGBA(actual->format, (Uint8)SDLTest_RandomUint8(),
+                                   (Uint8)SDLTest_RandomUint8(), (Uint8)SDLTest_RandomUint8(), 0xFF);
+        const Uint32 color_mask = SDL_MapRGBA(actual->format, 0xFF, 0xFF, 0xFF, 0xFF);
+        SDL_Rect full;
+
+        SDLTest_AssertCheck(actual && expected, "Verify surfaces are not NULL");
+        if (!actual || !expected) {
+            return TEST_ABORTED;
+        }
+
+        /* A fill of the whole surface, then one at an odd offset */
+        SDL_memset(actual->pixels, 0x55, actual->pitch * h);
+        SDL_memset(expected->pixels, 0x55, expected->pitch * h);
+        full.x = 0;
+        full.y = 0;
+        full.w = w;
+        full.h = h;
+        ret = SDL_FillRect(actual, NULL, color);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_FillRect, expected: 0, got: %i", ret);
+        _fillRectReference(expected, &full, color);
+        full.x = 1;
+        full.y = 5;
+        full.w = w - 3;
+        full.h = 7;
+        ret = SDL_FillRect(actual, &full, ~color & color_mask);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_FillRect, expected: 0, got: %i", ret);
+        _fillRectReference(expected, &full, ~color & color_mask);
+        SDLTest_AssertCheck(SDL_memcmp(actual->pixels, expected->pixels, actual->pitch * h) == 0,
+                            "Validate SDL_FillRect on %s matches per-pixel fill", SDL_GetPixelFormatName(formats[f]));
+
+        /* Random rectangles, runs of spans on the same rows, and rectangles
+           contained in others, spread over more than one batch */
+        SDL_SetClipRect(actual, &clip);
+        SDL_SetClipRect(expected, &clip);
+        SDL_memset(actual->pixels, 0x55, actual->pitch * h);
+        SDL_memset(expected->pixels, 0x55, expected->pitch * h);
+        for (i = 0; i < SDL_arraysize(rects); i++) {
+            switch (i % 3) {
+            case 0:
+                rects[i].x = SDLTest_RandomIntegerInRange(-20, w);
+                rects[i].y = SDLTest_RandomIntegerInRange(-5, h);
+                rects[i].w = SDLTest_RandomIntegerInRange(0, 200);
+                rects[i].h = SDLTest_RandomIntegerInRange(0, 20);
+                break;
+            case 1:
+                rects[i].x = rects[i - 1].x + rects[i - 1].w - SDLTest_RandomIntegerInRange(0, 2);
+                rects[i].y = rects[i - 1].y;
+                rects[i].w = SDLTest_RandomIntegerInRange(1, 60);
+                rects[i].h = rects[i - 1].h;
+                break;
+            default:
+                rects[i].x = rects[i - 2].x + 1;
+                rects[i].y = rects[i - 2].y + 1;
+                rects[i].w = SDL_max(rects[i - 2].w - 2, 0);
+                rects[i].h = SDL_max(rects[i - 2].h - 2, 0);
+                break;
+            }
+            _fillRectReference(expected, &rects[i], color);
+        }
+        ret = SDL_FillRects(actual, rects, SDL_arraysize(rects), color);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_FillRects, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(SDL_memcmp(actual->pixels, expected->pixels, actual->pitch * h) == 0,
+                            "Validate SDL_FillRects on %s matches per-pixel fill", SDL_GetPixelFormatName(formats[f]));
+
+        SDL_FreeSurface(actual);
+        SDL_FreeSurface(expected);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -630,11 +1699,36 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testBlitAlpha8888, "surface_testBlitAlpha8888", "Tests 32-bit alpha blits against reference blending.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testBlitScaledFiltered, "surface_testBlitScaledFiltered", "Tests linear and area-averaging scaled blits.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testBlitMapCache, "surface_testBlitMapCache", "Tests blitting one source to alternating destinations.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testConvertSwizzle, "surface_testConvertSwizzle", "Tests conversions between 24 and 32-bit formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testBlitGenerated, "surface_testBlitGenerated", "Tests the generated blitters between 32-bit formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testConvertThreaded, "surface_testConvertThreaded", "Tests that threaded conversions match serial ones.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests filling overlapping and clipped rectangles.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testBlitAlphaRGBA8888, "surface_testBlitAlphaRGBA8888", "Tests RGBA8888 and BGRA8888 alpha blits against scalar blending.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15, &surfaceTest16,
+    &surfaceTest17, &surfaceTest18, &surfaceTest19, &surfaceTest20, NULL
 };
 
 /* Surface test suite (global) */
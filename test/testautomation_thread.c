@@ -0,0 +1,240 @@
+/**
+ * Thread test suite
+ */
+
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+/* Test case functions */
+
+static SDL_atomic_t _jobsRun;
+
+static void SDLCALL
+_countJob(void *data)
+{
+    SDL_AtomicIncRef(&_jobsRun);
+}
+
+/**
+ * @brief Add jobs to a counter and wait for them
+ */
+int
+thread_addWaitJobs(void *arg)
+{
+    const int numJobs = 1000;
+    SDL_JobCounter *counter;
+    int i, result;
+
+    result = SDL_GetNumJobThreads();
+    SDLTest_AssertPass("Call to SDL_GetNumJobThreads()");
+    SDLTest_AssertCheck(result >= 1, "Check that the pool has worker threads, got: %d", result);
+
+    counter = SDL_CreateJobCounter();
+    SDLTest_AssertPass("Call to SDL_CreateJobCounter()");
+    SDLTest_AssertCheck(counter != NULL, "Check result is not NULL");
+    if (counter == NULL) {
+        return TEST_ABORTED;
+    }
+    result = SDL_GetJobCounterValue(counter);
+    SDLTest_AssertCheck(result == 0, "Check that a new counter is zero, got: %d", result);
+
+    SDL_AtomicSet(&_jobsRun, 0);
+    for (i = 0; i < numJobs; ++i) {
+        result = SDL_AddJob(_countJob, NULL, counter, NULL);
+        if (result != 0) {
+            break;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_AddJob() %d times", numJobs);
+    SDLTest_AssertCheck(result == 0, "Check result value, expected: 0, got: %i", result);
+
+    SDL_WaitJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    result = SDL_AtomicGet(&_jobsRun);
+    SDLTest_AssertCheck(result == numJobs, "Check that every job ran, expected: %d, got: %d", numJobs, result);
+    result = SDL_GetJobCounterValue(counter);
+    SDLTest_AssertCheck(result == 0, "Check that the counter is back to zero, got: %d", result);
+
+    /* Negative cases */
+    result = SDL_AddJob(NULL, NULL, counter, NULL);
+    SDLTest_AssertCheck(result == -1, "Check that adding a NULL function fails, got: %i", result);
+    SDL_WaitJobCounter(NULL);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter(NULL)");
+
+    SDL_DestroyJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_DestroyJobCounter()");
+
+    return TEST_COMPLETED;
+}
+
+#define STAGE_SIZE  64
+
+typedef struct
+{
+    int stage;
+    int index;
+    int *results;
+    SDL_atomic_t *errors;
+} _StageJob;
+
+static void SDLCALL
+_stageJob(void *data)
+{
+    _StageJob *job = (_StageJob *) data;
+    int i;
+
+    /* Every job in the previous stage has to be done before this one starts */
+    if (job->stage == 0) {
+        SDL_Delay(1);  /* keep the first stage busy while the others are added */
+    } else {
+        const int *previous = &job->results[(job->stage - 1) * STAGE_SIZE];
+        for (i = 0; i < STAGE_SIZE; ++i) {
+            if (previous[i] != job->stage) {
+                SDL_AtomicIncRef(job->errors);
+            }
+        }
+    }
+    job->results[job->stage * STAGE_SIZE + job->index] = job->stage + 1;
+}
+
+/**
+ * @brief Chain stages of jobs with dependencies
+ */
+int
+thread_jobDependencies(void *arg)
+{
+    const int numStages = 4;
+    SDL_JobCounter *counters[4];
+    _StageJob jobs[4 * STAGE_SIZE];
+    int results[4 * STAGE_SIZE];
+    SDL_atomic_t errors;
+    int stage, i, result;
+
+    SDL_zero(results);
+    SDL_AtomicSet(&errors, 0);
+    for (stage = 0; stage < numStages; ++stage) {
+        counters[stage] = SDL_CreateJobCounter();
+        SDLTest_AssertCheck(counters[stage] != NULL, "Check result of SDL_CreateJobCounter() is not NULL");
+        if (counters[stage] == NULL) {
+            return TEST_ABORTED;
+        }
+    }
+
+    for (stage = 0; stage < numStages; ++stage) {
+        SDL_JobCounter *dependency = (stage > 0) ? counters[stage - 1] : NULL;
+        for (i = 0; i < STAGE_SIZE; ++i) {
+            _StageJob *job = &jobs[stage * STAGE_SIZE + i];
+            job->stage = stage;
+            job->index = i;
+            job->results = results;
+            job->errors = &errors;
+            result = SDL_AddJob(_stageJob, job, counters[stage], dependency);
+            SDLTest_AssertCheck(result == 0, "Check result of SDL_AddJob(), expected: 0, got: %i", result);
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_AddJob() for %d dependent stages", numStages);
+
+    SDL_WaitJobCounter(counters[numStages - 1]);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter() for the last stage");
+
+    for (stage = 0; stage < numStages; ++stage) {
+        result = SDL_GetJobCounterValue(counters[stage]);
+        SDLTest_AssertCheck(result == 0, "Check that stage %d is done, got: %d", stage, result);
+    }
+    result = SDL_AtomicGet(&errors);
+    SDLTest_AssertCheck(result == 0, "Check that no job started before its dependency, got %d errors", result);
+    for (i = 0; i < SDL_arraysize(results); ++i) {
+        if (results[i] != (i / STAGE_SIZE) + 1) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == SDL_arraysize(results), "Check that every job ran once");
+
+    for (stage = 0; stage < numStages; ++stage) {
+        SDL_DestroyJobCounter(counters[stage]);
+    }
+    return TEST_COMPLETED;
+}
+
+#define TREE_FANOUT 8
+#define TREE_DEPTH  4
+
+static void SDLCALL
+_treeJob(void *data)
+{
+    const int depth = (int) (intptr_t) data;
+
+    SDL_AtomicIncRef(&_jobsRun);
+    if (depth < TREE_DEPTH) {
+        /* Wait for the children from inside the job */
+        SDL_JobCounter *children = SDL_CreateJobCounter();
+        int i;
+
+        for (i = 0; i < TREE_FANOUT; ++i) {
+            SDL_AddJob(_treeJob, (void *) (intptr_t) (depth + 1), children, NULL);
+        }
+        SDL_WaitJobCounter(children);
+        SDL_DestroyJobCounter(children);
+    }
+}
+
+/**
+ * @brief Add jobs from jobs, and wait for them from inside a job
+ */
+int
+thread_nestedJobs(void *arg)
+{
+    SDL_JobCounter *counter;
+    int expected = 0, level = 1;
+    int i, result;
+
+    for (i = 0; i <= TREE_DEPTH; ++i) {
+        expected += level;
+        level *= TREE_FANOUT;
+    }
+
+    counter = SDL_CreateJobCounter();
+    SDLTest_AssertCheck(counter != NULL, "Check result of SDL_CreateJobCounter() is not NULL");
+    if (counter == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDL_AtomicSet(&_jobsRun, 0);
+    result = SDL_AddJob(_treeJob, (void *) (intptr_t) 0, counter, NULL);
+    SDLTest_AssertCheck(result == 0, "Check result of SDL_AddJob(), expected: 0, got: %i", result);
+    SDL_WaitJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter() for a tree of nested jobs");
+
+    result = SDL_AtomicGet(&_jobsRun);
+    SDLTest_AssertCheck(result == expected, "Check that every job ran, expected: %d, got: %d", expected, result);
+
+    SDL_DestroyJobCounter(counter);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Thread test cases */
+static const SDLTest_TestCaseReference threadTest1 =
+        { (SDLTest_TestCaseFp)thread_addWaitJobs, "thread_addWaitJobs", "Call to SDL_AddJob and SDL_WaitJobCounter", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest2 =
+        { (SDLTest_TestCaseFp)thread_jobDependencies, "thread_jobDependencies", "Chain stages of jobs with dependencies", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference threadTest3 =
+        { (SDLTest_TestCaseFp)thread_nestedJobs, "thread_nestedJobs", "Add jobs from jobs and wait for them inside a job", TEST_ENABLED };
+
+/* Sequence of Thread test cases */
+static const SDLTest_TestCaseReference *threadTests[] =  {
+    &threadTest1, &threadTest2, &threadTest3, NULL
+};
+
+/* Thread test suite (global) */
+SDLTest_TestSuiteReference threadTestSuite = {
+    "Thread",
+    NULL,
+    threadTests,
+    NULL
+};
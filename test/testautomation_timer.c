@@ -172,6 +172,120 @@ timer_addRemoveTimer(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Number of nanosecond timer callbacks seen, and when the last one happened */
+int _timerNSCallbackCount = 0;
+Uint64 _timerNSCallbackLast = 0;
+
+/* Nanosecond test callback, repeats until it has been called 10 times */
+Uint64 SDLCALL _timerTestCallbackNS(Uint64 interval, void *param)
+{
+   _timerNSCallbackLast = SDL_GetPerformanceCounter();
+   _timerNSCallbackCount++;
+   return (_timerNSCallbackCount < 10) ? interval : 0;
+}
+
+/**
+ * @brief Call to SDL_AddTimerNS with a sub-millisecond interval
+ */
+int
+timer_addTimerNS(void *arg)
+{
+  const Uint64 interval = 500000;  /* half a millisecond */
+  Uint64 start, elapsed;
+  SDL_TimerID id;
+  SDL_bool result;
+
+  _timerNSCallbackCount = 0;
+  start = SDL_GetPerformanceCounter();
+
+  id = SDL_AddTimerNS(interval, _timerTestCallbackNS, NULL);
+  SDLTest_AssertPass("Call to SDL_AddTimerNS(500000,...)");
+  SDLTest_AssertCheck(id > 0, "Check result value, expected: >0, got: %d", id);
+
+  /* Wait to let the timer fire and cancel itself */
+  SDL_Delay(100);
+  SDLTest_AssertPass("Call to SDL_Delay(100)");
+  SDLTest_AssertCheck(_timerNSCallbackCount == 10, "Check callback count, expected: 10, got: %i", _timerNSCallbackCount);
+
+  /* Ten intervals can't have passed any sooner than 5ms */
+  elapsed = ((_timerNSCallbackLast - start) * 1000000) / SDL_GetPerformanceFrequency();
+  SDLTest_AssertCheck(elapsed >= 5000, "Check elapsed time, expected: >=5000us, got: %dus", (int)elapsed);
+
+  result = SDL_RemoveTimer(id);
+  SDLTest_AssertPass("Call to SDL_RemoveTimer()");
+  SDLTest_AssertCheck(result == SDL_FALSE, "Check result value, expected: %i, got: %i", SDL_FALSE, result);
+
+  return TEST_COMPLETED;
+}
+
+/* Order the short timers of timer_manyTimers fired in */
+#define _TIMER_COUNT_SHORT 100
+int _timerFiredOrder[_TIMER_COUNT_SHORT];
+int _timerFiredCount = 0;
+
+/* Test callback that records the delay it was scheduled with */
+Uint32 SDLCALL _timerOrderCallback(Uint32 interval, void *param)
+{
+   if (_timerFiredCount < _TIMER_COUNT_SHORT) {
+      _timerFiredOrder[_timerFiredCount] = (int)interval;
+   }
+   _timerFiredCount++;
+   return 0;
+}
+
+/**
+ * @brief Adds and removes many timers and checks they fire in deadline order
+ */
+int
+timer_manyTimers(void *arg)
+{
+  SDL_TimerID ids[1000];
+  SDL_bool result;
+  int i, removed = 0, ordered = 1;
+
+  /* Lots of timers that shouldn't fire during the test */
+  for (i = 0; i < SDL_arraysize(ids); i++) {
+    ids[i] = SDL_AddTimer(100000, _timerTestCallback, NULL);
+  }
+  SDLTest_AssertPass("Call to SDL_AddTimer(100000,...) %d times", (int)SDL_arraysize(ids));
+
+  /* Short timers added in scrambled order of their delays, which are far
+     enough apart that adding them all can't reorder their deadlines */
+  _timerFiredCount = 0;
+  for (i = 0; i < _TIMER_COUNT_SHORT; i++) {
+    const Uint32 delay = 10 + 10 * ((i * 37) % _TIMER_COUNT_SHORT);
+    SDL_TimerID id = SDL_AddTimer(delay, _timerOrderCallback, NULL);
+    SDLTest_AssertCheck(id > 0, "Check result value, expected: >0, got: %d", id);
+  }
+
+  /* Remove every other long timer while the short ones are running */
+  for (i = 0; i < SDL_arraysize(ids); i += 2) {
+    removed += SDL_RemoveTimer(ids[i]) ? 1 : 0;
+  }
+  SDLTest_AssertCheck(removed == SDL_arraysize(ids) / 2, "Check removed timers, expected: %d, got: %d", (int)SDL_arraysize(ids) / 2, removed);
+
+  SDL_Delay(1200);
+  SDLTest_AssertPass("Call to SDL_Delay(1200)");
+  SDLTest_AssertCheck(_timerFiredCount == _TIMER_COUNT_SHORT, "Check fired timers, expected: %d, got: %d", _TIMER_COUNT_SHORT, _timerFiredCount);
+  for (i = 1; i < _TIMER_COUNT_SHORT && i < _timerFiredCount; i++) {
+    if (_timerFiredOrder[i] < _timerFiredOrder[i - 1]) {
+      ordered = 0;
+    }
+  }
+  SDLTest_AssertCheck(ordered, "Check timers fired in order of their delays");
+
+  /* The rest of the long timers are still pending */
+  for (i = 1; i < SDL_arraysize(ids); i += 2) {
+    result = SDL_RemoveTimer(ids[i]);
+    if (result != SDL_TRUE) {
+      SDLTest_AssertCheck(result == SDL_TRUE, "Check result value for timer %d, expected: %i, got: %i", i, SDL_TRUE, result);
+    }
+  }
+  SDLTest_AssertPass("Call to SDL_RemoveTimer() for remaining timers");
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -187,9 +301,15 @@ static const SDLTest_TestCaseReference timerTest3 =
 static const SDLTest_TestCaseReference timerTest4 =
         { (SDLTest_TestCaseFp)timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference timerTest5 =
+        { (SDLTest_TestCaseFp)timer_addTimerNS, "timer_addTimerNS", "Call to SDL_AddTimerNS with a sub-millisecond interval", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference timerTest6 =
+        { (SDLTest_TestCaseFp)timer_manyTimers, "timer_manyTimers", "Add and remove many timers and check their firing order", TEST_ENABLED };
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] =  {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, NULL
 };
 
 /* Timer test suite (global) */